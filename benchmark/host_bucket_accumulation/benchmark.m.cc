@@ -0,0 +1,94 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string_view>
+#include <vector>
+
+#include "sxt/curve21/operation/add.h"
+#include "sxt/curve21/operation/double.h"
+#include "sxt/curve21/operation/neg.h"
+#include "sxt/curve21/type/element_p3.h"
+#include "sxt/execution/thread/parallel_for.h"
+#include "sxt/memory/management/managed_array.h"
+#include "sxt/multiexp/bucket_method/host_accumulation.h"
+#include "sxt/ristretto/random/element.h"
+
+using namespace sxt;
+
+//--------------------------------------------------------------------------------------------------
+// main
+//--------------------------------------------------------------------------------------------------
+/**
+ * Time the host bucket accumulation of num_outputs random 32-byte scalar sequences of length n,
+ * either untiled or tiled over the generators.
+ */
+int main(int argc, char* argv[]) {
+  if (argc < 5) {
+    std::cerr << "Usage: benchmark <untiled|tiled> <num_outputs> <n> <num_samples>\n";
+    return -1;
+  }
+  std::string_view method{argv[1]};
+  if (method != "untiled" && method != "tiled") {
+    std::cerr << "invalid method: " << method << "\n";
+    return -1;
+  }
+  auto num_outputs = static_cast<size_t>(std::atoi(argv[2]));
+  auto n = static_cast<size_t>(std::atoi(argv[3]));
+  auto num_samples = std::atoi(argv[4]);
+  if (num_outputs == 0 || n == 0 || num_samples <= 0) {
+    std::cerr << "Restriction: 1 <= num_outputs, 1 <= n, 1 <= num_samples\n";
+    return -1;
+  }
+
+  std::mt19937 rng{0};
+  memmg::managed_array<c21t::element_p3> generators(n);
+  rstrn::generate_random_elements(generators, rng);
+  std::vector<uint8_t> scalar_data(32 * n * num_outputs);
+  std::generate(scalar_data.begin(), scalar_data.end(),
+                [&]() noexcept { return static_cast<uint8_t>(rng()); });
+  std::vector<const uint8_t*> scalars(num_outputs);
+  for (size_t output_index = 0; output_index < num_outputs; ++output_index) {
+    scalars[output_index] = scalar_data.data() + 32 * n * output_index;
+  }
+  memmg::managed_array<c21t::element_p3> bucket_sums(255 * 32 * num_outputs);
+
+  std::vector<double> durations;
+  for (int sample = 0; sample < num_samples; ++sample) {
+    auto t1 = std::chrono::steady_clock::now();
+    if (method == "tiled") {
+      mtxbk::accumulate_buckets_tiled_host<c21t::element_p3>(bucket_sums, generators, scalars);
+    } else {
+      mtxbk::accumulate_buckets_host<c21t::element_p3>(bucket_sums, generators, scalars);
+    }
+    auto t2 = std::chrono::steady_clock::now();
+    durations.push_back(std::chrono::duration<double, std::milli>(t2 - t1).count());
+  }
+  std::sort(durations.begin(), durations.end());
+
+  std::cout << "===== benchmark results\n";
+  std::cout << "method = " << method << "\n";
+  std::cout << "num_threads = " << xent::get_num_threads() << "\n";
+  std::cout << "num_outputs = " << num_outputs << "\n";
+  std::cout << "n = " << n << "\n";
+  std::cout << "best duration (ms): " << durations.front() << "\n";
+  std::cout << "median duration (ms): " << durations[durations.size() / 2] << "\n";
+  return 0;
+}
@@ -16,13 +16,21 @@
  */
 #include "cbindings/backend.h"
 
+#include <fstream>
 #include <iostream>
+#include <optional>
+#include <string>
 
 #include "sxt/base/device/property.h"
 #include "sxt/base/error/assert.h"
 #include "sxt/cbindings/backend/computational_backend.h"
 #include "sxt/cbindings/backend/cpu_backend.h"
+#include "sxt/cbindings/backend/engine_timing.h"
 #include "sxt/cbindings/backend/gpu_backend.h"
+#include "sxt/curve21/type/element_p3.h"
+#include "sxt/curve_g1/type/element_p2.h"
+#include "sxt/execution/thread/parallel_for.h"
+#include "sxt/multiexp/curve/engine_calibration.h"
 #include "sxt/seqcommit/generator/precomputed_initializer.h"
 
 using namespace sxt;
@@ -33,12 +41,70 @@ namespace sxt::cbn {
 //--------------------------------------------------------------------------------------------------
 static cbnbck::computational_backend* backend = nullptr;
 
+//--------------------------------------------------------------------------------------------------
+// generator_storage
+//--------------------------------------------------------------------------------------------------
+static int generator_storage = SXT_GENERATORS_EXPANDED;
+
+//--------------------------------------------------------------------------------------------------
+// engine_calibration_cache_path
+//--------------------------------------------------------------------------------------------------
+/**
+ * If set, engines are calibrated during initialization. An empty path disables the disk cache.
+ */
+static std::optional<std::string> engine_calibration_cache_path{};
+
+//--------------------------------------------------------------------------------------------------
+// calibrate_engines
+//--------------------------------------------------------------------------------------------------
+/**
+ * Calibrate the engines of each curve, reading and writing the calibrations from the cache file
+ * if one is set. The file holds a calibration per curve, labeled with the backend and the curve.
+ */
+static void calibrate_engines(const char* label) noexcept {
+  if (!engine_calibration_cache_path) {
+    return;
+  }
+  auto& path = *engine_calibration_cache_path;
+  auto num_threads = xent::get_num_threads();
+  auto curve25519_label = std::string{label} + "/curve25519";
+  auto bls12_381_g1_label = std::string{label} + "/bls12-381-g1";
+  mtxcrv::engine_calibration curve25519_calibration;
+  mtxcrv::engine_calibration bls12_381_g1_calibration;
+  if (!path.empty()) {
+    std::ifstream in{path};
+    if (in &&
+        mtxcrv::read_engine_calibration(curve25519_calibration, in, curve25519_label,
+                                        num_threads) &&
+        mtxcrv::read_engine_calibration(bls12_381_g1_calibration, in, bls12_381_g1_label,
+                                        num_threads)) {
+      mtxcrv::set_engine_calibration<c21t::element_p3>(curve25519_calibration);
+      mtxcrv::set_engine_calibration<cg1t::element_p2>(bls12_381_g1_calibration);
+      return;
+    }
+  }
+  cbnbck::calibrate_backend_engines(curve25519_calibration, bls12_381_g1_calibration, *backend);
+  mtxcrv::set_engine_calibration<c21t::element_p3>(curve25519_calibration);
+  mtxcrv::set_engine_calibration<cg1t::element_p2>(bls12_381_g1_calibration);
+  if (!path.empty()) {
+    std::ofstream out{path};
+    mtxcrv::write_engine_calibration(out, curve25519_calibration, curve25519_label, num_threads);
+    mtxcrv::write_engine_calibration(out, bls12_381_g1_calibration, bls12_381_g1_label,
+                                     num_threads);
+    if (!out) {
+      std::cout << "WARN: failed to write the engine calibration to " << path << std::endl;
+    }
+  }
+}
+
 //--------------------------------------------------------------------------------------------------
 // initialize_cpu_backend
 //--------------------------------------------------------------------------------------------------
 static void initialize_cpu_backend(const sxt_config* config) noexcept {
   backend = cbnbck::get_cpu_backend();
-  sqcgn::init_precomputed_components(config->num_precomputed_generators, false);
+  sqcgn::init_precomputed_components(config->num_precomputed_generators, false,
+                                     generator_storage == SXT_GENERATORS_COMPRESSED);
+  calibrate_engines("cpu");
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -57,7 +123,9 @@ static void initialize_gpu_backend(const sxt_config* config) noexcept {
   }
 
   backend = cbnbck::get_gpu_backend();
-  sqcgn::init_precomputed_components(config->num_precomputed_generators, true);
+  sqcgn::init_precomputed_components(config->num_precomputed_generators, true,
+                                     generator_storage == SXT_GENERATORS_COMPRESSED);
+  calibrate_engines("gpu");
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -81,6 +149,9 @@ void reset_backend_for_testing() noexcept {
   SXT_RELEASE_ASSERT(backend != nullptr);
 
   backend = nullptr;
+  engine_calibration_cache_path.reset();
+  mtxcrv::reset_engine_calibration_for_testing<c21t::element_p3>();
+  mtxcrv::reset_engine_calibration_for_testing<cg1t::element_p2>();
 }
 } // namespace sxt::cbn
 
@@ -104,3 +175,28 @@ int sxt_init(const sxt_config* config) {
 
   return 1;
 }
+
+//--------------------------------------------------------------------------------------------------
+// sxt_set_precomputed_generator_storage
+//--------------------------------------------------------------------------------------------------
+int sxt_set_precomputed_generator_storage(int storage) {
+  if (cbn::backend != nullptr) {
+    return 1;
+  }
+  if (storage != SXT_GENERATORS_EXPANDED && storage != SXT_GENERATORS_COMPRESSED) {
+    return 1;
+  }
+  cbn::generator_storage = storage;
+  return 0;
+}
+
+//--------------------------------------------------------------------------------------------------
+// sxt_enable_engine_calibration
+//--------------------------------------------------------------------------------------------------
+int sxt_enable_engine_calibration(const char* cache_path) {
+  if (cbn::backend != nullptr) {
+    return 1;
+  }
+  cbn::engine_calibration_cache_path = cache_path == nullptr ? "" : cache_path;
+  return 0;
+}
@@ -27,6 +27,27 @@ TEST_CASE("We can verify that invalid backends will error out") {
   REQUIRE(is_backend_initialized() == false);
 }
 
+TEST_CASE("We can choose how precomputed generators are stored") {
+  SECTION("invalid storage modes error out") {
+    REQUIRE(sxt_set_precomputed_generator_storage(-1) != 0);
+  }
+
+  SECTION("the storage mode can't be changed after initialization") {
+    REQUIRE(sxt_set_precomputed_generator_storage(SXT_GENERATORS_EXPANDED) == 0);
+    const sxt_config config = {SXT_CPU_BACKEND, 0};
+    REQUIRE(sxt_init(&config) == 0);
+    REQUIRE(sxt_set_precomputed_generator_storage(SXT_GENERATORS_COMPRESSED) != 0);
+    reset_backend_for_testing();
+  }
+}
+
+TEST_CASE("Engine calibration can't be enabled after initialization") {
+  const sxt_config config = {SXT_CPU_BACKEND, 0};
+  REQUIRE(sxt_init(&config) == 0);
+  REQUIRE(sxt_enable_engine_calibration(nullptr) != 0);
+  reset_backend_for_testing();
+}
+
 static void test_backend_initialization(int backend) {
   SECTION("The backend is not initialized before calling `sxt_init` function") {
     REQUIRE(is_backend_initialized() == false);
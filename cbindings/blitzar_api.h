@@ -25,6 +25,14 @@ extern "C" {
 #define SXT_CPU_BACKEND 1
 #define SXT_GPU_BACKEND 2
 
+#define SXT_MSM_AUTO 0
+#define SXT_MSM_NAIVE 1
+#define SXT_MSM_PIPPENGER 2
+#define SXT_MSM_BUCKET 3
+
+#define SXT_GENERATORS_EXPANDED 0
+#define SXT_GENERATORS_COMPRESSED 1
+
 /** config struct to hold the chosen backend **/
 struct sxt_config {
   int backend;
@@ -65,6 +73,13 @@ struct sxt_bls12_381_g1 {
   uint64_t Y[6];
 };
 
+struct sxt_bls12_381_g1_p2 {
+  // encodes a projective element of the bls12-381 G1 group
+  uint64_t X[6];
+  uint64_t Y[6];
+  uint64_t Z[6];
+};
+
 /** describes a sequence of values **/
 struct sxt_sequence_descriptor {
   // the number of bytes used to represent an element in the sequence
@@ -84,6 +99,57 @@ struct sxt_sequence_descriptor {
   int is_signed;
 };
 
+/** describes a sequence of bit-packed unsigned values **/
+struct sxt_packed_sequence_descriptor {
+  // the number of bits used to represent an element in the sequence
+  // element_nbits must satisfy 1 <= element_nbits <= 256
+  uint16_t element_nbits;
+
+  // the number of elements in the sequence
+  uint64_t n;
+
+  // pointer to the data for the sequence of elements where the n elements are packed
+  // as a little endian stream of bits and element j occupies the bits
+  // [j * element_nbits, (j + 1) * element_nbits)
+  const uint8_t* data;
+};
+
+#define SXT_COLUMN_EXPRESSION_COLUMN 0
+#define SXT_COLUMN_EXPRESSION_ADD 1
+#define SXT_COLUMN_EXPRESSION_SUB 2
+#define SXT_COLUMN_EXPRESSION_MUL 3
+#define SXT_COLUMN_EXPRESSION_SCALE 4
+#define SXT_COLUMN_EXPRESSION_SELECT 5
+
+/** a node of a column expression **/
+struct sxt_column_expression_node {
+  // the operation computed by the node; one of
+  //   SXT_COLUMN_EXPRESSION_COLUMN: the source column with index lhs
+  //   SXT_COLUMN_EXPRESSION_ADD: nodes lhs + rhs
+  //   SXT_COLUMN_EXPRESSION_SUB: nodes lhs - rhs
+  //   SXT_COLUMN_EXPRESSION_MUL: the elementwise product of nodes lhs and rhs
+  //   SXT_COLUMN_EXPRESSION_SCALE: node lhs multiplied by constant
+  //   SXT_COLUMN_EXPRESSION_SELECT: node lhs in rows whose bit in bitmap is set; otherwise, 0
+  int op;
+
+  // operands; nodes may only refer to earlier nodes of the same expression
+  uint32_t lhs;
+  uint32_t rhs;
+
+  // the constant of SXT_COLUMN_EXPRESSION_SCALE
+  struct sxt_curve25519_scalar constant;
+
+  // the bitmap of SXT_COLUMN_EXPRESSION_SELECT where bit i (little endian bit order) selects
+  // row i; it must cover every row of the expression
+  const uint8_t* bitmap;
+};
+
+/** a column derived from source columns; its value is that of its last node **/
+struct sxt_column_expression {
+  uint32_t num_nodes;
+  const struct sxt_column_expression_node* nodes;
+};
+
 /**
  * Initialize the library. This should only be called once.
  *
@@ -98,6 +164,47 @@ struct sxt_sequence_descriptor {
  */
 int sxt_init(const struct sxt_config* config);
 
+/**
+ * Choose how the precomputed generators are stored. This must be called before `sxt_init`.
+ *
+ * With SXT_GENERATORS_EXPANDED (the default), generators are stored as curve points ready for
+ * use, which takes 160 bytes per generator. With SXT_GENERATORS_COMPRESSED, they are stored as
+ * 32-byte ristretto encodings and decompressed on demand whenever a computation uses them. This
+ * lets a larger `num_precomputed_generators` fit in memory at the cost of the decompression work.
+ *
+ * Arguments:
+ *
+ * - storage (in): SXT_GENERATORS_EXPANDED or SXT_GENERATORS_COMPRESSED
+ *
+ * # Return:
+ *
+ * - 0 on success; otherwise a nonzero error code (if storage is invalid or the library is
+ *   already initialized)
+ */
+int sxt_set_precomputed_generator_storage(int storage);
+
+/**
+ * Calibrate the multiexponentiation engines during `sxt_init`. This must be called before
+ * `sxt_init`.
+ *
+ * Calibration times each engine on a grid of representative problem shapes using the chosen
+ * backend, separately for curve25519 and bls12-381 G1. Afterwards, multiexponentiations with
+ * SXT_MSM_AUTO, and commitments computed on the cpu backend, use the engine that was fastest for
+ * the nearest shape on their curve. Without calibration, the cpu backend uses Pippenger's
+ * algorithm at every size for SXT_MSM_AUTO and for every kind of commitment.
+ *
+ * Arguments:
+ *
+ * - cache_path (in): optional file used to cache the calibration. If the file holds a calibration
+ *   for the same backend and thread count, it's used without timing the engines; otherwise, the
+ *   new calibration is written to it. May be NULL to always calibrate without caching.
+ *
+ * # Return:
+ *
+ * - 0 on success; otherwise a nonzero error code (if the library is already initialized)
+ */
+int sxt_enable_engine_calibration(const char* cache_path);
+
 /**
  * Compute the Pedersen commitments for sequences of values
  *
@@ -143,6 +250,162 @@ void sxt_curve25519_compute_pedersen_commitments(struct sxt_ristretto255_compres
                                                  const struct sxt_sequence_descriptor* descriptors,
                                                  uint64_t offset_generators);
 
+/**
+ * Set the window used to coalesce concurrent calls to
+ * `sxt_curve25519_compute_pedersen_commitments`
+ *
+ * When the window is non-zero, a call waits up to window_us microseconds for calls from
+ * other threads. Calls whose generator ranges overlap or are adjacent are then computed in
+ * a single multiexponentiation; calls with disjoint ranges are computed separately. This
+ * raises throughput when many small commitments are requested concurrently, at the cost of
+ * up to window_us of added latency per call.
+ *
+ * # Arguments:
+ *
+ * - window_us (in): the coalescing window in microseconds; 0, the default, disables
+ *                   coalescing
+ *
+ * # Considerations:
+ *
+ * - the window can be changed at any time and applies to calls made afterwards
+ */
+void sxt_curve25519_set_commitment_coalescing_window(uint64_t window_us);
+
+/**
+ * Compute the Pedersen commitments for sequences of values, each against its own range
+ * of generators
+ *
+ * Denote an element of a sequence by a_ij where i represents the sequence index
+ * and j represents the element index. Let * represent the operator for the
+ * ristretto255 group. Then res\[i] encodes the ristretto255 group value
+ *
+ * ```text
+ *     Prod_{j=1 to n_i} g_{offsets_generators[i] + j} ^ a_ij
+ * ```
+ *
+ * where n_i represents the number of elements in sequence i and g_{offsets_generators[i] + j}
+ * is a group element determined by a prespecified function
+ *
+ * ```text
+ *     g: uint64_t -> ristretto255
+ * ```
+ *
+ * The sequences are grouped into connected components of overlapping generator ranges.
+ * Each component's generators are fetched once and each sequence is computed against a
+ * view of its own generators, with sequences that share an offset computed together.
+ * This is useful for committing to chunks of the same column or to table partitions at
+ * different row offsets in one call.
+ *
+ * # Arguments:
+ *
+ * - commitments   (out): an array of length num_sequences where the computed commitments
+ *                     of each sequence must be written into
+ *
+ * - num_sequences (in): specifies the number of sequences
+ * - descriptors   (in): an array of length num_sequences that specifies each sequence
+ * - offsets_generators (in): an array of length num_sequences that specifies the offset
+ *                     used to fetch the generators of each sequence
+ *
+ * # Abnormal program termination in case of:
+ *
+ * - backend not initialized or incorrectly initialized
+ * - descriptors == nullptr
+ * - commitments == nullptr
+ * - offsets_generators == nullptr
+ * - descriptor\[i].element_nbytes == 0
+ * - descriptor\[i].element_nbytes > 32
+ * - descriptor\[i].n > 0 && descriptor\[i].data == nullptr
+ *
+ * # Considerations:
+ *
+ * - num_sequences equal to 0 will skip the computation
+ * - generators are only fetched for the union of the ranges, so ranges that are far apart
+ *   don't fetch the generators between them
+ */
+void sxt_curve25519_compute_pedersen_commitments_with_offsets(
+    struct sxt_ristretto255_compressed* commitments, uint32_t num_sequences,
+    const struct sxt_sequence_descriptor* descriptors, const uint64_t* offsets_generators);
+
+/**
+ * Compute the Pedersen commitments for sequences of bit-packed unsigned values
+ *
+ * This computes the same commitments as `sxt_curve25519_compute_pedersen_commitments`
+ * for values that don't fill a power of 2 number of bytes, such as 12-bit codes or
+ * 40-bit timestamps. Large problems read the values at their packed width and unpack
+ * them a chunk at a time as the multiexponentiation decomposes them, so memory tracks
+ * the packed width rather than a padded one. Small problems are unpacked at once and
+ * computed like any other commitment.
+ *
+ * # Arguments:
+ *
+ * - commitments   (out): an array of length num_sequences where the computed commitments
+ *                     of each sequence must be written into
+ *
+ * - num_sequences (in): specifies the number of sequences
+ * - descriptors   (in): an array of length num_sequences that specifies each sequence
+ * - offset_generators (in): specifies the offset used to fetch the generators
+ *
+ * # Abnormal program termination in case of:
+ *
+ * - backend not initialized or incorrectly initialized
+ * - descriptors == nullptr
+ * - commitments == nullptr
+ * - descriptor\[i].element_nbits == 0
+ * - descriptor\[i].element_nbits > 256
+ * - descriptor\[i].n > 0 && descriptor\[i].data == nullptr
+ *
+ * # Considerations:
+ *
+ * - num_sequences equal to 0 will skip the computation
+ */
+void sxt_curve25519_compute_pedersen_commitments_packed(
+    struct sxt_ristretto255_compressed* commitments, uint32_t num_sequences,
+    const struct sxt_packed_sequence_descriptor* descriptors, uint64_t offset_generators);
+
+/**
+ * Compute the Pedersen commitments of columns derived from source columns
+ *
+ * Each expression describes a derived column such as `a * b`, `a - c` or `filter ? x : 0`
+ * with arithmetic in the curve25519 scalar field. res\[i] is the commitment
+ *
+ * ```text
+ *     Prod_{j=1 to n_i} g_{offset_generators + j} ^ e_ij
+ * ```
+ *
+ * where e_ij is row j of expression i and n_i is the length of the longest source column
+ * that expression i references; shorter columns are treated as zero-padded.
+ *
+ * Derived columns are evaluated a chunk of rows at a time, right before the chunk is
+ * committed, so they are never materialized in full.
+ *
+ * # Arguments:
+ *
+ * - commitments     (out): an array of length num_expressions where the computed commitments
+ *                     of each expression must be written into
+ * - num_expressions (in): specifies the number of expressions
+ * - expressions     (in): an array of length num_expressions that specifies each expression
+ * - num_columns     (in): specifies the number of source columns
+ * - columns         (in): an array of length num_columns that specifies each source column
+ * - offset_generators (in): specifies the offset used to fetch the generators
+ *
+ * # Abnormal program termination in case of:
+ *
+ * - backend not initialized or incorrectly initialized
+ * - commitments == nullptr or expressions == nullptr with num_expressions > 0
+ * - an expression with no nodes, an unknown operation, an operand that doesn't refer to an
+ *   earlier node or to a source column, or a select node without a bitmap
+ * - columns\[i].element_nbytes == 0 or columns\[i].element_nbytes > 32
+ * - columns\[i].n > 0 && columns\[i].data == nullptr
+ *
+ * # Considerations:
+ *
+ * - num_expressions equal to 0 will skip the computation
+ */
+void sxt_curve25519_compute_pedersen_commitments_of_expressions(
+    struct sxt_ristretto255_compressed* commitments, uint32_t num_expressions,
+    const struct sxt_column_expression* expressions, uint32_t num_columns,
+    const struct sxt_sequence_descriptor* columns, uint64_t offset_generators);
+
 /**
  * Compute the Pedersen commitments for sequences of values
  *
@@ -224,72 +487,739 @@ void sxt_bls12_381_g1_compute_pedersen_commitments_with_generators(
     const struct sxt_sequence_descriptor* descriptors, const struct sxt_bls12_381_g1* generators);
 
 /**
- * Gets the pre-specified random generated elements used for the Pedersen commitments in the
- * `sxt_curve25519_compute_pedersen_commitments` function
+ * Compute Pedersen commitments without compressing them
  *
- * sxt_ristretto255_get_generators(generators, num_generators, offset_generators) →
- *     generators\[0] = generate_random_ristretto(0 + offset_generators)
- *     generators\[1] = generate_random_ristretto(1 + offset_generators)
- *     generators\[2] = generate_random_ristretto(2 + offset_generators)
- *       .
- *       .
- *       .
- *     generators\[num_generators - 1] = generate_random_ristretto(num_generators - 1 +
- * offset_generators)
+ * These functions compute the same group values as
+ *
+ * - `sxt_curve25519_compute_pedersen_commitments`
+ * - `sxt_curve25519_compute_pedersen_commitments_with_generators`
+ * - `sxt_bls12_381_g1_compute_pedersen_commitments_with_generators`
+ *
+ * but write them in projective form instead of compressing them. Compression costs an inversion
+ * and a square root per commitment. Callers that go on to aggregate, blind or multiexponentiate
+ * the commitments can skip it and compress the final values with
+ * `sxt_ristretto255_batch_compress` or `sxt_bls12_381_g1_batch_compress`.
  *
  * # Arguments:
  *
- * - generators         (out): sxt_element_p3 pointer where the results must be written into
+ * - commitments   (out): an array of length num_sequences where the computed commitments
+ *                     of each sequence must be written into
  *
- * - num_generators     (in): the total number of random generated elements to be computed
- * - offset_generators  (in): the offset that shifts the first element computed from `0` to
- * `offset_generators`
+ * - num_sequences (in): specifies the number of sequences
+ * - descriptors   (in): an array of length num_sequences that specifies each sequence
+ * - offset_generators (in): specifies the offset used to fetch the generators
+ * - generators    (in): an array of length `max_num_rows` = `the maximum between all n_i`
  *
- * # Return:
+ * # Abnormal program termination in case of:
  *
- * - 0 on success; otherwise a nonzero error code
+ * - backend not initialized or incorrectly initialized
+ * - descriptors == nullptr
+ * - commitments == nullptr
+ * - descriptor\[i].element_nbytes == 0
+ * - descriptor\[i].element_nbytes > 32
+ * - descriptor\[i].n > 0 && descriptor\[i].data == nullptr
  *
- * # Invalid input parameters, which generate error code:
+ * # Considerations:
  *
- * - num_generators > 0 && generators == nullptr
+ * - num_sequences equal to 0 will skip the computation
+ * - the projective representation of a commitment isn't unique; compare commitments through
+ *   their compressed encodings
+ */
+void sxt_curve25519_compute_uncompressed_pedersen_commitments(
+    struct sxt_ristretto255* commitments, uint32_t num_sequences,
+    const struct sxt_sequence_descriptor* descriptors, uint64_t offset_generators);
+
+void sxt_curve25519_compute_uncompressed_pedersen_commitments_with_generators(
+    struct sxt_ristretto255* commitments, uint32_t num_sequences,
+    const struct sxt_sequence_descriptor* descriptors, const struct sxt_ristretto255* generators);
+
+void sxt_bls12_381_g1_compute_uncompressed_pedersen_commitments_with_generators(
+    struct sxt_bls12_381_g1_p2* commitments, uint32_t num_sequences,
+    const struct sxt_sequence_descriptor* descriptors, const struct sxt_bls12_381_g1* generators);
+
+/**
+ * Compute blinded Pedersen commitments for sequences of values
+ *
+ * Denote an element of a sequence by a_ij where i represents the sequence index
+ * and j represents the element index. Let * represent the operator for the
+ * ristretto255 group. Then res\[i] encodes the ristretto255 group value
+ *
+ * ```text
+ *     h ^ r_i * Prod_{j=1 to n_i} g_{offset_generators + j} ^ a_ij
+ * ```
+ *
+ * where n_i represents the number of elements in sequence i, r_i is the blinding
+ * scalar of sequence i, h is the blinding base, and g_{offset_generators + j}
+ * is a group element determined by a prespecified function
+ *
+ * ```text
+ *     g: uint64_t -> ristretto255
+ * ```
+ *
+ * The blinding terms are computed in the same multiexponentiation as the commitments.
+ *
+ * # Arguments:
+ *
+ * - commitments   (out): an array of length num_sequences where the computed commitments
+ *                     of each sequence must be written into
+ *
+ * - num_sequences (in): specifies the number of sequences
+ * - descriptors   (in): an array of length num_sequences that specifies each sequence
+ * - blindings     (in): an array of length num_sequences of blinding scalars
+ * - blinding_base (in): the blinding base h
+ * - offset_generators (in): specifies the offset used to fetch the generators
+ *
+ * # Abnormal program termination in case of:
+ *
+ * - backend not initialized or incorrectly initialized
+ * - descriptors == nullptr
+ * - commitments == nullptr
+ * - blindings == nullptr
+ * - blinding_base == nullptr
+ * - descriptor\[i].element_nbytes == 0
+ * - descriptor\[i].element_nbytes > 32
+ * - descriptor\[i].n > 0 && descriptor\[i].data == nullptr
  *
  * # Considerations:
  *
- * - num_generators equal to 0 will skip the computation
+ * - num_sequences equal to 0 will skip the computation
  */
-int sxt_ristretto255_get_generators(struct sxt_ristretto255* generators, uint64_t offset_generators,
-                                    uint64_t num_generators);
+void sxt_curve25519_compute_blinded_pedersen_commitments(
+    struct sxt_ristretto255_compressed* commitments, uint32_t num_sequences,
+    const struct sxt_sequence_descriptor* descriptors,
+    const struct sxt_curve25519_scalar* blindings, const struct sxt_ristretto255* blinding_base,
+    uint64_t offset_generators);
 
 /**
- * Gets the n-th ristretto point defined as:
+ * Compute blinded Pedersen commitments for sequences of values
  *
- * If n == 0:
- *    one_commit[0] = ristretto_identity;
+ * Denote an element of a sequence by a_ij where i represents the sequence index
+ * and j represents the element index. Let * represent the operator for the
+ * ristretto255 group. Then res\[i] encodes the ristretto255 group value
  *
- * Else:
- *    one_commit[0] = g[0] + g[1] + ... + g[n - 1];
+ * ```text
+ *     h ^ r_i * Prod_{j=1 to n_i} g_j ^ a_ij
+ * ```
  *
- * where
+ * where n_i represents the number of elements in sequence i, r_i is the blinding
+ * scalar of sequence i, h is the blinding base, and g_j is a group element
+ * determined by the `generators\[j]` user value given as input
  *
- * struct sxt_ristretto255 ristretto_identity = {
- *    {0, 0, 0, 0, 0},
- *    {1, 0, 0, 0, 0},
- *    {1, 0, 0, 0, 0},
- *    {0, 0, 0, 0, 0},
- * };
+ * The blinding terms are computed in the same multiexponentiation as the commitments.
  *
- * and `g[i]` is the i-th generator provided by `sxt_ristretto255_get_generators` function at offset
- * 0.
+ * # Arguments:
  *
- * # Return:
+ * - commitments   (out): an array of length num_sequences where the computed commitments
+ *                     of each sequence must be written into
  *
- * - 0 on success; otherwise a nonzero error code
+ * - num_sequences (in): specifies the number of sequences
+ * - descriptors   (in): an array of length num_sequences that specifies each sequence
+ * - blindings     (in): an array of length num_sequences of blinding scalars
+ * - generators    (in): an array of length `max_num_rows` = `the maximum between all n_i`
+ * - blinding_base (in): the blinding base h
  *
- * # Invalid input parameters, which generate error code:
+ * # Abnormal program termination in case of:
  *
- * - one_commit == nullptr
+ * - backend not initialized or incorrectly initialized
+ * - descriptors == nullptr
+ * - commitments == nullptr
+ * - blindings == nullptr
+ * - blinding_base == nullptr
+ * - descriptor\[i].element_nbytes == 0
+ * - descriptor\[i].element_nbytes > 32
+ * - descriptor\[i].n > 0 && descriptor\[i].data == nullptr
+ *
+ * # Considerations:
+ *
+ * - num_sequences equal to 0 will skip the computation
  */
-int sxt_curve25519_get_one_commit(struct sxt_ristretto255* one_commit, uint64_t n);
+void sxt_curve25519_compute_blinded_pedersen_commitments_with_generators(
+    struct sxt_ristretto255_compressed* commitments, uint32_t num_sequences,
+    const struct sxt_sequence_descriptor* descriptors,
+    const struct sxt_curve25519_scalar* blindings, const struct sxt_ristretto255* generators,
+    const struct sxt_ristretto255* blinding_base);
+
+/**
+ * Compute blinded Pedersen commitments for sequences of values
+ *
+ * Denote an element of a sequence by a_ij where i represents the sequence index
+ * and j represents the element index. Let * represent the operator for the
+ * bls12-381 G1 group. Then res\[i] encodes the bls12-381 G1 group value
+ *
+ * ```text
+ *     h ^ r_i * Prod_{j=1 to n_i} g_j ^ a_ij
+ * ```
+ *
+ * where n_i represents the number of elements in sequence i, r_i is the blinding
+ * scalar of sequence i, h is the blinding base, and g_j is a group element
+ * determined by the `generators\[j]` user value given as input
+ *
+ * The blinding terms are computed in the same multiexponentiation as the commitments.
+ *
+ * # Arguments:
+ *
+ * - commitments   (out): an array of length num_sequences where the computed commitments
+ *                     of each sequence must be written into
+ *
+ * - num_sequences (in): specifies the number of sequences
+ * - descriptors   (in): an array of length num_sequences that specifies each sequence
+ * - blindings     (in): an array of 32 * num_sequences bytes where every 32 bytes encode
+ *                     a blinding scalar represented in the little endian format
+ * - generators    (in): an array of length `max_num_rows` = `the maximum between all n_i`
+ * - blinding_base (in): the blinding base h
+ *
+ * # Abnormal program termination in case of:
+ *
+ * - backend not initialized or incorrectly initialized
+ * - descriptors == nullptr
+ * - commitments == nullptr
+ * - blindings == nullptr
+ * - blinding_base == nullptr
+ * - descriptor\[i].element_nbytes == 0
+ * - descriptor\[i].element_nbytes > 32
+ * - descriptor\[i].n > 0 && descriptor\[i].data == nullptr
+ *
+ * # Considerations:
+ *
+ * - num_sequences equal to 0 will skip the computation
+ */
+void sxt_bls12_381_g1_compute_blinded_pedersen_commitments_with_generators(
+    struct sxt_bls12_381_g1_compressed* commitments, uint32_t num_sequences,
+    const struct sxt_sequence_descriptor* descriptors, const uint8_t* blindings,
+    const struct sxt_bls12_381_g1* generators, const struct sxt_bls12_381_g1* blinding_base);
+
+/**
+ * Compute a linear combination of compressed ristretto255 commitments
+ *
+ * Let * represent the operator for the ristretto255 group. Then res encodes the
+ * ristretto255 group value
+ *
+ * ```text
+ *     Prod_{i=1 to n} commitments_i ^ scalars_i
+ * ```
+ *
+ * The commitments are decompressed in a batch and the combination is computed with a
+ * single multiexponentiation.
+ *
+ * # Arguments:
+ *
+ * - res         (out): the compressed combination
+ *
+ * - n           (in): the number of commitments
+ * - commitments (in): an array of length n of compressed commitments
+ * - scalars     (in): an array of length n of scalars
+ *
+ * # Return:
+ *
+ * - 0 on success; otherwise a nonzero error code
+ *
+ * # Invalid input parameters, which generate error code:
+ *
+ * - commitments\[i] doesn't encode a ristretto255 element
+ *
+ * # Abnormal program termination in case of:
+ *
+ * - backend not initialized or incorrectly initialized
+ * - res == nullptr
+ * - n > 0 && (commitments == nullptr || scalars == nullptr)
+ *
+ * # Considerations:
+ *
+ * - n equal to 0 will write the identity into res
+ */
+int sxt_curve25519_combine_commitments(struct sxt_ristretto255_compressed* res, uint64_t n,
+                                       const struct sxt_ristretto255_compressed* commitments,
+                                       const struct sxt_curve25519_scalar* scalars);
+
+/**
+ * Compute a linear combination of compressed bls12-381 G1 commitments
+ *
+ * Let * represent the operator for the bls12-381 G1 group. Then res encodes the
+ * bls12-381 G1 group value
+ *
+ * ```text
+ *     Prod_{i=1 to n} commitments_i ^ scalars_i
+ * ```
+ *
+ * The commitments are decompressed in a batch and the combination is computed with a
+ * single multiexponentiation.
+ *
+ * # Arguments:
+ *
+ * - res         (out): the compressed combination
+ *
+ * - n           (in): the number of commitments
+ * - commitments (in): an array of length n of compressed commitments
+ * - scalars     (in): an array of 32 * n bytes where every 32 bytes encode a scalar
+ *                     represented in the little endian format
+ *
+ * # Return:
+ *
+ * - 0 on success; otherwise a nonzero error code
+ *
+ * # Invalid input parameters, which generate error code:
+ *
+ * - commitments\[i] doesn't encode an element of the bls12-381 G1 subgroup
+ *
+ * # Abnormal program termination in case of:
+ *
+ * - backend not initialized or incorrectly initialized
+ * - res == nullptr
+ * - n > 0 && (commitments == nullptr || scalars == nullptr)
+ *
+ * # Considerations:
+ *
+ * - n equal to 0 will write the identity into res
+ */
+int sxt_bls12_381_g1_combine_commitments(struct sxt_bls12_381_g1_compressed* res, uint64_t n,
+                                         const struct sxt_bls12_381_g1_compressed* commitments,
+                                         const uint8_t* scalars);
+
+/**
+ * Decompress bls12-381 G1 elements to affine coordinates
+ *
+ * The elements are decompressed in parallel and each one is checked to be a member
+ * of the prime order subgroup.
+ *
+ * # Arguments:
+ *
+ * - res    (out): an array of length n where the decompressed elements are written
+ *
+ * - n      (in): the number of elements
+ * - points (in): an array of length n of compressed elements
+ *
+ * # Return:
+ *
+ * - 0 on success; otherwise a nonzero error code
+ *
+ * # Invalid input parameters, which generate error code:
+ *
+ * - points\[i] doesn't encode an element of the bls12-381 G1 subgroup
+ * - points\[i] encodes the identity, which has no affine representation
+ *
+ * # Abnormal program termination in case of:
+ *
+ * - n > 0 && (res == nullptr || points == nullptr)
+ */
+int sxt_bls12_381_g1_batch_decompress(struct sxt_bls12_381_g1* res, uint64_t n,
+                                      const struct sxt_bls12_381_g1_compressed* points);
+
+/**
+ * Compress projective bls12-381 G1 elements
+ *
+ * The elements are converted to affine coordinates with a single shared inversion and
+ * compressed in parallel.
+ *
+ * # Arguments:
+ *
+ * - res    (out): an array of length n where the compressed elements are written
+ *
+ * - n      (in): the number of elements
+ * - points (in): an array of length n of projective elements
+ *
+ * # Abnormal program termination in case of:
+ *
+ * - n > 0 && (res == nullptr || points == nullptr)
+ */
+void sxt_bls12_381_g1_batch_compress(struct sxt_bls12_381_g1_compressed* res, uint64_t n,
+                                     const struct sxt_bls12_381_g1_p2* points);
+
+/**
+ * Compress ristretto255 elements
+ *
+ * The elements are compressed in parallel.
+ *
+ * # Arguments:
+ *
+ * - res    (out): an array of length n where the compressed elements are written
+ *
+ * - n      (in): the number of elements
+ * - points (in): an array of length n of elements
+ *
+ * # Abnormal program termination in case of:
+ *
+ * - n > 0 && (res == nullptr || points == nullptr)
+ */
+void sxt_ristretto255_batch_compress(struct sxt_ristretto255_compressed* res, uint64_t n,
+                                     const struct sxt_ristretto255* points);
+
+/**
+ * Decompress ristretto255 elements
+ *
+ * The elements are decompressed in parallel.
+ *
+ * # Arguments:
+ *
+ * - res    (out): an array of length n where the decompressed elements are written
+ *
+ * - n      (in): the number of elements
+ * - points (in): an array of length n of compressed elements
+ *
+ * # Return:
+ *
+ * - 0 on success; otherwise a nonzero error code
+ *
+ * # Invalid input parameters, which generate error code:
+ *
+ * - points\[i] isn't a canonical ristretto255 encoding
+ *
+ * # Abnormal program termination in case of:
+ *
+ * - n > 0 && (res == nullptr || points == nullptr)
+ */
+int sxt_ristretto255_batch_decompress(struct sxt_ristretto255* res, uint64_t n,
+                                      const struct sxt_ristretto255_compressed* points);
+
+/**
+ * Compute multiexponentiations of ristretto255 elements
+ *
+ * Denote the scalars of output i by a_ij. Let * represent the operator for the
+ * ristretto255 group. Then res\[i] is the ristretto255 group value
+ *
+ * ```text
+ *     Prod_{j=1 to n} points_j ^ a_ij
+ * ```
+ *
+ * All of the outputs share the same points.
+ *
+ * # Arguments:
+ *
+ * - res         (out): an array of length num_outputs where the uncompressed results
+ *                      are written into
+ *
+ * - num_outputs (in): the number of multiexponentiations
+ * - n           (in): the number of points
+ * - points      (in): an array of length n
+ * - scalars     (in): an array of length num_outputs * n where the scalars of output i
+ *                     are stored at scalars\[i * n], ..., scalars\[i * n + n - 1]
+ * - mode        (in): the engine used to compute the multiexponentiations; one of
+ *                     SXT_MSM_AUTO, SXT_MSM_NAIVE, SXT_MSM_PIPPENGER, or SXT_MSM_BUCKET
+ *
+ * # Abnormal program termination in case of:
+ *
+ * - backend not initialized or incorrectly initialized
+ * - num_outputs > 0 && res == nullptr
+ * - n > 0 && (points == nullptr || scalars == nullptr)
+ * - mode isn't a valid engine
+ *
+ * # Considerations:
+ *
+ * - SXT_MSM_AUTO picks the calibrated engine for the problem dimensions; without calibration
+ *   it's Pippenger's algorithm on the cpu backend and is picked from the problem dimensions on
+ *   the gpu backend
+ * - an engine that doesn't apply to the problem dimensions or to the backend falls back to
+ *   Pippenger's algorithm
+ */
+void sxt_ristretto255_multiexponentiation(struct sxt_ristretto255* res, uint32_t num_outputs,
+                                          uint64_t n, const struct sxt_ristretto255* points,
+                                          const struct sxt_curve25519_scalar* scalars, int mode);
+
+/**
+ * Compute multiexponentiations of bls12-381 G1 elements
+ *
+ * Denote the scalars of output i by a_ij. Let * represent the operator for the
+ * bls12-381 G1 group. Then res\[i] is the bls12-381 G1 group value
+ *
+ * ```text
+ *     Prod_{j=1 to n} points_j ^ a_ij
+ * ```
+ *
+ * All of the outputs share the same points.
+ *
+ * # Arguments:
+ *
+ * - res         (out): an array of length num_outputs where the projective results
+ *                      are written into
+ *
+ * - num_outputs (in): the number of multiexponentiations
+ * - n           (in): the number of points
+ * - points      (in): an array of length n
+ * - scalars     (in): an array of 32 * num_outputs * n bytes where every 32 bytes encode a
+ *                     scalar represented in the little endian format and the scalars of
+ *                     output i start at byte 32 * i * n
+ * - mode        (in): the engine used to compute the multiexponentiations; one of
+ *                     SXT_MSM_AUTO, SXT_MSM_NAIVE, SXT_MSM_PIPPENGER, or SXT_MSM_BUCKET
+ *
+ * # Abnormal program termination in case of:
+ *
+ * - backend not initialized or incorrectly initialized
+ * - num_outputs > 0 && res == nullptr
+ * - n > 0 && (points == nullptr || scalars == nullptr)
+ * - mode isn't a valid engine
+ *
+ * # Considerations:
+ *
+ * - SXT_MSM_AUTO picks the calibrated engine for the problem dimensions; without calibration
+ *   it's Pippenger's algorithm on the cpu backend and is picked from the problem dimensions on
+ *   the gpu backend
+ * - an engine that doesn't apply to the problem dimensions or to the backend falls back to
+ *   Pippenger's algorithm
+ */
+void sxt_bls12_381_g1_multiexponentiation(struct sxt_bls12_381_g1_p2* res, uint32_t num_outputs,
+                                          uint64_t n, const struct sxt_bls12_381_g1* points,
+                                          const uint8_t* scalars, int mode);
+
+/**
+ * Gets the pre-specified random generated elements used for the Pedersen commitments in the
+ * `sxt_curve25519_compute_pedersen_commitments` function
+ *
+ * sxt_ristretto255_get_generators(generators, num_generators, offset_generators) →
+ *     generators\[0] = generate_random_ristretto(0 + offset_generators)
+ *     generators\[1] = generate_random_ristretto(1 + offset_generators)
+ *     generators\[2] = generate_random_ristretto(2 + offset_generators)
+ *       .
+ *       .
+ *       .
+ *     generators\[num_generators - 1] = generate_random_ristretto(num_generators - 1 +
+ * offset_generators)
+ *
+ * # Arguments:
+ *
+ * - generators         (out): sxt_element_p3 pointer where the results must be written into
+ *
+ * - num_generators     (in): the total number of random generated elements to be computed
+ * - offset_generators  (in): the offset that shifts the first element computed from `0` to
+ * `offset_generators`
+ *
+ * # Return:
+ *
+ * - 0 on success; otherwise a nonzero error code
+ *
+ * # Invalid input parameters, which generate error code:
+ *
+ * - num_generators > 0 && generators == nullptr
+ *
+ * # Considerations:
+ *
+ * - num_generators equal to 0 will skip the computation
+ */
+int sxt_ristretto255_get_generators(struct sxt_ristretto255* generators, uint64_t offset_generators,
+                                    uint64_t num_generators);
+
+/**
+ * Gets the n-th ristretto point defined as:
+ *
+ * If n == 0:
+ *    one_commit[0] = ristretto_identity;
+ *
+ * Else:
+ *    one_commit[0] = g[0] + g[1] + ... + g[n - 1];
+ *
+ * where
+ *
+ * struct sxt_ristretto255 ristretto_identity = {
+ *    {0, 0, 0, 0, 0},
+ *    {1, 0, 0, 0, 0},
+ *    {1, 0, 0, 0, 0},
+ *    {0, 0, 0, 0, 0},
+ * };
+ *
+ * and `g[i]` is the i-th generator provided by `sxt_ristretto255_get_generators` function at offset
+ * 0.
+ *
+ * # Return:
+ *
+ * - 0 on success; otherwise a nonzero error code
+ *
+ * # Invalid input parameters, which generate error code:
+ *
+ * - one_commit == nullptr
+ */
+int sxt_curve25519_get_one_commit(struct sxt_ristretto255* one_commit, uint64_t n);
+
+/**
+ * Elementwise arithmetic over arrays of curve25519 scalars
+ *
+ * Compute, for i = 0, ..., n - 1,
+ *
+ * ```text
+ *     sxt_curve25519_scalar_batch_add: res[i] = lhs[i] + rhs[i]
+ *     sxt_curve25519_scalar_batch_sub: res[i] = lhs[i] - rhs[i]
+ *     sxt_curve25519_scalar_batch_mul: res[i] = lhs[i] * rhs[i]
+ * ```
+ *
+ * modulo (2^252 + 27742317777372353535851937790883648493). The work is split across the host
+ * threads, so a single call can process millions of scalars.
+ *
+ * # Arguments:
+ *
+ * - res (out): an array of length n
+ *
+ * - n   (in): the number of scalars
+ * - lhs (in): an array of length n
+ * - rhs (in): an array of length n
+ *
+ * # Abnormal program termination in case of:
+ *
+ * - n > 0 && (res == nullptr || lhs == nullptr || rhs == nullptr)
+ *
+ * # Considerations:
+ *
+ * - res may alias lhs or rhs
+ * - the backend doesn't need to be initialized
+ */
+void sxt_curve25519_scalar_batch_add(struct sxt_curve25519_scalar* res, uint64_t n,
+                                     const struct sxt_curve25519_scalar* lhs,
+                                     const struct sxt_curve25519_scalar* rhs);
+
+void sxt_curve25519_scalar_batch_sub(struct sxt_curve25519_scalar* res, uint64_t n,
+                                     const struct sxt_curve25519_scalar* lhs,
+                                     const struct sxt_curve25519_scalar* rhs);
+
+void sxt_curve25519_scalar_batch_mul(struct sxt_curve25519_scalar* res, uint64_t n,
+                                     const struct sxt_curve25519_scalar* lhs,
+                                     const struct sxt_curve25519_scalar* rhs);
+
+/**
+ * Multiply an array of curve25519 scalars by a scalar and add a second array
+ *
+ * Compute res[i] = a * x[i] + y[i] for i = 0, ..., n - 1.
+ *
+ * # Arguments:
+ *
+ * - res (out): an array of length n
+ *
+ * - n   (in): the number of scalars
+ * - a   (in): the multiplier
+ * - x   (in): an array of length n
+ * - y   (in): an array of length n
+ *
+ * # Abnormal program termination in case of:
+ *
+ * - a == nullptr
+ * - n > 0 && (res == nullptr || x == nullptr || y == nullptr)
+ *
+ * # Considerations:
+ *
+ * - res may alias x or y
+ * - the backend doesn't need to be initialized
+ */
+void sxt_curve25519_scalar_batch_muladd(struct sxt_curve25519_scalar* res, uint64_t n,
+                                        const struct sxt_curve25519_scalar* a,
+                                        const struct sxt_curve25519_scalar* x,
+                                        const struct sxt_curve25519_scalar* y);
+
+/**
+ * Compute the inner product of two arrays of curve25519 scalars
+ *
+ * ```text
+ *     res = lhs[0] * rhs[0] + ... + lhs[n - 1] * rhs[n - 1]
+ * ```
+ *
+ * # Arguments:
+ *
+ * - res (out): the inner product
+ *
+ * - n   (in): the number of scalars
+ * - lhs (in): an array of length n
+ * - rhs (in): an array of length n
+ *
+ * # Abnormal program termination in case of:
+ *
+ * - res == nullptr
+ * - n > 0 && (lhs == nullptr || rhs == nullptr)
+ * - n > UINT32_MAX
+ *
+ * # Considerations:
+ *
+ * - n equal to 0 will write zero into res
+ * - the backend doesn't need to be initialized
+ */
+void sxt_curve25519_scalar_inner_product(struct sxt_curve25519_scalar* res, uint64_t n,
+                                         const struct sxt_curve25519_scalar* lhs,
+                                         const struct sxt_curve25519_scalar* rhs);
+
+/**
+ * Fold two arrays of curve25519 scalars with a pair of scalars
+ *
+ * Compute, for i = 0, ..., n - 1,
+ *
+ * ```text
+ *     res[i] = m_low * low[i] + m_high * high[i]
+ * ```
+ *
+ * where high[i] is taken to be zero for i >= n_high. This is the scalar fold of an inner
+ * product proof round.
+ *
+ * # Arguments:
+ *
+ * - res    (out): an array of length n
+ *
+ * - n      (in): the number of scalars in low
+ * - m_low  (in): the multiplier of low
+ * - m_high (in): the multiplier of high
+ * - low    (in): an array of length n
+ * - n_high (in): the number of scalars in high
+ * - high   (in): an array of length n_high
+ *
+ * # Abnormal program termination in case of:
+ *
+ * - m_low == nullptr || m_high == nullptr
+ * - n_high > n
+ * - n > 0 && (res == nullptr || low == nullptr)
+ * - n_high > 0 && high == nullptr
+ *
+ * # Considerations:
+ *
+ * - res may alias low or high
+ * - the backend doesn't need to be initialized
+ */
+void sxt_curve25519_scalar_batch_fold(struct sxt_curve25519_scalar* res, uint64_t n,
+                                      const struct sxt_curve25519_scalar* m_low,
+                                      const struct sxt_curve25519_scalar* m_high,
+                                      const struct sxt_curve25519_scalar* low, uint64_t n_high,
+                                      const struct sxt_curve25519_scalar* high);
+
+/**
+ * Invert an array of curve25519 scalars
+ *
+ * Montgomery's trick is used so that each host thread computes a single field inversion and
+ * recovers the individual inverses with multiplications.
+ *
+ * # Arguments:
+ *
+ * - res (out): an array of length n where res[i] * x[i] = 1
+ *
+ * - n   (in): the number of scalars
+ * - x   (in): an array of length n
+ *
+ * # Abnormal program termination in case of:
+ *
+ * - n > 0 && (res == nullptr || x == nullptr)
+ *
+ * # Considerations:
+ *
+ * - zero has no inverse; x[i] == 0 writes zero into res[i]
+ * - res may alias x
+ * - the backend doesn't need to be initialized
+ */
+void sxt_curve25519_scalar_batch_inv(struct sxt_curve25519_scalar* res, uint64_t n,
+                                     const struct sxt_curve25519_scalar* x);
+
+/**
+ * Hash uniformly random bytes to ristretto255 points
+ *
+ * Each consecutive 64-byte block of uniform_bytes is mapped to a ristretto255 point with the
+ * hash-to-group function of RFC 9496 (section 4.3.4). The input is typically the output of a
+ * 64-byte hash such as SHA-512. The points are computed in parallel on the host.
+ *
+ * # Arguments:
+ *
+ * - res           (out): an array of length n of points
+ *
+ * - n             (in): the number of points
+ * - uniform_bytes (in): an array of length 64 * n of bytes
+ *
+ * # Abnormal program termination in case of:
+ *
+ * - n > 0 && (res == nullptr || uniform_bytes == nullptr)
+ *
+ * # Considerations:
+ *
+ * - the backend doesn't need to be initialized
+ */
+void sxt_ristretto255_batch_hash_to_group(struct sxt_ristretto255* res, uint64_t n,
+                                          const uint8_t* uniform_bytes);
 
 /**
  * Creates an inner product proof
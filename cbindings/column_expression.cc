@@ -0,0 +1,188 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "cbindings/column_expression.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "cbindings/backend.h"
+#include "sxt/base/error/assert.h"
+#include "sxt/base/iterator/index_range.h"
+#include "sxt/curve21/type/element_p3.h"
+#include "sxt/execution/thread/parallel_for.h"
+#include "sxt/memory/management/managed_array.h"
+#include "sxt/multiexp/base/column_expression.h"
+#include "sxt/multiexp/base/exponent_sequence.h"
+#include "sxt/multiexp/base/segmented_generators.h"
+#include "sxt/ristretto/operation/compression.h"
+#include "sxt/ristretto/type/compressed_element.h"
+#include "sxt/scalar25/type/element.h"
+
+using namespace sxt;
+
+namespace sxt::cbn {
+//--------------------------------------------------------------------------------------------------
+// column_expression_chunk_size_v
+//--------------------------------------------------------------------------------------------------
+/**
+ * The number of rows of derived columns a task evaluates at a time. At 32 bytes per scalar, the
+ * values of a node take 64 KiB.
+ */
+static constexpr size_t column_expression_chunk_size_v = 1u << 11u;
+
+//--------------------------------------------------------------------------------------------------
+// to_expression_nodes
+//--------------------------------------------------------------------------------------------------
+static basct::cspan<mtxb::column_expression_node>
+to_expression_nodes(const sxt_column_expression& expression) noexcept {
+  static_assert(sizeof(mtxb::column_expression_node) == sizeof(sxt_column_expression_node),
+                "types must be ABI compatible");
+  SXT_RELEASE_ASSERT(expression.num_nodes == 0 || expression.nodes != nullptr);
+  return {reinterpret_cast<const mtxb::column_expression_node*>(expression.nodes),
+          expression.num_nodes};
+}
+
+//--------------------------------------------------------------------------------------------------
+// populate_columns
+//--------------------------------------------------------------------------------------------------
+static void populate_columns(basct::span<mtxb::exponent_sequence> columns,
+                             basct::cspan<sxt_sequence_descriptor> descriptors) noexcept {
+  SXT_RELEASE_ASSERT(columns.empty() || descriptors.data() != nullptr);
+  for (size_t column_index = 0; column_index < columns.size(); ++column_index) {
+    auto& descriptor = descriptors[column_index];
+    SXT_RELEASE_ASSERT(descriptor.n == 0 || descriptor.data != nullptr);
+    SXT_RELEASE_ASSERT(descriptor.element_nbytes != 0 && descriptor.element_nbytes <= 32);
+    columns[column_index] = {
+        .element_nbytes = descriptor.element_nbytes,
+        .n = descriptor.n,
+        .data = descriptor.data,
+        .is_signed = descriptor.is_signed,
+    };
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// evaluate_column_expressions
+//--------------------------------------------------------------------------------------------------
+/**
+ * Evaluate rows first, ..., first + m - 1 of each expression into res, where the values of
+ * expression i start at res[i * m]. Rows past an expression's length are skipped. The rows are
+ * split across threads in cache-sized pieces.
+ */
+static void evaluate_column_expressions(
+    basct::span<s25t::element> res, size_t m,
+    basct::cspan<basct::cspan<mtxb::column_expression_node>> nodes,
+    basct::cspan<size_t> lengths, basct::cspan<mtxb::exponent_sequence> columns,
+    size_t first) noexcept {
+  if (m == 0) {
+    return;
+  }
+  size_t max_num_nodes = 0;
+  for (auto& expression_nodes : nodes) {
+    max_num_nodes = std::max(max_num_nodes, expression_nodes.size());
+  }
+  xent::parallel_for(
+      basit::index_range{0, m}
+          .min_chunk_size(column_expression_chunk_size_v)
+          .max_chunk_size(column_expression_chunk_size_v),
+      [&](basit::index_range rng) noexcept {
+        memmg::managed_array<s25t::element> scratch(max_num_nodes * rng.size());
+        for (size_t expression_index = 0; expression_index < nodes.size(); ++expression_index) {
+          auto& expression_nodes = nodes[expression_index];
+          auto row = first + rng.a();
+          auto length = lengths[expression_index];
+          if (row >= length) {
+            continue;
+          }
+          auto mp = std::min(rng.size(), length - row);
+          mtxb::evaluate_column_expression(
+              res.subspan(expression_index * m + rng.a(), mp),
+              {scratch.data(), expression_nodes.size() * mp}, expression_nodes, columns, row);
+        }
+      });
+}
+
+//--------------------------------------------------------------------------------------------------
+// process_compute_expression_commitments
+//--------------------------------------------------------------------------------------------------
+static void process_compute_expression_commitments(
+    basct::span<rstt::compressed_element> commitments,
+    basct::cspan<sxt_column_expression> expressions,
+    basct::cspan<sxt_sequence_descriptor> column_descriptors, uint64_t offset_generators) noexcept {
+  SXT_RELEASE_ASSERT(sxt::cbn::is_backend_initialized());
+  auto num_expressions = expressions.size();
+
+  memmg::managed_array<mtxb::exponent_sequence> columns(column_descriptors.size());
+  populate_columns(columns, column_descriptors);
+
+  std::vector<basct::cspan<mtxb::column_expression_node>> nodes(num_expressions);
+  std::vector<size_t> lengths(num_expressions);
+  size_t n = 0;
+  for (size_t expression_index = 0; expression_index < num_expressions; ++expression_index) {
+    auto& expression_nodes = nodes[expression_index];
+    expression_nodes = to_expression_nodes(expressions[expression_index]);
+    SXT_RELEASE_ASSERT(mtxb::is_valid_column_expression(expression_nodes, columns.size()),
+                       "invalid column expression");
+    lengths[expression_index] = mtxb::column_expression_length(expression_nodes, columns);
+    n = std::max(n, lengths[expression_index]);
+  }
+
+  // the expressions are evaluated a chunk of rows at a time as the multiexponentiation consumes
+  // them, so derived columns are never materialized in full
+  memmg::managed_array<s25t::element> scalars;
+  auto slice = [&](basct::span<mtxb::exponent_sequence> sequences, size_t first,
+                   size_t m) noexcept {
+    if (scalars.size() < num_expressions * m) {
+      scalars.resize(num_expressions * m);
+    }
+    evaluate_column_expressions(scalars, m, nodes, lengths, columns, first);
+    for (size_t expression_index = 0; expression_index < num_expressions; ++expression_index) {
+      auto length = lengths[expression_index];
+      sequences[expression_index] = {
+          .element_nbytes = 32,
+          .n = first < length ? std::min(m, length - first) : 0,
+          .data = reinterpret_cast<const uint8_t*>(scalars.data() + expression_index * m),
+          .is_signed = 0,
+      };
+    }
+  };
+  auto backend = cbn::get_backend();
+  memmg::managed_array<c21t::element_p3> values(num_expressions);
+  backend->compute_multiexponentiation(
+      values, n, slice, backend->get_precomputed_generator_segments(n, offset_generators));
+  rsto::batch_compress(commitments, values);
+}
+} // namespace sxt::cbn
+
+//--------------------------------------------------------------------------------------------------
+// sxt_curve25519_compute_pedersen_commitments_of_expressions
+//--------------------------------------------------------------------------------------------------
+void sxt_curve25519_compute_pedersen_commitments_of_expressions(
+    struct sxt_ristretto255_compressed* commitments, uint32_t num_expressions,
+    const struct sxt_column_expression* expressions, uint32_t num_columns,
+    const struct sxt_sequence_descriptor* columns, uint64_t offset_generators) {
+  if (num_expressions == 0) {
+    return;
+  }
+  SXT_RELEASE_ASSERT(commitments != nullptr);
+  SXT_RELEASE_ASSERT(expressions != nullptr);
+  static_assert(sizeof(rstt::compressed_element) == sizeof(sxt_ristretto255_compressed),
+                "types must be ABI compatible");
+  cbn::process_compute_expression_commitments(
+      {reinterpret_cast<rstt::compressed_element*>(commitments), num_expressions},
+      {expressions, num_expressions}, {columns, num_columns}, offset_generators);
+}
@@ -0,0 +1,140 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "cbindings/column_expression.h"
+
+#include <vector>
+
+#include "cbindings/backend.h"
+#include "cbindings/pedersen.h"
+#include "sxt/base/test/unit_test.h"
+#include "sxt/ristretto/type/compressed_element.h"
+#include "sxt/scalar25/operation/overload.h"
+#include "sxt/scalar25/type/element.h"
+#include "sxt/scalar25/type/literal.h"
+
+using namespace sxt;
+using s25t::operator""_s25;
+
+//--------------------------------------------------------------------------------------------------
+// make_column
+//--------------------------------------------------------------------------------------------------
+template <class T>
+static sxt_sequence_descriptor make_column(const std::vector<T>& data, bool is_signed = false) {
+  return {
+      .element_nbytes = sizeof(T),
+      .n = data.size(),
+      .data = reinterpret_cast<const uint8_t*>(data.data()),
+      .is_signed = is_signed,
+  };
+}
+
+//--------------------------------------------------------------------------------------------------
+// compute_commitment
+//--------------------------------------------------------------------------------------------------
+static rstt::compressed_element compute_commitment(const std::vector<s25t::element>& values,
+                                                   uint64_t offset_generators) {
+  rstt::compressed_element res;
+  auto column = make_column(values);
+  sxt_curve25519_compute_pedersen_commitments(
+      reinterpret_cast<sxt_ristretto255_compressed*>(&res), 1, &column, offset_generators);
+  return res;
+}
+
+//--------------------------------------------------------------------------------------------------
+// compute_expression_commitment
+//--------------------------------------------------------------------------------------------------
+static rstt::compressed_element
+compute_expression_commitment(const std::vector<sxt_column_expression_node>& nodes,
+                              const std::vector<sxt_sequence_descriptor>& columns,
+                              uint64_t offset_generators) {
+  rstt::compressed_element res;
+  sxt_column_expression expression{static_cast<uint32_t>(nodes.size()), nodes.data()};
+  sxt_curve25519_compute_pedersen_commitments_of_expressions(
+      reinterpret_cast<sxt_ristretto255_compressed*>(&res), 1, &expression,
+      static_cast<uint32_t>(columns.size()), columns.data(), offset_generators);
+  return res;
+}
+
+TEST_CASE("we can commit to derived columns without materializing them") {
+  const sxt_config config = {SXT_CPU_BACKEND, 0};
+  REQUIRE(sxt_init(&config) == 0);
+
+  std::vector<uint8_t> a = {1, 2, 3, 4};
+  std::vector<int16_t> b = {-5, 6, -7};
+  std::vector<sxt_sequence_descriptor> columns = {make_column(a), make_column(b, true)};
+  std::vector<sxt_column_expression_node> nodes = {
+      {.op = SXT_COLUMN_EXPRESSION_COLUMN, .lhs = 0},
+      {.op = SXT_COLUMN_EXPRESSION_COLUMN, .lhs = 1},
+  };
+
+  SECTION("we can commit to a product of columns") {
+    nodes.push_back({.op = SXT_COLUMN_EXPRESSION_MUL, .lhs = 0, .rhs = 1});
+    std::vector<s25t::element> expected = {-0x5_s25, 0xc_s25, -0x15_s25, 0x0_s25};
+    REQUIRE(compute_expression_commitment(nodes, columns, 3) == compute_commitment(expected, 3));
+  }
+
+  SECTION("we can commit to a difference of a scaled column") {
+    sxt_column_expression_node scale{.op = SXT_COLUMN_EXPRESSION_SCALE, .lhs = 0};
+    auto constant = 0x2_s25;
+    std::copy_n(constant.data(), 32, scale.constant.bytes);
+    nodes.push_back(scale);
+    nodes.push_back({.op = SXT_COLUMN_EXPRESSION_SUB, .lhs = 2, .rhs = 1});
+    std::vector<s25t::element> expected = {0x7_s25, -0x2_s25, 0xd_s25, 0x8_s25};
+    REQUIRE(compute_expression_commitment(nodes, columns, 0) == compute_commitment(expected, 0));
+  }
+
+  SECTION("we can commit to a filtered column") {
+    uint8_t bitmap = 0b1001;
+    nodes.push_back({.op = SXT_COLUMN_EXPRESSION_SELECT, .lhs = 0, .bitmap = &bitmap});
+    std::vector<s25t::element> expected = {0x1_s25, 0x0_s25, 0x0_s25, 0x4_s25};
+    REQUIRE(compute_expression_commitment(nodes, columns, 0) == compute_commitment(expected, 0));
+  }
+
+  SECTION("we can commit to several expressions of different lengths") {
+    std::vector<sxt_column_expression_node> a_nodes = {nodes[0]};
+    std::vector<sxt_column_expression_node> b_nodes = {nodes[1]};
+    sxt_column_expression expressions[] = {
+        {static_cast<uint32_t>(a_nodes.size()), a_nodes.data()},
+        {static_cast<uint32_t>(b_nodes.size()), b_nodes.data()},
+    };
+    rstt::compressed_element commitments[2];
+    sxt_curve25519_compute_pedersen_commitments_of_expressions(
+        reinterpret_cast<sxt_ristretto255_compressed*>(commitments), 2, expressions,
+        static_cast<uint32_t>(columns.size()), columns.data(), 2);
+    std::vector<s25t::element> expected_a = {0x1_s25, 0x2_s25, 0x3_s25, 0x4_s25};
+    std::vector<s25t::element> expected_b = {-0x5_s25, 0x6_s25, -0x7_s25};
+    REQUIRE(commitments[0] == compute_commitment(expected_a, 2));
+    REQUIRE(commitments[1] == compute_commitment(expected_b, 2));
+  }
+
+  SECTION("we can commit to expressions spanning several chunks") {
+    std::vector<uint8_t> c(70'000);
+    std::vector<s25t::element> expected(c.size());
+    for (size_t i = 0; i < c.size(); ++i) {
+      c[i] = static_cast<uint8_t>(i);
+      expected[i] = s25t::element{static_cast<uint8_t>(i)} * s25t::element{static_cast<uint8_t>(i)};
+    }
+    columns = {make_column(c)};
+    nodes = {
+        {.op = SXT_COLUMN_EXPRESSION_COLUMN, .lhs = 0},
+        {.op = SXT_COLUMN_EXPRESSION_MUL, .lhs = 0, .rhs = 0},
+    };
+    REQUIRE(compute_expression_commitment(nodes, columns, 1) == compute_commitment(expected, 1));
+  }
+
+  cbn::reset_backend_for_testing();
+}
@@ -0,0 +1,114 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "cbindings/combination.h"
+
+#include "cbindings/backend.h"
+#include "sxt/base/error/assert.h"
+#include "sxt/curve21/type/element_p3.h"
+#include "sxt/curve_g1/operation/compression.h"
+#include "sxt/curve_g1/type/compressed_element.h"
+#include "sxt/curve_g1/type/element_p2.h"
+#include "sxt/memory/management/managed_array.h"
+#include "sxt/multiexp/base/exponent_sequence.h"
+#include "sxt/ristretto/operation/compression.h"
+#include "sxt/ristretto/type/compressed_element.h"
+
+using namespace sxt;
+
+namespace sxt::cbn {
+//--------------------------------------------------------------------------------------------------
+// make_scalar_sequence
+//--------------------------------------------------------------------------------------------------
+static mtxb::exponent_sequence make_scalar_sequence(uint64_t n, const uint8_t* scalars) noexcept {
+  return {
+      .element_nbytes = 32,
+      .n = n,
+      .data = scalars,
+      .is_signed = 0,
+  };
+}
+
+//--------------------------------------------------------------------------------------------------
+// process_combine_commitments
+//--------------------------------------------------------------------------------------------------
+static int process_combine_commitments(rstt::compressed_element& res,
+                                       basct::cspan<rstt::compressed_element> commitments,
+                                       const uint8_t* scalars) noexcept {
+  SXT_RELEASE_ASSERT(sxt::cbn::is_backend_initialized());
+  SXT_RELEASE_ASSERT(commitments.empty() || (commitments.data() != nullptr && scalars != nullptr));
+
+  memmg::managed_array<c21t::element_p3> generators(commitments.size());
+  if (rsto::batch_decompress(generators, commitments) != 0) {
+    return 1;
+  }
+
+  auto sequence = make_scalar_sequence(commitments.size(), scalars);
+  cbn::get_backend()->compute_commitments({&res, 1}, {&sequence, 1}, generators);
+  return 0;
+}
+
+//--------------------------------------------------------------------------------------------------
+// process_combine_commitments
+//--------------------------------------------------------------------------------------------------
+static int process_combine_commitments(cg1t::compressed_element& res,
+                                       basct::cspan<cg1t::compressed_element> commitments,
+                                       const uint8_t* scalars) noexcept {
+  SXT_RELEASE_ASSERT(sxt::cbn::is_backend_initialized());
+  SXT_RELEASE_ASSERT(commitments.empty() || (commitments.data() != nullptr && scalars != nullptr));
+
+  memmg::managed_array<cg1t::element_p2> generators(commitments.size());
+  if (cg1o::batch_decompress(generators, commitments) != 0) {
+    return 1;
+  }
+
+  auto sequence = make_scalar_sequence(commitments.size(), scalars);
+  cbn::get_backend()->compute_commitments({&res, 1}, {&sequence, 1}, generators);
+  return 0;
+}
+} // namespace sxt::cbn
+
+//--------------------------------------------------------------------------------------------------
+// sxt_curve25519_combine_commitments
+//--------------------------------------------------------------------------------------------------
+int sxt_curve25519_combine_commitments(struct sxt_ristretto255_compressed* res, uint64_t n,
+                                       const struct sxt_ristretto255_compressed* commitments,
+                                       const struct sxt_curve25519_scalar* scalars) {
+  SXT_RELEASE_ASSERT(res != nullptr);
+  static_assert(sizeof(rstt::compressed_element) == sizeof(sxt_ristretto255_compressed),
+                "types must be ABI compatible");
+  return cbn::process_combine_commitments(
+      *reinterpret_cast<rstt::compressed_element*>(res),
+      basct::cspan<rstt::compressed_element>{
+          reinterpret_cast<const rstt::compressed_element*>(commitments), n},
+      reinterpret_cast<const uint8_t*>(scalars));
+}
+
+//--------------------------------------------------------------------------------------------------
+// sxt_bls12_381_g1_combine_commitments
+//--------------------------------------------------------------------------------------------------
+int sxt_bls12_381_g1_combine_commitments(struct sxt_bls12_381_g1_compressed* res, uint64_t n,
+                                         const struct sxt_bls12_381_g1_compressed* commitments,
+                                         const uint8_t* scalars) {
+  SXT_RELEASE_ASSERT(res != nullptr);
+  static_assert(sizeof(cg1t::compressed_element) == sizeof(sxt_bls12_381_g1_compressed),
+                "types must be ABI compatible");
+  return cbn::process_combine_commitments(
+      *reinterpret_cast<cg1t::compressed_element*>(res),
+      basct::cspan<cg1t::compressed_element>{
+          reinterpret_cast<const cg1t::compressed_element*>(commitments), n},
+      scalars);
+}
@@ -0,0 +1,172 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "cbindings/combination.h"
+
+#include <array>
+#include <vector>
+
+#include "cbindings/backend.h"
+#include "sxt/base/test/unit_test.h"
+#include "sxt/curve21/type/element_p3.h"
+#include "sxt/curve_g1/constant/generator.h"
+#include "sxt/curve_g1/operation/add.h"
+#include "sxt/curve_g1/operation/compression.h"
+#include "sxt/curve_g1/operation/double.h"
+#include "sxt/curve_g1/operation/scalar_multiply.h"
+#include "sxt/curve_g1/type/compressed_element.h"
+#include "sxt/curve_g1/type/element_p2.h"
+#include "sxt/ristretto/base/byte_conversion.h"
+#include "sxt/ristretto/operation/add.h"
+#include "sxt/ristretto/operation/scalar_multiply.h"
+#include "sxt/ristretto/type/compressed_element.h"
+#include "sxt/seqcommit/generator/base_element.h"
+
+using namespace sxt;
+
+//--------------------------------------------------------------------------------------------------
+// initialize_backend
+//--------------------------------------------------------------------------------------------------
+static void initialize_backend(int backend) {
+  const sxt_config config = {backend, 0};
+  REQUIRE(sxt_init(&config) == 0);
+}
+
+//--------------------------------------------------------------------------------------------------
+// make_scalars
+//--------------------------------------------------------------------------------------------------
+static std::vector<std::array<uint8_t, 32>> make_scalars(size_t n) {
+  std::vector<std::array<uint8_t, 32>> res(n);
+  for (size_t i = 0; i < n; ++i) {
+    for (size_t j = 0; j < 31; ++j) {
+      res[i][j] = static_cast<uint8_t>(37 * i + 11 * j + 1);
+    }
+    res[i][31] = 0;
+  }
+  return res;
+}
+
+//--------------------------------------------------------------------------------------------------
+// test_ristretto255_combination
+//--------------------------------------------------------------------------------------------------
+static void test_ristretto255_combination(int backend) {
+  initialize_backend(backend);
+
+  std::vector<rstt::compressed_element> commitments(3);
+  for (size_t i = 0; i < commitments.size(); ++i) {
+    c21t::element_p3 g;
+    sqcgn::compute_base_element(g, i);
+    rstb::to_bytes(commitments[i].data(), g);
+  }
+  auto scalars = make_scalars(commitments.size());
+  rstt::compressed_element res;
+
+  SECTION("we get the identity if there are no commitments") {
+    res = rstt::compressed_element{1u};
+    REQUIRE(sxt_curve25519_combine_commitments(
+                reinterpret_cast<sxt_ristretto255_compressed*>(&res), 0, nullptr, nullptr) == 0);
+    REQUIRE(res == rstt::compressed_element{});
+  }
+
+  SECTION("we can combine commitments") {
+    REQUIRE(sxt_curve25519_combine_commitments(
+                reinterpret_cast<sxt_ristretto255_compressed*>(&res), commitments.size(),
+                reinterpret_cast<const sxt_ristretto255_compressed*>(commitments.data()),
+                reinterpret_cast<const sxt_curve25519_scalar*>(scalars.data())) == 0);
+    rstt::compressed_element expected;
+    rstb::to_bytes(expected.data(), c21t::element_p3::identity());
+    for (size_t i = 0; i < commitments.size(); ++i) {
+      rstt::compressed_element term;
+      rsto::scalar_multiply(term, scalars[i], commitments[i]);
+      rsto::add(expected, expected, term);
+    }
+    REQUIRE(res == expected);
+  }
+
+  SECTION("we fail if a commitment is invalid") {
+    commitments[1].data()[31] = 0xff;
+    REQUIRE(sxt_curve25519_combine_commitments(
+                reinterpret_cast<sxt_ristretto255_compressed*>(&res), commitments.size(),
+                reinterpret_cast<const sxt_ristretto255_compressed*>(commitments.data()),
+                reinterpret_cast<const sxt_curve25519_scalar*>(scalars.data())) != 0);
+  }
+
+  cbn::reset_backend_for_testing();
+}
+
+//--------------------------------------------------------------------------------------------------
+// test_bls12_381_g1_combination
+//--------------------------------------------------------------------------------------------------
+static void test_bls12_381_g1_combination(int backend) {
+  initialize_backend(backend);
+
+  std::vector<cg1t::element_p2> points = {cg1cn::generator_p2_v, cg1cn::generator_p2_v};
+  cg1o::double_element(points[1], points[1]);
+  std::vector<cg1t::compressed_element> commitments(points.size());
+  cg1o::batch_compress(commitments, points);
+  auto scalars = make_scalars(commitments.size());
+  cg1t::compressed_element res;
+
+  SECTION("we get the identity if there are no commitments") {
+    REQUIRE(sxt_bls12_381_g1_combine_commitments(
+                reinterpret_cast<sxt_bls12_381_g1_compressed*>(&res), 0, nullptr, nullptr) == 0);
+    cg1t::compressed_element expected;
+    cg1o::compress(expected, cg1t::element_p2::identity());
+    REQUIRE(res == expected);
+  }
+
+  SECTION("we can combine commitments") {
+    REQUIRE(sxt_bls12_381_g1_combine_commitments(
+                reinterpret_cast<sxt_bls12_381_g1_compressed*>(&res), commitments.size(),
+                reinterpret_cast<const sxt_bls12_381_g1_compressed*>(commitments.data()),
+                reinterpret_cast<const uint8_t*>(scalars.data())) == 0);
+    cg1t::element_p2 expected = cg1t::element_p2::identity();
+    for (size_t i = 0; i < points.size(); ++i) {
+      cg1t::element_p2 term;
+      cg1o::scalar_multiply255(term, points[i], scalars[i].data());
+      cg1o::add(expected, expected, term);
+    }
+    cg1t::compressed_element expected_compressed;
+    cg1o::compress(expected_compressed, expected);
+    REQUIRE(res == expected_compressed);
+  }
+
+  SECTION("we fail if a commitment is invalid") {
+    commitments[0].data()[0] = 0;
+    REQUIRE(sxt_bls12_381_g1_combine_commitments(
+                reinterpret_cast<sxt_bls12_381_g1_compressed*>(&res), commitments.size(),
+                reinterpret_cast<const sxt_bls12_381_g1_compressed*>(commitments.data()),
+                reinterpret_cast<const uint8_t*>(scalars.data())) != 0);
+  }
+
+  cbn::reset_backend_for_testing();
+}
+
+TEST_CASE("we can combine ristretto255 commitments using the gpu backend") {
+  test_ristretto255_combination(SXT_GPU_BACKEND);
+}
+
+TEST_CASE("we can combine ristretto255 commitments using the cpu backend") {
+  test_ristretto255_combination(SXT_CPU_BACKEND);
+}
+
+TEST_CASE("we can combine bls12-381 G1 commitments using the gpu backend") {
+  test_bls12_381_g1_combination(SXT_GPU_BACKEND);
+}
+
+TEST_CASE("we can combine bls12-381 G1 commitments using the cpu backend") {
+  test_bls12_381_g1_combination(SXT_CPU_BACKEND);
+}
@@ -0,0 +1,138 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "cbindings/commitment_coalescer.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace sxt::cbn {
+//--------------------------------------------------------------------------------------------------
+// constructor
+//--------------------------------------------------------------------------------------------------
+commitment_coalescer::commitment_coalescer(processor f) noexcept : f_{std::move(f)} {}
+
+//--------------------------------------------------------------------------------------------------
+// compute
+//--------------------------------------------------------------------------------------------------
+void commitment_coalescer::compute(sxt_ristretto255_compressed* commitments,
+                                   basct::cspan<sxt_sequence_descriptor> descriptors,
+                                   uint64_t offset_generators,
+                                   std::chrono::microseconds window) noexcept {
+  request req{
+      .commitments = commitments,
+      .descriptors = descriptors,
+      .offset_generators = offset_generators,
+  };
+  std::unique_lock<std::mutex> lock{mutex_};
+  pending_.push_back(&req);
+  done_.wait(lock, [&]() noexcept { return req.done || !has_leader_; });
+  if (req.done) {
+    return;
+  }
+
+  // lead the batch; the flag stays set until the batch is computed so batches never overlap
+  has_leader_ = true;
+  lock.unlock();
+  std::this_thread::sleep_for(window);
+  lock.lock();
+  std::vector<request*> batch;
+  batch.swap(pending_);
+  lock.unlock();
+
+  process(batch);
+
+  lock.lock();
+  for (auto r : batch) {
+    r->done = true;
+  }
+  has_leader_ = false;
+  lock.unlock();
+  done_.notify_all();
+}
+
+//--------------------------------------------------------------------------------------------------
+// generators_end
+//--------------------------------------------------------------------------------------------------
+/**
+ * One past the last generator used by a request's sequences.
+ */
+static uint64_t generators_end(uint64_t offset_generators,
+                               basct::cspan<sxt_sequence_descriptor> descriptors) noexcept {
+  uint64_t n = 0;
+  for (auto& descriptor : descriptors) {
+    n = std::max(n, descriptor.n);
+  }
+  return offset_generators + n;
+}
+
+//--------------------------------------------------------------------------------------------------
+// process
+//--------------------------------------------------------------------------------------------------
+void commitment_coalescer::process(basct::span<request*> batch) noexcept {
+  // sort by offset so that requests with overlapping or adjacent generator ranges are neighbors
+  std::sort(batch.begin(), batch.end(), [](const request* lhs, const request* rhs) noexcept {
+    return lhs->offset_generators < rhs->offset_generators;
+  });
+  size_t first = 0;
+  while (first < batch.size()) {
+    auto end = generators_end(batch[first]->offset_generators, batch[first]->descriptors);
+    auto last = first + 1;
+    for (; last < batch.size() && batch[last]->offset_generators <= end; ++last) {
+      end = std::max(end, generators_end(batch[last]->offset_generators, batch[last]->descriptors));
+    }
+    process_group(batch.subspan(first, last - first));
+    first = last;
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// process_group
+//--------------------------------------------------------------------------------------------------
+void commitment_coalescer::process_group(basct::span<request*> group) noexcept {
+  if (group.size() == 1) {
+    auto& req = *group[0];
+    std::vector<uint64_t> offsets(req.descriptors.size(), req.offset_generators);
+    f_(req.commitments, req.descriptors, offsets.data());
+    return;
+  }
+
+  // merge
+  size_t num_sequences = 0;
+  for (auto r : group) {
+    num_sequences += r->descriptors.size();
+  }
+  std::vector<sxt_sequence_descriptor> descriptors;
+  std::vector<uint64_t> offsets;
+  descriptors.reserve(num_sequences);
+  offsets.reserve(num_sequences);
+  for (auto r : group) {
+    descriptors.insert(descriptors.end(), r->descriptors.begin(), r->descriptors.end());
+    offsets.insert(offsets.end(), r->descriptors.size(), r->offset_generators);
+  }
+
+  // compute
+  std::vector<sxt_ristretto255_compressed> commitments(num_sequences);
+  f_(commitments.data(), descriptors, offsets.data());
+
+  // scatter
+  size_t index = 0;
+  for (auto r : group) {
+    std::copy_n(commitments.begin() + index, r->descriptors.size(), r->commitments);
+    index += r->descriptors.size();
+  }
+}
+} // namespace sxt::cbn
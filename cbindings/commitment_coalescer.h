@@ -0,0 +1,77 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include "cbindings/blitzar_api.h"
+#include "sxt/base/container/span.h"
+
+namespace sxt::cbn {
+//--------------------------------------------------------------------------------------------------
+// commitment_coalescer
+//--------------------------------------------------------------------------------------------------
+/**
+ * Merge commitment requests that arrive from different threads within a short window into a
+ * single batched computation.
+ *
+ * The first caller to arrive becomes the leader: it waits for the window, takes every request
+ * that's pending, computes them, and scatters the results back. Requests are only merged when
+ * their generator ranges overlap or are adjacent, so merging never pads a sequence to generators
+ * that no caller asked for; each group of such requests is computed with one call to the
+ * processor.
+ *
+ * Batches don't overlap. Callers that arrive while a batch is being computed wait for it to
+ * finish, and one of them then leads the next batch. Each caller returns once its own
+ * commitments are written.
+ */
+class commitment_coalescer {
+public:
+  using processor = std::function<void(sxt_ristretto255_compressed* commitments,
+                                       basct::cspan<sxt_sequence_descriptor> descriptors,
+                                       const uint64_t* offsets_generators)>;
+
+  explicit commitment_coalescer(processor f) noexcept;
+
+  void compute(sxt_ristretto255_compressed* commitments,
+               basct::cspan<sxt_sequence_descriptor> descriptors, uint64_t offset_generators,
+               std::chrono::microseconds window) noexcept;
+
+private:
+  struct request {
+    sxt_ristretto255_compressed* commitments;
+    basct::cspan<sxt_sequence_descriptor> descriptors;
+    uint64_t offset_generators;
+    bool done = false;
+  };
+
+  processor f_;
+  std::mutex mutex_;
+  std::condition_variable done_;
+  std::vector<request*> pending_;
+  bool has_leader_ = false;
+
+  void process(basct::span<request*> batch) noexcept;
+
+  void process_group(basct::span<request*> group) noexcept;
+};
+} // namespace sxt::cbn
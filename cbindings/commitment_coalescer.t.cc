@@ -0,0 +1,117 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "cbindings/commitment_coalescer.h"
+
+#include <atomic>
+#include <latch>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "sxt/base/test/unit_test.h"
+
+using namespace sxt;
+using namespace sxt::cbn;
+
+TEST_CASE("we can coalesce commitment requests") {
+  // a fake commitment that records each sequence's length and generator offset
+  std::atomic<int> num_calls = 0;
+  commitment_coalescer coalescer{
+      [&](sxt_ristretto255_compressed* commitments,
+          basct::cspan<sxt_sequence_descriptor> descriptors,
+          const uint64_t* offsets_generators) noexcept {
+        ++num_calls;
+        for (size_t i = 0; i < descriptors.size(); ++i) {
+          commitments[i].ristretto_bytes[0] = static_cast<uint8_t>(descriptors[i].n);
+          commitments[i].ristretto_bytes[1] = static_cast<uint8_t>(offsets_generators[i]);
+        }
+      }};
+
+  SECTION("we can compute a single request") {
+    sxt_sequence_descriptor descriptors[2] = {{.n = 3}, {.n = 4}};
+    sxt_ristretto255_compressed commitments[2];
+    coalescer.compute(commitments, descriptors, 7, std::chrono::microseconds{0});
+    REQUIRE(num_calls == 1);
+    REQUIRE(commitments[0].ristretto_bytes[0] == 3);
+    REQUIRE(commitments[0].ristretto_bytes[1] == 7);
+    REQUIRE(commitments[1].ristretto_bytes[0] == 4);
+    REQUIRE(commitments[1].ristretto_bytes[1] == 7);
+  }
+
+  SECTION("we can compute requests from many threads") {
+    constexpr int num_threads = 16;
+    std::vector<sxt_sequence_descriptor> descriptors(num_threads);
+    std::vector<sxt_ristretto255_compressed> commitments(num_threads);
+    std::vector<std::thread> threads;
+    std::latch start{num_threads};
+    for (int i = 0; i < num_threads; ++i) {
+      descriptors[i].n = static_cast<uint64_t>(i);
+      threads.emplace_back([&, i]() noexcept {
+        start.arrive_and_wait();
+        coalescer.compute(&commitments[i], {&descriptors[i], 1}, 5,
+                          std::chrono::microseconds{200'000});
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    REQUIRE(num_calls < num_threads);
+    for (int i = 0; i < num_threads; ++i) {
+      REQUIRE(commitments[i].ristretto_bytes[0] == i);
+      REQUIRE(commitments[i].ristretto_bytes[1] == 5);
+    }
+  }
+}
+
+TEST_CASE("we only coalesce requests with overlapping or adjacent generator ranges") {
+  std::mutex mutex;
+  std::vector<std::vector<uint64_t>> calls;
+  commitment_coalescer coalescer{
+      [&](sxt_ristretto255_compressed* commitments,
+          basct::cspan<sxt_sequence_descriptor> descriptors,
+          const uint64_t* offsets_generators) noexcept {
+        std::lock_guard<std::mutex> lock{mutex};
+        calls.emplace_back(offsets_generators, offsets_generators + descriptors.size());
+        for (size_t i = 0; i < descriptors.size(); ++i) {
+          commitments[i].ristretto_bytes[0] = static_cast<uint8_t>(descriptors[i].n);
+        }
+      }};
+
+  // [0, 3) and [3, 5) are adjacent; [1'000'000, 1'000'004) is disjoint from both
+  constexpr int num_threads = 3;
+  sxt_sequence_descriptor descriptors[num_threads] = {{.n = 3}, {.n = 2}, {.n = 4}};
+  uint64_t offsets[num_threads] = {0, 3, 1'000'000};
+  sxt_ristretto255_compressed commitments[num_threads];
+  std::vector<std::thread> threads;
+  std::latch start{num_threads};
+  for (int i = 0; i < num_threads; ++i) {
+    threads.emplace_back([&, i]() noexcept {
+      start.arrive_and_wait();
+      coalescer.compute(&commitments[i], {&descriptors[i], 1}, offsets[i],
+                        std::chrono::microseconds{200'000});
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  REQUIRE(calls.size() == 2);
+  REQUIRE(calls[0] == std::vector<uint64_t>{0, 3});
+  REQUIRE(calls[1] == std::vector<uint64_t>{1'000'000});
+  for (int i = 0; i < num_threads; ++i) {
+    REQUIRE(commitments[i].ristretto_bytes[0] == descriptors[i].n);
+  }
+}
@@ -0,0 +1,106 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "cbindings/compression.h"
+
+#include <algorithm>
+
+#include "sxt/base/container/span.h"
+#include "sxt/base/error/assert.h"
+#include "sxt/curve21/type/element_p3.h"
+#include "sxt/curve_g1/operation/compression.h"
+#include "sxt/curve_g1/type/compressed_element.h"
+#include "sxt/curve_g1/type/element_affine.h"
+#include "sxt/curve_g1/type/element_p2.h"
+#include "sxt/memory/management/managed_array.h"
+#include "sxt/ristretto/operation/compression.h"
+#include "sxt/ristretto/type/compressed_element.h"
+
+using namespace sxt;
+
+//--------------------------------------------------------------------------------------------------
+// sxt_bls12_381_g1_batch_decompress
+//--------------------------------------------------------------------------------------------------
+int sxt_bls12_381_g1_batch_decompress(struct sxt_bls12_381_g1* res, uint64_t n,
+                                      const struct sxt_bls12_381_g1_compressed* points) {
+  SXT_RELEASE_ASSERT(n == 0 || (res != nullptr && points != nullptr));
+  static_assert(sizeof(cg1t::compressed_element) == sizeof(sxt_bls12_381_g1_compressed),
+                "types must be ABI compatible");
+  memmg::managed_array<cg1t::element_affine> elements(n);
+  if (cg1o::batch_decompress(elements, basct::cspan<cg1t::compressed_element>{
+                                           reinterpret_cast<const cg1t::compressed_element*>(points),
+                                           n}) != 0) {
+    return 1;
+  }
+  for (uint64_t i = 0; i < n; ++i) {
+    auto& e = elements[i];
+    if (e.infinity) {
+      return 1;
+    }
+    std::copy_n(e.X.data(), 6, res[i].X);
+    std::copy_n(e.Y.data(), 6, res[i].Y);
+  }
+  return 0;
+}
+
+//--------------------------------------------------------------------------------------------------
+// sxt_bls12_381_g1_batch_compress
+//--------------------------------------------------------------------------------------------------
+void sxt_bls12_381_g1_batch_compress(struct sxt_bls12_381_g1_compressed* res, uint64_t n,
+                                     const struct sxt_bls12_381_g1_p2* points) {
+  SXT_RELEASE_ASSERT(n == 0 || (res != nullptr && points != nullptr));
+  static_assert(sizeof(cg1t::compressed_element) == sizeof(sxt_bls12_381_g1_compressed),
+                "types must be ABI compatible");
+  static_assert(sizeof(cg1t::element_p2) == sizeof(sxt_bls12_381_g1_p2),
+                "types must be ABI compatible");
+  cg1o::batch_compress(
+      basct::span<cg1t::compressed_element>{reinterpret_cast<cg1t::compressed_element*>(res), n},
+      basct::cspan<cg1t::element_p2>{reinterpret_cast<const cg1t::element_p2*>(points), n});
+}
+
+//--------------------------------------------------------------------------------------------------
+// sxt_ristretto255_batch_compress
+//--------------------------------------------------------------------------------------------------
+void sxt_ristretto255_batch_compress(struct sxt_ristretto255_compressed* res, uint64_t n,
+                                     const struct sxt_ristretto255* points) {
+  SXT_RELEASE_ASSERT(n == 0 || (res != nullptr && points != nullptr));
+  static_assert(sizeof(rstt::compressed_element) == sizeof(sxt_ristretto255_compressed),
+                "types must be ABI compatible");
+  static_assert(sizeof(c21t::element_p3) == sizeof(sxt_ristretto255),
+                "types must be ABI compatible");
+  rsto::batch_compress(
+      basct::span<rstt::compressed_element>{reinterpret_cast<rstt::compressed_element*>(res), n},
+      basct::cspan<c21t::element_p3>{reinterpret_cast<const c21t::element_p3*>(points), n});
+}
+
+//--------------------------------------------------------------------------------------------------
+// sxt_ristretto255_batch_decompress
+//--------------------------------------------------------------------------------------------------
+int sxt_ristretto255_batch_decompress(struct sxt_ristretto255* res, uint64_t n,
+                                      const struct sxt_ristretto255_compressed* points) {
+  SXT_RELEASE_ASSERT(n == 0 || (res != nullptr && points != nullptr));
+  static_assert(sizeof(rstt::compressed_element) == sizeof(sxt_ristretto255_compressed),
+                "types must be ABI compatible");
+  static_assert(sizeof(c21t::element_p3) == sizeof(sxt_ristretto255),
+                "types must be ABI compatible");
+  if (rsto::batch_decompress(
+          basct::span<c21t::element_p3>{reinterpret_cast<c21t::element_p3*>(res), n},
+          basct::cspan<rstt::compressed_element>{
+              reinterpret_cast<const rstt::compressed_element*>(points), n}) != 0) {
+    return 1;
+  }
+  return 0;
+}
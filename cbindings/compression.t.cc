@@ -0,0 +1,139 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "cbindings/compression.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "sxt/base/test/unit_test.h"
+#include "sxt/curve21/type/element_p3.h"
+#include "sxt/curve_g1/constant/generator.h"
+#include "sxt/curve_g1/operation/add.h"
+#include "sxt/curve_g1/operation/compression.h"
+#include "sxt/curve_g1/type/compressed_element.h"
+#include "sxt/curve_g1/type/conversion_utility.h"
+#include "sxt/curve_g1/type/element_affine.h"
+#include "sxt/curve_g1/type/element_p2.h"
+#include "sxt/ristretto/operation/compression.h"
+#include "sxt/ristretto/random/element.h"
+#include "sxt/ristretto/type/compressed_element.h"
+
+using namespace sxt;
+
+TEST_CASE("we can batch decompress bls12-381 G1 elements") {
+  std::vector<cg1t::element_p2> elements(3);
+  elements[0] = cg1cn::generator_p2_v;
+  for (size_t i = 1; i < elements.size(); ++i) {
+    cg1o::add(elements[i], elements[i - 1], cg1cn::generator_p2_v);
+  }
+  std::vector<cg1t::compressed_element> compressed(elements.size());
+  cg1o::batch_compress(compressed, elements);
+  std::vector<sxt_bls12_381_g1> res(elements.size());
+
+  SECTION("we handle an empty batch") {
+    REQUIRE(sxt_bls12_381_g1_batch_decompress(nullptr, 0, nullptr) == 0);
+  }
+
+  SECTION("we can decompress valid elements to affine coordinates") {
+    REQUIRE(sxt_bls12_381_g1_batch_decompress(
+                res.data(), res.size(),
+                reinterpret_cast<const sxt_bls12_381_g1_compressed*>(compressed.data())) == 0);
+    for (size_t i = 0; i < elements.size(); ++i) {
+      cg1t::element_affine expected;
+      cg1t::to_element_affine(expected, elements[i]);
+      REQUIRE(std::equal(expected.X.data(), expected.X.data() + 6, res[i].X));
+      REQUIRE(std::equal(expected.Y.data(), expected.Y.data() + 6, res[i].Y));
+    }
+  }
+
+  SECTION("we return an error for an invalid element") {
+    compressed[1].data()[0] = 0;
+    REQUIRE(sxt_bls12_381_g1_batch_decompress(
+                res.data(), res.size(),
+                reinterpret_cast<const sxt_bls12_381_g1_compressed*>(compressed.data())) != 0);
+  }
+
+  SECTION("we return an error for the identity") {
+    cg1o::compress(compressed[1], cg1t::element_p2::identity());
+    REQUIRE(sxt_bls12_381_g1_batch_decompress(
+                res.data(), res.size(),
+                reinterpret_cast<const sxt_bls12_381_g1_compressed*>(compressed.data())) != 0);
+  }
+}
+
+TEST_CASE("we can batch compress bls12-381 G1 elements") {
+  std::vector<cg1t::element_p2> elements(3);
+  elements[0] = cg1cn::generator_p2_v;
+  cg1o::add(elements[1], elements[0], cg1cn::generator_p2_v);
+  elements[2] = cg1t::element_p2::identity();
+  std::vector<sxt_bls12_381_g1_compressed> res(elements.size());
+
+  SECTION("we handle an empty batch") { sxt_bls12_381_g1_batch_compress(nullptr, 0, nullptr); }
+
+  SECTION("we match compressing each element") {
+    sxt_bls12_381_g1_batch_compress(res.data(), res.size(),
+                                    reinterpret_cast<const sxt_bls12_381_g1_p2*>(elements.data()));
+    for (size_t i = 0; i < elements.size(); ++i) {
+      cg1t::compressed_element expected;
+      cg1o::compress(expected, elements[i]);
+      REQUIRE(std::equal(expected.data(), expected.data() + 48, res[i].g1_bytes));
+    }
+  }
+}
+
+TEST_CASE("we can batch compress and decompress ristretto255 elements") {
+  std::mt19937 rng;
+  std::vector<c21t::element_p3> elements(3);
+  rstrn::generate_random_elements(elements, rng);
+  std::vector<sxt_ristretto255_compressed> compressed(elements.size());
+  std::vector<sxt_ristretto255> res(elements.size());
+
+  SECTION("we handle an empty batch") {
+    sxt_ristretto255_batch_compress(nullptr, 0, nullptr);
+    REQUIRE(sxt_ristretto255_batch_decompress(nullptr, 0, nullptr) == 0);
+  }
+
+  SECTION("we match compressing each element") {
+    sxt_ristretto255_batch_compress(compressed.data(), compressed.size(),
+                                    reinterpret_cast<const sxt_ristretto255*>(elements.data()));
+    for (size_t i = 0; i < elements.size(); ++i) {
+      rstt::compressed_element expected;
+      rsto::compress(expected, elements[i]);
+      REQUIRE(std::equal(expected.data(), expected.data() + 32, compressed[i].ristretto_bytes));
+    }
+  }
+
+  SECTION("we can round trip elements") {
+    sxt_ristretto255_batch_compress(compressed.data(), compressed.size(),
+                                    reinterpret_cast<const sxt_ristretto255*>(elements.data()));
+    REQUIRE(sxt_ristretto255_batch_decompress(res.data(), res.size(), compressed.data()) == 0);
+    std::vector<sxt_ristretto255_compressed> recompressed(elements.size());
+    sxt_ristretto255_batch_compress(recompressed.data(), recompressed.size(), res.data());
+    for (size_t i = 0; i < elements.size(); ++i) {
+      REQUIRE(std::equal(compressed[i].ristretto_bytes, compressed[i].ristretto_bytes + 32,
+                         recompressed[i].ristretto_bytes));
+    }
+  }
+
+  SECTION("we return an error for an invalid element") {
+    sxt_ristretto255_batch_compress(compressed.data(), compressed.size(),
+                                    reinterpret_cast<const sxt_ristretto255*>(elements.data()));
+    compressed[1].ristretto_bytes[31] = 0xff;
+    REQUIRE(sxt_ristretto255_batch_decompress(res.data(), res.size(), compressed.data()) != 0);
+  }
+}
@@ -0,0 +1,37 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "cbindings/hash_to_group.h"
+
+#include "sxt/base/container/span.h"
+#include "sxt/base/error/assert.h"
+#include "sxt/curve21/type/element_p3.h"
+#include "sxt/ristretto/base/hash_to_group.h"
+
+using namespace sxt;
+
+//--------------------------------------------------------------------------------------------------
+// sxt_ristretto255_batch_hash_to_group
+//--------------------------------------------------------------------------------------------------
+void sxt_ristretto255_batch_hash_to_group(struct sxt_ristretto255* res, uint64_t n,
+                                          const uint8_t* uniform_bytes) {
+  SXT_RELEASE_ASSERT(n == 0 || (res != nullptr && uniform_bytes != nullptr));
+  static_assert(sizeof(c21t::element_p3) == sizeof(sxt_ristretto255),
+                "types must be ABI compatible");
+  rstb::batch_hash_to_group(
+      basct::span<c21t::element_p3>{reinterpret_cast<c21t::element_p3*>(res), n},
+      basct::cspan<uint8_t>{uniform_bytes, n * rstb::hash_to_group_num_bytes_v});
+}
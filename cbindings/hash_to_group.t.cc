@@ -0,0 +1,44 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "cbindings/hash_to_group.h"
+
+#include <vector>
+
+#include "sxt/base/test/unit_test.h"
+#include "sxt/curve21/type/element_p3.h"
+#include "sxt/ristretto/base/hash_to_group.h"
+
+using namespace sxt;
+
+TEST_CASE("we can hash uniform bytes to ristretto points through the C API") {
+  const uint64_t n = 3;
+  std::vector<uint8_t> bytes(n * 64);
+  for (size_t i = 0; i < bytes.size(); ++i) {
+    bytes[i] = static_cast<uint8_t>(i * 7 + 1);
+  }
+
+  std::vector<c21t::element_p3> res(n);
+  sxt_ristretto255_batch_hash_to_group(reinterpret_cast<sxt_ristretto255*>(res.data()), n,
+                                       bytes.data());
+  for (size_t i = 0; i < n; ++i) {
+    c21t::element_p3 expected;
+    rstb::hash_to_group(expected, bytes.data() + 64 * i);
+    REQUIRE(res[i] == expected);
+  }
+
+  sxt_ristretto255_batch_hash_to_group(nullptr, 0, nullptr);
+}
@@ -0,0 +1,117 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "cbindings/multiexponentiation.h"
+
+#include "cbindings/backend.h"
+#include "sxt/base/error/assert.h"
+#include "sxt/base/error/panic.h"
+#include "sxt/curve21/type/element_p3.h"
+#include "sxt/curve_g1/type/conversion_utility.h"
+#include "sxt/curve_g1/type/element_affine.h"
+#include "sxt/curve_g1/type/element_p2.h"
+#include "sxt/memory/management/managed_array.h"
+#include "sxt/multiexp/base/exponent_sequence.h"
+#include "sxt/multiexp/curve/engine.h"
+
+using namespace sxt;
+
+namespace sxt::cbn {
+//--------------------------------------------------------------------------------------------------
+// to_engine
+//--------------------------------------------------------------------------------------------------
+static mtxcrv::engine_t to_engine(int mode) noexcept {
+  switch (mode) {
+  case SXT_MSM_AUTO:
+    return mtxcrv::engine_t::automatic;
+  case SXT_MSM_NAIVE:
+    return mtxcrv::engine_t::naive;
+  case SXT_MSM_PIPPENGER:
+    return mtxcrv::engine_t::pippenger;
+  case SXT_MSM_BUCKET:
+    return mtxcrv::engine_t::bucket;
+  }
+  baser::panic("invalid multiexponentiation mode: {}", mode);
+}
+
+//--------------------------------------------------------------------------------------------------
+// populate_scalar_sequences
+//--------------------------------------------------------------------------------------------------
+static void populate_scalar_sequences(basct::span<mtxb::exponent_sequence> sequences, uint64_t n,
+                                      const uint8_t* scalars) noexcept {
+  SXT_RELEASE_ASSERT(n == 0 || scalars != nullptr);
+  for (size_t output_index = 0; output_index < sequences.size(); ++output_index) {
+    sequences[output_index] = {
+        .element_nbytes = 32,
+        .n = n,
+        .data = scalars + 32u * n * output_index,
+        .is_signed = 0,
+    };
+  }
+}
+} // namespace sxt::cbn
+
+//--------------------------------------------------------------------------------------------------
+// sxt_ristretto255_multiexponentiation
+//--------------------------------------------------------------------------------------------------
+void sxt_ristretto255_multiexponentiation(struct sxt_ristretto255* res, uint32_t num_outputs,
+                                          uint64_t n, const struct sxt_ristretto255* points,
+                                          const struct sxt_curve25519_scalar* scalars, int mode) {
+  auto engine = cbn::to_engine(mode);
+  if (num_outputs == 0) {
+    return;
+  }
+  SXT_RELEASE_ASSERT(res != nullptr);
+  SXT_RELEASE_ASSERT(n == 0 || points != nullptr);
+  SXT_RELEASE_ASSERT(sxt::cbn::is_backend_initialized());
+  static_assert(sizeof(c21t::element_p3) == sizeof(sxt_ristretto255),
+                "types must be ABI compatible");
+
+  memmg::managed_array<mtxb::exponent_sequence> sequences(num_outputs);
+  cbn::populate_scalar_sequences(sequences, n, reinterpret_cast<const uint8_t*>(scalars));
+
+  cbn::get_backend()->compute_multiexponentiation(
+      {reinterpret_cast<c21t::element_p3*>(res), num_outputs}, sequences,
+      {reinterpret_cast<const c21t::element_p3*>(points), n}, engine);
+}
+
+//--------------------------------------------------------------------------------------------------
+// sxt_bls12_381_g1_multiexponentiation
+//--------------------------------------------------------------------------------------------------
+void sxt_bls12_381_g1_multiexponentiation(struct sxt_bls12_381_g1_p2* res, uint32_t num_outputs,
+                                          uint64_t n, const struct sxt_bls12_381_g1* points,
+                                          const uint8_t* scalars, int mode) {
+  auto engine = cbn::to_engine(mode);
+  if (num_outputs == 0) {
+    return;
+  }
+  SXT_RELEASE_ASSERT(res != nullptr);
+  SXT_RELEASE_ASSERT(n == 0 || points != nullptr);
+  SXT_RELEASE_ASSERT(sxt::cbn::is_backend_initialized());
+  static_assert(sizeof(cg1t::element_p2) == sizeof(sxt_bls12_381_g1_p2),
+                "types must be ABI compatible");
+
+  memmg::managed_array<mtxb::exponent_sequence> sequences(num_outputs);
+  cbn::populate_scalar_sequences(sequences, n, scalars);
+
+  // Convert from affine to projective elements
+  memmg::managed_array<cg1t::element_p2> points_p(n);
+  cg1t::batch_to_element_p2(points_p, basct::cspan<cg1t::element_affine>{
+                                          reinterpret_cast<const cg1t::element_affine*>(points), n});
+
+  cbn::get_backend()->compute_multiexponentiation(
+      {reinterpret_cast<cg1t::element_p2*>(res), num_outputs}, sequences, points_p, engine);
+}
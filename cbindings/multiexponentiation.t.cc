@@ -0,0 +1,150 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "cbindings/multiexponentiation.h"
+
+#include <array>
+#include <random>
+#include <vector>
+
+#include "cbindings/backend.h"
+#include "sxt/base/test/unit_test.h"
+#include "sxt/curve21/operation/add.h"
+#include "sxt/curve21/operation/scalar_multiply.h"
+#include "sxt/curve21/type/element_p3.h"
+#include "sxt/curve_g1/constant/generator.h"
+#include "sxt/curve_g1/operation/add.h"
+#include "sxt/curve_g1/operation/scalar_multiply.h"
+#include "sxt/curve_g1/type/conversion_utility.h"
+#include "sxt/curve_g1/type/element_affine.h"
+#include "sxt/curve_g1/type/element_p2.h"
+#include "sxt/seqcommit/generator/base_element.h"
+
+using namespace sxt;
+
+//--------------------------------------------------------------------------------------------------
+// initialize_backend
+//--------------------------------------------------------------------------------------------------
+static void initialize_backend(int backend) {
+  const sxt_config config = {backend, 0};
+  REQUIRE(sxt_init(&config) == 0);
+}
+
+//--------------------------------------------------------------------------------------------------
+// make_scalars
+//--------------------------------------------------------------------------------------------------
+static std::vector<std::array<uint8_t, 32>> make_scalars(size_t n, std::mt19937& rng) {
+  std::vector<std::array<uint8_t, 32>> res(n);
+  for (auto& scalar : res) {
+    for (auto& byte : scalar) {
+      byte = static_cast<uint8_t>(rng());
+    }
+    // keep the scalars below 2^255 so that the expected values can be computed with
+    // scalar_multiply255
+    scalar[31] &= 0x7f;
+  }
+  return res;
+}
+
+//--------------------------------------------------------------------------------------------------
+// test_ristretto255_multiexponentiation
+//--------------------------------------------------------------------------------------------------
+static void test_ristretto255_multiexponentiation(int backend, int mode) {
+  initialize_backend(backend);
+  std::mt19937 rng{2023};
+
+  const uint64_t n = 5;
+  const uint32_t num_outputs = 3;
+  std::vector<c21t::element_p3> points(n);
+  for (uint64_t i = 0; i < n; ++i) {
+    sqcgn::compute_base_element(points[i], i);
+  }
+  auto scalars = make_scalars(n * num_outputs, rng);
+
+  std::vector<c21t::element_p3> res(num_outputs);
+  sxt_ristretto255_multiexponentiation(
+      reinterpret_cast<sxt_ristretto255*>(res.data()), num_outputs, n,
+      reinterpret_cast<const sxt_ristretto255*>(points.data()),
+      reinterpret_cast<const sxt_curve25519_scalar*>(scalars.data()), mode);
+
+  for (uint32_t output_index = 0; output_index < num_outputs; ++output_index) {
+    auto expected = c21t::element_p3::identity();
+    for (uint64_t i = 0; i < n; ++i) {
+      c21t::element_p3 term;
+      c21o::scalar_multiply255(term, scalars[output_index * n + i].data(), points[i]);
+      c21o::add(expected, expected, term);
+    }
+    REQUIRE(res[output_index] == expected);
+  }
+
+  cbn::reset_backend_for_testing();
+}
+
+//--------------------------------------------------------------------------------------------------
+// test_bls12_381_g1_multiexponentiation
+//--------------------------------------------------------------------------------------------------
+static void test_bls12_381_g1_multiexponentiation(int backend, int mode) {
+  initialize_backend(backend);
+  std::mt19937 rng{2023};
+
+  const uint64_t n = 4;
+  const uint32_t num_outputs = 2;
+  std::vector<cg1t::element_affine> points(n, cg1cn::generator_affine_v);
+  auto scalars = make_scalars(n * num_outputs, rng);
+
+  std::vector<cg1t::element_p2> res(num_outputs);
+  sxt_bls12_381_g1_multiexponentiation(reinterpret_cast<sxt_bls12_381_g1_p2*>(res.data()),
+                                       num_outputs, n,
+                                       reinterpret_cast<const sxt_bls12_381_g1*>(points.data()),
+                                       reinterpret_cast<const uint8_t*>(scalars.data()), mode);
+
+  for (uint32_t output_index = 0; output_index < num_outputs; ++output_index) {
+    auto expected = cg1t::element_p2::identity();
+    for (uint64_t i = 0; i < n; ++i) {
+      cg1t::element_p2 term;
+      cg1o::scalar_multiply255(term, cg1cn::generator_p2_v, scalars[output_index * n + i].data());
+      cg1o::add(expected, expected, term);
+    }
+    REQUIRE(res[output_index] == expected);
+  }
+
+  cbn::reset_backend_for_testing();
+}
+
+//--------------------------------------------------------------------------------------------------
+// test_multiexponentiation
+//--------------------------------------------------------------------------------------------------
+static void test_multiexponentiation(int backend) {
+  for (auto mode : {SXT_MSM_AUTO, SXT_MSM_NAIVE, SXT_MSM_PIPPENGER, SXT_MSM_BUCKET}) {
+    test_ristretto255_multiexponentiation(backend, mode);
+    test_bls12_381_g1_multiexponentiation(backend, mode);
+  }
+
+  SECTION("we can compute zero outputs") {
+    initialize_backend(backend);
+    sxt_ristretto255_multiexponentiation(nullptr, 0, 0, nullptr, nullptr, SXT_MSM_AUTO);
+    sxt_bls12_381_g1_multiexponentiation(nullptr, 0, 0, nullptr, nullptr, SXT_MSM_AUTO);
+    cbn::reset_backend_for_testing();
+  }
+}
+
+TEST_CASE("we can compute multiexponentiations using the gpu backend") {
+  test_multiexponentiation(SXT_GPU_BACKEND);
+}
+
+TEST_CASE("we can compute multiexponentiations using the cpu backend") {
+  test_multiexponentiation(SXT_CPU_BACKEND);
+}
@@ -16,17 +16,39 @@
  */
 #include "cbindings/pedersen.h"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <concepts>
+#include <cstring>
 #include <iostream>
+#include <numeric>
+#include <vector>
 
 #include "cbindings/backend.h"
+#include "cbindings/commitment_coalescer.h"
 #include "sxt/base/error/assert.h"
+#include "sxt/curve21/operation/add.h"
+#include "sxt/curve21/operation/double.h"
+#include "sxt/curve21/operation/neg.h"
 #include "sxt/curve21/type/element_p3.h"
+#include "sxt/curve_g1/operation/add.h"
+#include "sxt/curve_g1/operation/compression.h"
+#include "sxt/curve_g1/operation/double.h"
+#include "sxt/curve_g1/operation/neg.h"
 #include "sxt/curve_g1/type/compressed_element.h"
 #include "sxt/curve_g1/type/conversion_utility.h"
 #include "sxt/curve_g1/type/element_affine.h"
 #include "sxt/curve_g1/type/element_p2.h"
 #include "sxt/memory/management/managed_array.h"
+#include "sxt/multiexp/base/blinding.h"
 #include "sxt/multiexp/base/exponent_sequence.h"
+#include "sxt/multiexp/base/packed_sequence.h"
+#include "sxt/multiexp/base/segmented_generators.h"
+#include "sxt/multiexp/curve/blinding_generators.h"
+#include "sxt/multiexp/curve/engine.h"
+#include "sxt/ristretto/operation/compression.h"
 #include "sxt/ristretto/type/compressed_element.h"
 
 using namespace sxt;
@@ -61,69 +83,382 @@ static uint64_t populate_exponent_sequence(basct::span<mtxb::exponent_sequence>
   return longest_sequence;
 }
 
+//--------------------------------------------------------------------------------------------------
+// add_blinding_terms
+//--------------------------------------------------------------------------------------------------
+/**
+ * Add r_i H to each commitment, where r_i is the i-th 32-byte blinding scalar.
+ *
+ * The blinding terms are computed together as a single multiexponentiation of
+ * mtxb::num_blinding_digits_v terms, so their cost doesn't depend on the length of the committed
+ * sequences.
+ */
+template <class Element>
+static void add_blinding_terms(basct::span<Element> commitments, const uint8_t* blindings,
+                               const Element& blinding_base) noexcept {
+  SXT_RELEASE_ASSERT(blindings != nullptr);
+  std::array<Element, mtxb::num_blinding_digits_v> generators;
+  mtxcrv::make_blinding_generators<Element>(generators, blinding_base);
+  memmg::managed_array<mtxb::exponent_sequence> sequences(commitments.size());
+  for (size_t i = 0; i < commitments.size(); ++i) {
+    sequences[i] = mtxb::make_blinding_sequence({blindings + 32 * i, 32});
+  }
+  memmg::managed_array<Element> terms(commitments.size());
+  cbn::get_backend()->compute_multiexponentiation(terms, sequences, generators,
+                                                  mtxcrv::engine_t::automatic);
+  for (size_t i = 0; i < commitments.size(); ++i) {
+    add(commitments[i], commitments[i], terms[i]);
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// store_commitments
+//--------------------------------------------------------------------------------------------------
+static void store_commitments(struct sxt_ristretto255_compressed* commitments,
+                              basct::cspan<c21t::element_p3> values) noexcept {
+  rsto::batch_compress({reinterpret_cast<rstt::compressed_element*>(commitments), values.size()},
+                       values);
+}
+
+static void store_commitments(struct sxt_ristretto255* commitments,
+                              basct::cspan<c21t::element_p3> values) noexcept {
+  std::copy(values.begin(), values.end(), reinterpret_cast<c21t::element_p3*>(commitments));
+}
+
+static void store_commitments(struct sxt_bls12_381_g1_compressed* commitments,
+                              basct::cspan<cg1t::element_p2> values) noexcept {
+  cg1o::batch_compress({reinterpret_cast<cg1t::compressed_element*>(commitments), values.size()},
+                       values);
+}
+
+static void store_commitments(struct sxt_bls12_381_g1_p2* commitments,
+                              basct::cspan<cg1t::element_p2> values) noexcept {
+  std::copy(values.begin(), values.end(), reinterpret_cast<cg1t::element_p2*>(commitments));
+}
+
+//--------------------------------------------------------------------------------------------------
+// write_commitments
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute the commitments with the backend, compressing them only if the output type is
+ * compressed.
+ */
+static void write_commitments(struct sxt_ristretto255_compressed* commitments,
+                              basct::cspan<mtxb::exponent_sequence> sequences,
+                              basct::cspan<c21t::element_p3> generators) noexcept {
+  static_assert(sizeof(rstt::compressed_element) == sizeof(sxt_ristretto255_compressed),
+                "types must be ABI compatible");
+  cbn::get_backend()->compute_commitments(
+      {reinterpret_cast<rstt::compressed_element*>(commitments), sequences.size()}, sequences,
+      generators);
+}
+
+static void write_commitments(struct sxt_ristretto255* commitments,
+                              basct::cspan<mtxb::exponent_sequence> sequences,
+                              basct::cspan<c21t::element_p3> generators) noexcept {
+  static_assert(sizeof(c21t::element_p3) == sizeof(sxt_ristretto255),
+                "types must be ABI compatible");
+  cbn::get_backend()->compute_multiexponentiation(
+      {reinterpret_cast<c21t::element_p3*>(commitments), sequences.size()}, sequences, generators,
+      mtxcrv::engine_t::automatic);
+}
+
+template <class Commitment>
+  requires std::same_as<Commitment, sxt_ristretto255_compressed> ||
+           std::same_as<Commitment, sxt_ristretto255>
+static void
+write_commitments(Commitment* commitments, basct::cspan<mtxb::exponent_sequence> sequences,
+                  const mtxb::segmented_generators<c21t::element_p3>& generators) noexcept {
+  if (generators.precomputed().size() == generators.size()) {
+    write_commitments(commitments, sequences, generators.precomputed());
+    return;
+  }
+  auto backend = cbn::get_backend();
+  if constexpr (std::same_as<Commitment, sxt_ristretto255>) {
+    backend->compute_multiexponentiation(
+        {reinterpret_cast<c21t::element_p3*>(commitments), sequences.size()}, sequences,
+        generators, mtxcrv::engine_t::automatic);
+  } else {
+    memmg::managed_array<c21t::element_p3> values(sequences.size());
+    backend->compute_multiexponentiation(values, sequences, generators,
+                                         mtxcrv::engine_t::automatic);
+    store_commitments(commitments, values);
+  }
+}
+
+static void write_commitments(struct sxt_bls12_381_g1_compressed* commitments,
+                              basct::cspan<mtxb::exponent_sequence> sequences,
+                              basct::cspan<cg1t::element_p2> generators) noexcept {
+  static_assert(sizeof(cg1t::compressed_element) == sizeof(sxt_bls12_381_g1_compressed),
+                "types must be ABI compatible");
+  cbn::get_backend()->compute_commitments(
+      {reinterpret_cast<cg1t::compressed_element*>(commitments), sequences.size()}, sequences,
+      generators);
+}
+
+static void write_commitments(struct sxt_bls12_381_g1_p2* commitments,
+                              basct::cspan<mtxb::exponent_sequence> sequences,
+                              basct::cspan<cg1t::element_p2> generators) noexcept {
+  static_assert(sizeof(cg1t::element_p2) == sizeof(sxt_bls12_381_g1_p2),
+                "types must be ABI compatible");
+  cbn::get_backend()->compute_multiexponentiation(
+      {reinterpret_cast<cg1t::element_p2*>(commitments), sequences.size()}, sequences, generators,
+      mtxcrv::engine_t::automatic);
+}
+
 //--------------------------------------------------------------------------------------------------
 // process_compute_pedersen_commitments
 //--------------------------------------------------------------------------------------------------
-static void process_compute_pedersen_commitments(struct sxt_ristretto255_compressed* commitments,
+template <class Commitment>
+  requires std::same_as<Commitment, sxt_ristretto255_compressed> ||
+           std::same_as<Commitment, sxt_ristretto255>
+static void process_compute_pedersen_commitments(Commitment* commitments,
                                                  basct::cspan<sxt_sequence_descriptor> descriptors,
                                                  const c21t::element_p3* generators,
-                                                 uint64_t offset_generators) {
+                                                 uint64_t offset_generators,
+                                                 const uint8_t* blindings = nullptr,
+                                                 const c21t::element_p3* blinding_base = nullptr) {
   if (descriptors.size() == 0)
     return;
 
   SXT_RELEASE_ASSERT(commitments != nullptr);
   SXT_RELEASE_ASSERT(sxt::cbn::is_backend_initialized());
-  static_assert(sizeof(rstt::compressed_element) == sizeof(sxt_ristretto255_compressed),
-                "types must be ABI compatible");
 
   memmg::managed_array<mtxb::exponent_sequence> sequences(descriptors.size());
   auto num_generators = populate_exponent_sequence(sequences, descriptors);
 
   auto backend = cbn::get_backend();
-  std::vector<c21t::element_p3> temp_generators;
-  basct::cspan<c21t::element_p3> generators_span;
+  if (blinding_base == nullptr) {
+    if (generators == nullptr) {
+      // the precomputed generators are used in place; only generators past them are computed
+      write_commitments(commitments, sequences,
+                        backend->get_precomputed_generator_segments(num_generators,
+                                                                    offset_generators));
+    } else {
+      write_commitments(commitments, sequences,
+                        basct::cspan<c21t::element_p3>(generators, num_generators));
+    }
+    return;
+  }
 
+  memmg::managed_array<c21t::element_p3> values(sequences.size());
   if (generators == nullptr) {
-    generators_span =
-        backend->get_precomputed_generators(temp_generators, num_generators, offset_generators);
+    backend->compute_multiexponentiation(
+        values, sequences,
+        backend->get_precomputed_generator_segments(num_generators, offset_generators),
+        mtxcrv::engine_t::automatic);
   } else {
-    generators_span = basct::cspan<c21t::element_p3>(generators, num_generators);
+    backend->compute_multiexponentiation(
+        values, sequences, basct::cspan<c21t::element_p3>(generators, num_generators),
+        mtxcrv::engine_t::automatic);
   }
-
-  backend->compute_commitments(
-      {reinterpret_cast<rstt::compressed_element*>(commitments), descriptors.size()}, sequences,
-      generators_span);
+  add_blinding_terms<c21t::element_p3>(values, blindings, *blinding_base);
+  store_commitments(commitments, values);
 }
 
 //--------------------------------------------------------------------------------------------------
 // process_compute_pedersen_commitments
 //--------------------------------------------------------------------------------------------------
-static void process_compute_pedersen_commitments(struct sxt_bls12_381_g1_compressed* commitments,
+template <class Commitment>
+  requires std::same_as<Commitment, sxt_bls12_381_g1_compressed> ||
+           std::same_as<Commitment, sxt_bls12_381_g1_p2>
+static void process_compute_pedersen_commitments(Commitment* commitments,
                                                  basct::cspan<sxt_sequence_descriptor> descriptors,
                                                  const cg1t::element_affine* generators,
-                                                 uint64_t offset_generators) {
+                                                 uint64_t offset_generators,
+                                                 const uint8_t* blindings = nullptr,
+                                                 const cg1t::element_p2* blinding_base = nullptr) {
   if (descriptors.size() == 0)
     return;
 
   SXT_RELEASE_ASSERT(commitments != nullptr);
   SXT_RELEASE_ASSERT(generators != nullptr);
   SXT_RELEASE_ASSERT(sxt::cbn::is_backend_initialized());
-  static_assert(sizeof(cg1t::compressed_element) == sizeof(sxt_bls12_381_g1_compressed),
-                "types must be ABI compatible");
 
   memmg::managed_array<mtxb::exponent_sequence> sequences(descriptors.size());
   auto num_generators = populate_exponent_sequence(sequences, descriptors);
 
-  auto backend = cbn::get_backend();
-
   // Convert from affine to projective elements
   memmg::managed_array<cg1t::element_p2> generators_p(num_generators);
   cg1t::batch_to_element_p2(generators_p,
                             basct::cspan<cg1t::element_affine>{generators, num_generators});
 
-  backend->compute_commitments(
-      {reinterpret_cast<cg1t::compressed_element*>(commitments), descriptors.size()}, sequences,
-      generators_p);
+  if (blinding_base != nullptr) {
+    memmg::managed_array<cg1t::element_p2> values(sequences.size());
+    cbn::get_backend()->compute_multiexponentiation(values, sequences, generators_p,
+                                                    mtxcrv::engine_t::automatic);
+    add_blinding_terms<cg1t::element_p2>(values, blindings, *blinding_base);
+    store_commitments(commitments, values);
+    return;
+  }
+
+  write_commitments(commitments, sequences, generators_p);
+}
+
+//--------------------------------------------------------------------------------------------------
+// view_generators
+//--------------------------------------------------------------------------------------------------
+/**
+ * Return the generators [first, first + n) of a range made of a precomputed segment followed by
+ * an already computed tail.
+ */
+static mtxb::segmented_generators<c21t::element_p3>
+view_generators(basct::cspan<c21t::element_p3> precomputed, basct::cspan<c21t::element_p3> tail,
+                size_t first, size_t n) noexcept {
+  auto num_precomputed = precomputed.size();
+  if (first + n <= num_precomputed) {
+    return {precomputed.subspan(first, n)};
+  }
+  if (first >= num_precomputed) {
+    return {tail.subspan(first - num_precomputed, n)};
+  }
+  return {precomputed.subspan(first), n,
+          [tail, first, num_precomputed](basct::span<c21t::element_p3> generators,
+                                         size_t first_p) noexcept {
+            std::copy_n(tail.begin() + (first + first_p - num_precomputed), generators.size(),
+                        generators.begin());
+          }};
+}
+
+//--------------------------------------------------------------------------------------------------
+// write_component_commitments
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute the commitments of the sequences with the given indexes, sorted by offset, whose
+ * generator ranges form a single connected range.
+ *
+ * The range's generators are fetched once: the precomputed part is used in place and only the
+ * tail past it is computed. Sequences that share an offset are computed together against a view
+ * of their own generators, so no sequence is padded out to the start of the range.
+ */
+static void write_component_commitments(struct sxt_ristretto255_compressed* commitments,
+                                        basct::cspan<mtxb::exponent_sequence> sequences,
+                                        const uint64_t* offsets,
+                                        basct::cspan<size_t> indexes) noexcept {
+  auto first = offsets[indexes[0]];
+  auto last = first;
+  for (auto index : indexes) {
+    last = std::max(last, offsets[index] + sequences[index].n);
+  }
+  auto generators = cbn::get_backend()->get_precomputed_generator_segments(last - first, first);
+  auto precomputed = generators.precomputed();
+  memmg::managed_array<c21t::element_p3> tail_data;
+  basct::cspan<c21t::element_p3> tail;
+  if (precomputed.size() < generators.size()) {
+    tail = generators.get(tail_data, precomputed.size(), generators.size() - precomputed.size());
+  }
+
+  memmg::managed_array<mtxb::exponent_sequence> group_sequences(indexes.size());
+  memmg::managed_array<sxt_ristretto255_compressed> group_commitments(indexes.size());
+  size_t group_first = 0;
+  while (group_first < indexes.size()) {
+    auto offset = offsets[indexes[group_first]];
+    uint64_t n = 0;
+    auto group_last = group_first;
+    for (; group_last < indexes.size() && offsets[indexes[group_last]] == offset; ++group_last) {
+      auto& seq = sequences[indexes[group_last]];
+      group_sequences[group_last - group_first] = seq;
+      n = std::max(n, seq.n);
+    }
+    auto num_sequences = group_last - group_first;
+    write_commitments(group_commitments.data(), {group_sequences.data(), num_sequences},
+                      view_generators(precomputed, tail, offset - first, n));
+    for (size_t i = 0; i < num_sequences; ++i) {
+      commitments[indexes[group_first + i]] = group_commitments[i];
+    }
+    group_first = group_last;
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// process_compute_pedersen_commitments_with_offsets
+//--------------------------------------------------------------------------------------------------
+static void process_compute_pedersen_commitments_with_offsets(
+    struct sxt_ristretto255_compressed* commitments,
+    basct::cspan<sxt_sequence_descriptor> descriptors, const uint64_t* offsets_generators) {
+  if (descriptors.size() == 0)
+    return;
+
+  SXT_RELEASE_ASSERT(commitments != nullptr);
+  SXT_RELEASE_ASSERT(offsets_generators != nullptr);
+  SXT_RELEASE_ASSERT(sxt::cbn::is_backend_initialized());
+
+  memmg::managed_array<mtxb::exponent_sequence> sequences(descriptors.size());
+  populate_exponent_sequence(sequences, descriptors);
+
+  // group the sequences into connected components of overlapping generator ranges
+  memmg::managed_array<size_t> indexes(sequences.size());
+  std::iota(indexes.begin(), indexes.end(), 0);
+  std::stable_sort(indexes.begin(), indexes.end(), [&](size_t lhs, size_t rhs) noexcept {
+    return offsets_generators[lhs] < offsets_generators[rhs];
+  });
+  size_t component_first = 0;
+  while (component_first < indexes.size()) {
+    auto index = indexes[component_first];
+    auto end = offsets_generators[index] + sequences[index].n;
+    auto component_last = component_first + 1;
+    for (; component_last < indexes.size(); ++component_last) {
+      index = indexes[component_last];
+      if (offsets_generators[index] > end) {
+        break;
+      }
+      end = std::max(end, offsets_generators[index] + sequences[index].n);
+    }
+    write_component_commitments(
+        commitments, sequences, offsets_generators,
+        {indexes.data() + component_first, component_last - component_first});
+    component_first = component_last;
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// process_compute_pedersen_commitments_packed
+//--------------------------------------------------------------------------------------------------
+static void process_compute_pedersen_commitments_packed(
+    struct sxt_ristretto255_compressed* commitments,
+    basct::cspan<sxt_packed_sequence_descriptor> descriptors, uint64_t offset_generators) {
+  if (descriptors.size() == 0)
+    return;
+
+  SXT_RELEASE_ASSERT(commitments != nullptr);
+  SXT_RELEASE_ASSERT(descriptors.data() != nullptr);
+  SXT_RELEASE_ASSERT(sxt::cbn::is_backend_initialized());
+
+  memmg::managed_array<mtxb::packed_sequence> sequences(descriptors.size());
+  uint64_t num_generators = 0;
+  for (size_t i = 0; i < descriptors.size(); ++i) {
+    auto& descriptor = descriptors[i];
+    SXT_RELEASE_ASSERT(descriptor.n == 0 || descriptor.data != nullptr);
+    SXT_RELEASE_ASSERT(descriptor.element_nbits != 0 && descriptor.element_nbits <= 256);
+    num_generators = std::max(num_generators, descriptor.n);
+    sequences[i] = {
+        .element_nbits = descriptor.element_nbits,
+        .n = descriptor.n,
+        .data = descriptor.data,
+    };
+  }
+
+  auto backend = cbn::get_backend();
+  memmg::managed_array<c21t::element_p3> values(sequences.size());
+  backend->compute_multiexponentiation(
+      values, sequences,
+      backend->get_precomputed_generator_segments(num_generators, offset_generators),
+      mtxcrv::engine_t::automatic);
+  rsto::batch_compress(
+      {reinterpret_cast<rstt::compressed_element*>(commitments), sequences.size()}, values);
+}
+
+//--------------------------------------------------------------------------------------------------
+// coalescing_window
+//--------------------------------------------------------------------------------------------------
+static std::atomic<uint64_t> coalescing_window_us{0};
+
+//--------------------------------------------------------------------------------------------------
+// get_coalescer
+//--------------------------------------------------------------------------------------------------
+static commitment_coalescer& get_coalescer() noexcept {
+  static commitment_coalescer coalescer{process_compute_pedersen_commitments_with_offsets};
+  return coalescer;
 }
 } // namespace sxt::cbn
 
@@ -156,6 +491,121 @@ void sxt_curve25519_compute_pedersen_commitments(sxt_ristretto255_compressed* co
                                                  uint32_t num_sequences,
                                                  const sxt_sequence_descriptor* descriptors,
                                                  uint64_t offset_generators) {
+  auto window = cbn::coalescing_window_us.load(std::memory_order_relaxed);
+  if (window > 0 && num_sequences > 0) {
+    cbn::get_coalescer().compute(commitments, {descriptors, num_sequences}, offset_generators,
+                                 std::chrono::microseconds{window});
+    return;
+  }
   cbn::process_compute_pedersen_commitments(commitments, {descriptors, num_sequences}, nullptr,
                                             offset_generators);
 }
+
+//--------------------------------------------------------------------------------------------------
+// sxt_curve25519_compute_uncompressed_pedersen_commitments
+//--------------------------------------------------------------------------------------------------
+void sxt_curve25519_compute_uncompressed_pedersen_commitments(
+    struct sxt_ristretto255* commitments, uint32_t num_sequences,
+    const struct sxt_sequence_descriptor* descriptors, uint64_t offset_generators) {
+  cbn::process_compute_pedersen_commitments(commitments, {descriptors, num_sequences}, nullptr,
+                                            offset_generators);
+}
+
+//--------------------------------------------------------------------------------------------------
+// sxt_curve25519_compute_uncompressed_pedersen_commitments_with_generators
+//--------------------------------------------------------------------------------------------------
+void sxt_curve25519_compute_uncompressed_pedersen_commitments_with_generators(
+    struct sxt_ristretto255* commitments, uint32_t num_sequences,
+    const struct sxt_sequence_descriptor* descriptors, const struct sxt_ristretto255* generators) {
+  cbn::process_compute_pedersen_commitments(commitments, {descriptors, num_sequences},
+                                            reinterpret_cast<const c21t::element_p3*>(generators),
+                                            0);
+}
+
+//--------------------------------------------------------------------------------------------------
+// sxt_bls12_381_g1_compute_uncompressed_pedersen_commitments_with_generators
+//--------------------------------------------------------------------------------------------------
+void sxt_bls12_381_g1_compute_uncompressed_pedersen_commitments_with_generators(
+    struct sxt_bls12_381_g1_p2* commitments, uint32_t num_sequences,
+    const struct sxt_sequence_descriptor* descriptors, const struct sxt_bls12_381_g1* generators) {
+  cbn::process_compute_pedersen_commitments(
+      commitments, {descriptors, num_sequences},
+      reinterpret_cast<const cg1t::element_affine*>(generators), 0);
+}
+
+//--------------------------------------------------------------------------------------------------
+// sxt_curve25519_set_commitment_coalescing_window
+//--------------------------------------------------------------------------------------------------
+void sxt_curve25519_set_commitment_coalescing_window(uint64_t window_us) {
+  cbn::coalescing_window_us.store(window_us, std::memory_order_relaxed);
+}
+
+//--------------------------------------------------------------------------------------------------
+// sxt_curve25519_compute_pedersen_commitments_with_offsets
+//--------------------------------------------------------------------------------------------------
+void sxt_curve25519_compute_pedersen_commitments_with_offsets(
+    struct sxt_ristretto255_compressed* commitments, uint32_t num_sequences,
+    const struct sxt_sequence_descriptor* descriptors, const uint64_t* offsets_generators) {
+  cbn::process_compute_pedersen_commitments_with_offsets(commitments, {descriptors, num_sequences},
+                                                         offsets_generators);
+}
+
+//--------------------------------------------------------------------------------------------------
+// sxt_curve25519_compute_pedersen_commitments_packed
+//--------------------------------------------------------------------------------------------------
+void sxt_curve25519_compute_pedersen_commitments_packed(
+    struct sxt_ristretto255_compressed* commitments, uint32_t num_sequences,
+    const struct sxt_packed_sequence_descriptor* descriptors, uint64_t offset_generators) {
+  cbn::process_compute_pedersen_commitments_packed(commitments, {descriptors, num_sequences},
+                                                   offset_generators);
+}
+
+//--------------------------------------------------------------------------------------------------
+// sxt_curve25519_compute_blinded_pedersen_commitments
+//--------------------------------------------------------------------------------------------------
+void sxt_curve25519_compute_blinded_pedersen_commitments(
+    struct sxt_ristretto255_compressed* commitments, uint32_t num_sequences,
+    const struct sxt_sequence_descriptor* descriptors,
+    const struct sxt_curve25519_scalar* blindings, const struct sxt_ristretto255* blinding_base,
+    uint64_t offset_generators) {
+  SXT_RELEASE_ASSERT(blinding_base != nullptr);
+  cbn::process_compute_pedersen_commitments(
+      commitments, {descriptors, num_sequences}, nullptr, offset_generators,
+      reinterpret_cast<const uint8_t*>(blindings),
+      reinterpret_cast<const c21t::element_p3*>(blinding_base));
+}
+
+//--------------------------------------------------------------------------------------------------
+// sxt_curve25519_compute_blinded_pedersen_commitments_with_generators
+//--------------------------------------------------------------------------------------------------
+void sxt_curve25519_compute_blinded_pedersen_commitments_with_generators(
+    struct sxt_ristretto255_compressed* commitments, uint32_t num_sequences,
+    const struct sxt_sequence_descriptor* descriptors,
+    const struct sxt_curve25519_scalar* blindings, const struct sxt_ristretto255* generators,
+    const struct sxt_ristretto255* blinding_base) {
+  SXT_RELEASE_ASSERT(blinding_base != nullptr);
+  cbn::process_compute_pedersen_commitments(
+      commitments, {descriptors, num_sequences},
+      reinterpret_cast<const c21t::element_p3*>(generators), 0,
+      reinterpret_cast<const uint8_t*>(blindings),
+      reinterpret_cast<const c21t::element_p3*>(blinding_base));
+}
+
+//--------------------------------------------------------------------------------------------------
+// sxt_bls12_381_g1_compute_blinded_pedersen_commitments_with_generators
+//--------------------------------------------------------------------------------------------------
+void sxt_bls12_381_g1_compute_blinded_pedersen_commitments_with_generators(
+    struct sxt_bls12_381_g1_compressed* commitments, uint32_t num_sequences,
+    const struct sxt_sequence_descriptor* descriptors, const uint8_t* blindings,
+    const struct sxt_bls12_381_g1* generators, const struct sxt_bls12_381_g1* blinding_base) {
+  SXT_RELEASE_ASSERT(blinding_base != nullptr);
+  cg1t::element_affine base_affine;
+  std::memcpy(base_affine.X.data(), blinding_base->X, sizeof(blinding_base->X));
+  std::memcpy(base_affine.Y.data(), blinding_base->Y, sizeof(blinding_base->Y));
+  base_affine.infinity = 0;
+  cg1t::element_p2 base;
+  cg1t::to_element_p2(base, base_affine);
+  cbn::process_compute_pedersen_commitments(
+      commitments, {descriptors, num_sequences},
+      reinterpret_cast<const cg1t::element_affine*>(generators), 0, blindings, &base);
+}
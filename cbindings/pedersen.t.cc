@@ -16,6 +16,9 @@
  */
 #include "cbindings/pedersen.h"
 
+#include <array>
+#include <latch>
+#include <thread>
 #include <type_traits>
 #include <vector>
 
@@ -30,9 +33,11 @@
 #include "sxt/curve_g1/type/compressed_element.h"
 #include "sxt/curve_g1/type/conversion_utility.h"
 #include "sxt/curve_g1/type/element_affine.h"
+#include "sxt/curve_g1/type/element_p2.h"
 #include "sxt/memory/management/managed_array.h"
 #include "sxt/ristretto/base/byte_conversion.h"
 #include "sxt/ristretto/operation/add.h"
+#include "sxt/ristretto/operation/compression.h"
 #include "sxt/ristretto/operation/overload.h"
 #include "sxt/ristretto/operation/scalar_multiply.h"
 #include "sxt/ristretto/type/compressed_element.h"
@@ -235,6 +240,141 @@ static void test_ristretto255_pedersen_commitments_with_given_backend_and_no_gen
     REQUIRE(commitments_data == expected_commitment);
   }
 
+  SECTION("we can compute commitments with coalescing enabled") {
+    const std::vector<uint8_t> data = {1, 0, 2, 6, 0, 7};
+    const auto descriptor = make_sequence_descriptor(data);
+    const uint64_t offset_gens = 3;
+
+    rstt::compressed_element expected;
+    sxt_curve25519_compute_pedersen_commitments(
+        reinterpret_cast<sxt_ristretto255_compressed*>(&expected), 1, &descriptor, offset_gens);
+
+    sxt_curve25519_set_commitment_coalescing_window(100);
+    rstt::compressed_element commitment;
+    sxt_curve25519_compute_pedersen_commitments(
+        reinterpret_cast<sxt_ristretto255_compressed*>(&commitment), 1, &descriptor, offset_gens);
+    sxt_curve25519_set_commitment_coalescing_window(0);
+
+    REQUIRE(commitment == expected);
+  }
+
+  SECTION("we can coalesce concurrent commitments at different generator offsets") {
+    const std::vector<uint8_t> data1 = {1, 0, 2};
+    const std::vector<uint16_t> data2 = {3, 4};
+    const std::vector<uint32_t> data3 = {5, 6, 7, 8};
+    const sxt_sequence_descriptor descriptors[] = {
+        make_sequence_descriptor(data1),
+        make_sequence_descriptor(data2),
+        make_sequence_descriptor(data3),
+    };
+    const uint64_t offsets[] = {0, 3, 1'000};
+    constexpr size_t num_sequences = std::size(descriptors);
+    rstt::compressed_element expected[num_sequences];
+    for (size_t i = 0; i < num_sequences; ++i) {
+      sxt_curve25519_compute_pedersen_commitments(
+          reinterpret_cast<sxt_ristretto255_compressed*>(&expected[i]), 1, &descriptors[i],
+          offsets[i]);
+    }
+
+    sxt_curve25519_set_commitment_coalescing_window(100'000);
+    rstt::compressed_element commitments[num_sequences];
+    std::vector<std::thread> threads;
+    std::latch start{num_sequences};
+    for (size_t i = 0; i < num_sequences; ++i) {
+      threads.emplace_back([&, i]() noexcept {
+        start.arrive_and_wait();
+        sxt_curve25519_compute_pedersen_commitments(
+            reinterpret_cast<sxt_ristretto255_compressed*>(&commitments[i]), 1, &descriptors[i],
+            offsets[i]);
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    sxt_curve25519_set_commitment_coalescing_window(0);
+
+    for (size_t i = 0; i < num_sequences; ++i) {
+      REQUIRE(commitments[i] == expected[i]);
+    }
+  }
+
+  SECTION("we can compute commitments with a different generator offset per sequence") {
+    const std::vector<uint8_t> data1 = {1, 0, 2};
+    const std::vector<int16_t> data2 = {-3, 4};
+    const std::vector<uint8_t> data3;
+    const std::vector<uint32_t> data4 = {5, 6, 7, 8};
+    const sxt_sequence_descriptor descriptors[] = {
+        make_sequence_descriptor(data1),
+        make_sequence_descriptor(data2),
+        make_sequence_descriptor(data3),
+        make_sequence_descriptor(data4),
+    };
+    const uint64_t offsets[] = {4, 2, 100, 4};
+    constexpr uint64_t num_sequences = std::size(descriptors);
+    rstt::compressed_element commitments_data[num_sequences];
+    sxt_curve25519_compute_pedersen_commitments_with_offsets(
+        reinterpret_cast<sxt_ristretto255_compressed*>(commitments_data), num_sequences,
+        descriptors, offsets);
+    for (size_t i = 0; i < num_sequences; ++i) {
+      rstt::compressed_element expected;
+      sxt_curve25519_compute_pedersen_commitments(
+          reinterpret_cast<sxt_ristretto255_compressed*>(&expected), 1, &descriptors[i],
+          offsets[i]);
+      REQUIRE(commitments_data[i] == expected);
+    }
+  }
+
+  SECTION("we can commit to consecutive chunks and far apart ranges in one call") {
+    // with precomputed generators, the chunks cover the table, straddle its end and lie past it
+    const std::vector<uint8_t> data = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14};
+    const sxt_sequence_descriptor descriptors[] = {
+        {.element_nbytes = 1, .n = 4, .data = data.data() + 7, .is_signed = false},
+        {.element_nbytes = 1, .n = 7, .data = data.data(), .is_signed = false},
+        {.element_nbytes = 1, .n = 3, .data = data.data() + 11, .is_signed = false},
+        {.element_nbytes = 1, .n = 2, .data = data.data(), .is_signed = false},
+    };
+    const uint64_t offsets[] = {7, 0, 11, 1'000'000'000};
+    constexpr uint64_t num_sequences = std::size(descriptors);
+    rstt::compressed_element commitments_data[num_sequences];
+    sxt_curve25519_compute_pedersen_commitments_with_offsets(
+        reinterpret_cast<sxt_ristretto255_compressed*>(commitments_data), num_sequences,
+        descriptors, offsets);
+    for (size_t i = 0; i < num_sequences; ++i) {
+      rstt::compressed_element expected;
+      sxt_curve25519_compute_pedersen_commitments(
+          reinterpret_cast<sxt_ristretto255_compressed*>(&expected), 1, &descriptors[i],
+          offsets[i]);
+      REQUIRE(commitments_data[i] == expected);
+    }
+  }
+
+  SECTION("we can compute commitments of bit-packed sequences") {
+    // the 12-bit values 0x321, 0x654, 0x987 and the 3-bit values 3, 3, 3
+    const std::vector<uint8_t> packed1 = {0x21, 0x43, 0x65, 0x87, 0x09};
+    const std::vector<uint8_t> packed2 = {0b11011011, 0b0};
+    const sxt_packed_sequence_descriptor descriptors[] = {
+        {.element_nbits = 12, .n = 3, .data = packed1.data()},
+        {.element_nbits = 3, .n = 3, .data = packed2.data()},
+    };
+    const std::vector<uint16_t> data1 = {0x321, 0x654, 0x987};
+    const std::vector<uint8_t> data2 = {3, 3, 3};
+    const sxt_sequence_descriptor expected_descriptors[] = {
+        make_sequence_descriptor(data1),
+        make_sequence_descriptor(data2),
+    };
+    const uint64_t offset_gens = 5;
+    rstt::compressed_element commitments_data[2];
+    sxt_curve25519_compute_pedersen_commitments_packed(
+        reinterpret_cast<sxt_ristretto255_compressed*>(commitments_data), 2, descriptors,
+        offset_gens);
+    rstt::compressed_element expected[2];
+    sxt_curve25519_compute_pedersen_commitments(
+        reinterpret_cast<sxt_ristretto255_compressed*>(expected), 2, expected_descriptors,
+        offset_gens);
+    REQUIRE(commitments_data[0] == expected[0]);
+    REQUIRE(commitments_data[1] == expected[1]);
+  }
+
   cbn::reset_backend_for_testing();
 }
 
@@ -259,6 +399,96 @@ static void test_ristretto255_pedersen_commitments_with_given_backend_and_genera
     REQUIRE(*reinterpret_cast<rstt::compressed_element*>(&commitments_data) == expected_commitment);
   }
 
+  SECTION("we can compute uncompressed commitments") {
+    const std::vector<uint32_t> data = {2000, 7500};
+    const auto seq_descriptor = make_sequence_descriptor(data);
+    const auto generators = compute_random_curve25519_generators(data.size(), 10);
+    const auto expected_commitment = compute_expected_ristretto255_commitment(data, generators);
+
+    c21t::element_p3 commitment;
+    sxt_curve25519_compute_uncompressed_pedersen_commitments_with_generators(
+        reinterpret_cast<sxt_ristretto255*>(&commitment), 1, &seq_descriptor,
+        reinterpret_cast<const sxt_ristretto255*>(generators.data()));
+    rstt::compressed_element commitment_p;
+    rsto::compress(commitment_p, commitment);
+    REQUIRE(commitment_p == expected_commitment);
+
+    sxt_curve25519_compute_uncompressed_pedersen_commitments(
+        reinterpret_cast<sxt_ristretto255*>(&commitment), 1, &seq_descriptor, 10);
+    rsto::compress(commitment_p, commitment);
+    REQUIRE(commitment_p == expected_commitment);
+  }
+
+  cbn::reset_backend_for_testing();
+}
+
+//--------------------------------------------------------------------------------------------------
+// test_ristretto255_blinded_pedersen_commitments_with_given_backend
+//--------------------------------------------------------------------------------------------------
+static void test_ristretto255_blinded_pedersen_commitments_with_given_backend(
+    int backend, uint64_t num_precomputed_generators) {
+  initialize_backend(backend, num_precomputed_generators);
+
+  const auto blinding_base = compute_random_curve25519_generators(1, 100)[0];
+  rstt::compressed_element blinding_base_compressed;
+  rstb::to_bytes(blinding_base_compressed.data(), blinding_base);
+
+  // choose bytes with the high bit set so that signed sequences need to carry
+  std::array<uint8_t, 32> r1 = {};
+  r1[0] = 0x80;
+  r1[1] = 0xff;
+  r1[2] = 0x12;
+  std::array<uint8_t, 32> r2 = {};
+  r2[0] = 0x7;
+  r2[30] = 0xf1;
+  sxt_curve25519_scalar blindings[2];
+  std::copy(r1.begin(), r1.end(), blindings[0].bytes);
+  std::copy(r2.begin(), r2.end(), blindings[1].bytes);
+
+  const std::vector<uint8_t> data1 = {1, 0, 2, 6};
+  const std::vector<int16_t> data2 = {-3, 5};
+  const sxt_sequence_descriptor descriptors[] = {
+      make_sequence_descriptor(data1),
+      make_sequence_descriptor(data2),
+  };
+  constexpr uint32_t num_sequences = std::size(descriptors);
+
+  auto blind = [&](rstt::compressed_element commitment, const std::array<uint8_t, 32>& r) {
+    rstt::compressed_element blinding_term;
+    rsto::scalar_multiply(blinding_term, r, blinding_base_compressed);
+    rsto::add(commitment, commitment, blinding_term);
+    return commitment;
+  };
+
+  SECTION("we can compute blinded commitments with precomputed generators") {
+    rstt::compressed_element commitments[num_sequences];
+    sxt_curve25519_compute_pedersen_commitments(
+        reinterpret_cast<sxt_ristretto255_compressed*>(commitments), num_sequences, descriptors,
+        3);
+    rstt::compressed_element blinded_commitments[num_sequences];
+    sxt_curve25519_compute_blinded_pedersen_commitments(
+        reinterpret_cast<sxt_ristretto255_compressed*>(blinded_commitments), num_sequences,
+        descriptors, blindings, reinterpret_cast<const sxt_ristretto255*>(&blinding_base), 3);
+    REQUIRE(blinded_commitments[0] == blind(commitments[0], r1));
+    REQUIRE(blinded_commitments[1] == blind(commitments[1], r2));
+  }
+
+  SECTION("we can compute blinded commitments with generators given as input") {
+    const auto generators = compute_random_curve25519_generators(data1.size(), 10);
+    rstt::compressed_element commitments[num_sequences];
+    sxt_curve25519_compute_pedersen_commitments_with_generators(
+        reinterpret_cast<sxt_ristretto255_compressed*>(commitments), num_sequences, descriptors,
+        reinterpret_cast<const sxt_ristretto255*>(generators.data()));
+    rstt::compressed_element blinded_commitments[num_sequences];
+    sxt_curve25519_compute_blinded_pedersen_commitments_with_generators(
+        reinterpret_cast<sxt_ristretto255_compressed*>(blinded_commitments), num_sequences,
+        descriptors, blindings, reinterpret_cast<const sxt_ristretto255*>(generators.data()),
+        reinterpret_cast<const sxt_ristretto255*>(&blinding_base));
+    REQUIRE(commitments[0] == compute_expected_ristretto255_commitment(data1, generators));
+    REQUIRE(blinded_commitments[0] == blind(commitments[0], r1));
+    REQUIRE(blinded_commitments[1] == blind(commitments[1], r2));
+  }
+
   cbn::reset_backend_for_testing();
 }
 
@@ -289,6 +519,48 @@ static void test_bls12_381_g1_pedersen_commitments_with_given_backend_and_genera
         &commitments_data, num_sequences, &seq_descriptor,
         reinterpret_cast<const sxt_bls12_381_g1*>(generators.data()));
     REQUIRE(*reinterpret_cast<cg1t::compressed_element*>(&commitments_data) == expected_commitment);
+
+    cg1t::element_p2 commitment;
+    sxt_bls12_381_g1_compute_uncompressed_pedersen_commitments_with_generators(
+        reinterpret_cast<sxt_bls12_381_g1_p2*>(&commitment), num_sequences, &seq_descriptor,
+        reinterpret_cast<const sxt_bls12_381_g1*>(generators.data()));
+    cg1t::compressed_element commitment_p;
+    cg1o::compress(commitment_p, commitment);
+    REQUIRE(commitment_p == expected_commitment);
+  }
+
+  SECTION("we can compute blinded commitments") {
+    const std::vector<uint8_t> data = {3, 0, 0xff};
+    const auto seq_descriptor = make_sequence_descriptor(data);
+    const auto generators = get_bls12_381_g1_generators(data.size(), 10);
+    const sxt_bls12_381_g1 blinding_base = {
+        .X = {cg1cn::generator_affine_v.X[0], cg1cn::generator_affine_v.X[1],
+              cg1cn::generator_affine_v.X[2], cg1cn::generator_affine_v.X[3],
+              cg1cn::generator_affine_v.X[4], cg1cn::generator_affine_v.X[5]},
+        .Y = {cg1cn::generator_affine_v.Y[0], cg1cn::generator_affine_v.Y[1],
+              cg1cn::generator_affine_v.Y[2], cg1cn::generator_affine_v.Y[3],
+              cg1cn::generator_affine_v.Y[4], cg1cn::generator_affine_v.Y[5]},
+    };
+    std::array<uint8_t, 32> r = {};
+    r[0] = 0x91;
+    r[7] = 0xab;
+
+    // the blinding term is equivalent to an extra generator with the blinding scalar as value
+    std::vector<std::array<uint8_t, 32>> expanded_data(data.size() + 1);
+    for (size_t i = 0; i < data.size(); ++i) {
+      expanded_data[i][0] = data[i];
+    }
+    expanded_data[data.size()] = r;
+    auto expanded_generators = generators;
+    expanded_generators.push_back(cg1cn::generator_affine_v);
+    const auto expected_commitment =
+        compute_expected_bls12_381_g1_commitment(expanded_data, expanded_generators);
+
+    sxt_bls12_381_g1_compressed commitment;
+    sxt_bls12_381_g1_compute_blinded_pedersen_commitments_with_generators(
+        &commitment, 1, &seq_descriptor, r.data(),
+        reinterpret_cast<const sxt_bls12_381_g1*>(generators.data()), &blinding_base);
+    REQUIRE(*reinterpret_cast<cg1t::compressed_element*>(&commitment) == expected_commitment);
   }
 
   cbn::reset_backend_for_testing();
@@ -309,6 +581,11 @@ compute_ristretto255_commitments_with_specified_precomputed_elements(int backend
     test_ristretto255_pedersen_commitments_with_given_backend_and_generators(backend,
                                                                              num_precomputed_els);
   }
+
+  SECTION("We can compute blinded commitments") {
+    test_ristretto255_blinded_pedersen_commitments_with_given_backend(backend,
+                                                                      num_precomputed_els);
+  }
 }
 
 //--------------------------------------------------------------------------------------------------
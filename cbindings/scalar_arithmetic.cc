@@ -0,0 +1,138 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "cbindings/scalar_arithmetic.h"
+
+#include <limits>
+
+#include "sxt/base/container/span.h"
+#include "sxt/base/error/assert.h"
+#include "sxt/scalar25/operation/batch_arithmetic.h"
+#include "sxt/scalar25/operation/inner_product.h"
+#include "sxt/scalar25/operation/inv.h"
+#include "sxt/scalar25/type/element.h"
+
+using namespace sxt;
+
+static_assert(sizeof(s25t::element) == sizeof(sxt_curve25519_scalar),
+              "types must be ABI compatible");
+
+namespace sxt::cbn {
+//--------------------------------------------------------------------------------------------------
+// to_span
+//--------------------------------------------------------------------------------------------------
+static basct::span<s25t::element> to_span(struct sxt_curve25519_scalar* scalars,
+                                          uint64_t n) noexcept {
+  return {reinterpret_cast<s25t::element*>(scalars), n};
+}
+
+static basct::cspan<s25t::element> to_span(const struct sxt_curve25519_scalar* scalars,
+                                           uint64_t n) noexcept {
+  return {reinterpret_cast<const s25t::element*>(scalars), n};
+}
+
+//--------------------------------------------------------------------------------------------------
+// to_element
+//--------------------------------------------------------------------------------------------------
+static const s25t::element& to_element(const struct sxt_curve25519_scalar* scalar) noexcept {
+  SXT_RELEASE_ASSERT(scalar != nullptr);
+  return *reinterpret_cast<const s25t::element*>(scalar);
+}
+} // namespace sxt::cbn
+
+//--------------------------------------------------------------------------------------------------
+// sxt_curve25519_scalar_batch_add
+//--------------------------------------------------------------------------------------------------
+void sxt_curve25519_scalar_batch_add(struct sxt_curve25519_scalar* res, uint64_t n,
+                                     const struct sxt_curve25519_scalar* lhs,
+                                     const struct sxt_curve25519_scalar* rhs) {
+  SXT_RELEASE_ASSERT(n == 0 || (res != nullptr && lhs != nullptr && rhs != nullptr));
+  s25o::batch_add(cbn::to_span(res, n), cbn::to_span(lhs, n), cbn::to_span(rhs, n));
+}
+
+//--------------------------------------------------------------------------------------------------
+// sxt_curve25519_scalar_batch_sub
+//--------------------------------------------------------------------------------------------------
+void sxt_curve25519_scalar_batch_sub(struct sxt_curve25519_scalar* res, uint64_t n,
+                                     const struct sxt_curve25519_scalar* lhs,
+                                     const struct sxt_curve25519_scalar* rhs) {
+  SXT_RELEASE_ASSERT(n == 0 || (res != nullptr && lhs != nullptr && rhs != nullptr));
+  s25o::batch_sub(cbn::to_span(res, n), cbn::to_span(lhs, n), cbn::to_span(rhs, n));
+}
+
+//--------------------------------------------------------------------------------------------------
+// sxt_curve25519_scalar_batch_mul
+//--------------------------------------------------------------------------------------------------
+void sxt_curve25519_scalar_batch_mul(struct sxt_curve25519_scalar* res, uint64_t n,
+                                     const struct sxt_curve25519_scalar* lhs,
+                                     const struct sxt_curve25519_scalar* rhs) {
+  SXT_RELEASE_ASSERT(n == 0 || (res != nullptr && lhs != nullptr && rhs != nullptr));
+  s25o::batch_mul(cbn::to_span(res, n), cbn::to_span(lhs, n), cbn::to_span(rhs, n));
+}
+
+//--------------------------------------------------------------------------------------------------
+// sxt_curve25519_scalar_batch_muladd
+//--------------------------------------------------------------------------------------------------
+void sxt_curve25519_scalar_batch_muladd(struct sxt_curve25519_scalar* res, uint64_t n,
+                                        const struct sxt_curve25519_scalar* a,
+                                        const struct sxt_curve25519_scalar* x,
+                                        const struct sxt_curve25519_scalar* y) {
+  SXT_RELEASE_ASSERT(n == 0 || (res != nullptr && x != nullptr && y != nullptr));
+  s25o::batch_muladd(cbn::to_span(res, n), cbn::to_element(a), cbn::to_span(x, n),
+                     cbn::to_span(y, n));
+}
+
+//--------------------------------------------------------------------------------------------------
+// sxt_curve25519_scalar_inner_product
+//--------------------------------------------------------------------------------------------------
+void sxt_curve25519_scalar_inner_product(struct sxt_curve25519_scalar* res, uint64_t n,
+                                         const struct sxt_curve25519_scalar* lhs,
+                                         const struct sxt_curve25519_scalar* rhs) {
+  SXT_RELEASE_ASSERT(res != nullptr);
+  SXT_RELEASE_ASSERT(n == 0 || (lhs != nullptr && rhs != nullptr));
+  // the reduction indexes scalars with unsigned ints
+  SXT_RELEASE_ASSERT(n <= std::numeric_limits<unsigned>::max());
+  auto& res_p = *reinterpret_cast<s25t::element*>(res);
+  if (n == 0) {
+    res_p = s25t::element::identity();
+    return;
+  }
+  s25o::inner_product(res_p, cbn::to_span(lhs, n), cbn::to_span(rhs, n));
+}
+
+//--------------------------------------------------------------------------------------------------
+// sxt_curve25519_scalar_batch_fold
+//--------------------------------------------------------------------------------------------------
+void sxt_curve25519_scalar_batch_fold(struct sxt_curve25519_scalar* res, uint64_t n,
+                                      const struct sxt_curve25519_scalar* m_low,
+                                      const struct sxt_curve25519_scalar* m_high,
+                                      const struct sxt_curve25519_scalar* low, uint64_t n_high,
+                                      const struct sxt_curve25519_scalar* high) {
+  SXT_RELEASE_ASSERT(n_high <= n);
+  SXT_RELEASE_ASSERT(n == 0 || (res != nullptr && low != nullptr));
+  SXT_RELEASE_ASSERT(n_high == 0 || high != nullptr);
+  s25o::batch_fold(cbn::to_span(res, n), cbn::to_element(m_low), cbn::to_element(m_high),
+                   cbn::to_span(low, n), cbn::to_span(high, n_high));
+}
+
+//--------------------------------------------------------------------------------------------------
+// sxt_curve25519_scalar_batch_inv
+//--------------------------------------------------------------------------------------------------
+void sxt_curve25519_scalar_batch_inv(struct sxt_curve25519_scalar* res, uint64_t n,
+                                     const struct sxt_curve25519_scalar* x) {
+  SXT_RELEASE_ASSERT(n == 0 || (res != nullptr && x != nullptr));
+  s25o::batch_inv(cbn::to_span(res, n), cbn::to_span(x, n));
+}
@@ -0,0 +1,104 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "cbindings/scalar_arithmetic.h"
+
+#include <vector>
+
+#include "sxt/base/num/fast_random_number_generator.h"
+#include "sxt/base/test/unit_test.h"
+#include "sxt/scalar25/operation/inv.h"
+#include "sxt/scalar25/operation/overload.h"
+#include "sxt/scalar25/random/element.h"
+#include "sxt/scalar25/type/element.h"
+#include "sxt/scalar25/type/literal.h"
+
+using namespace sxt;
+using s25t::operator""_s25;
+
+static sxt_curve25519_scalar* to_c(std::vector<s25t::element>& v) noexcept {
+  return reinterpret_cast<sxt_curve25519_scalar*>(v.data());
+}
+
+static const sxt_curve25519_scalar* to_c(const s25t::element& e) noexcept {
+  return reinterpret_cast<const sxt_curve25519_scalar*>(&e);
+}
+
+TEST_CASE("we can perform batch scalar arithmetic through the C API") {
+  basn::fast_random_number_generator rng{1, 2};
+  const uint64_t n = 10;
+  std::vector<s25t::element> x(n), y(n), res(n);
+  s25rn::generate_random_elements(x, rng);
+  s25rn::generate_random_elements(y, rng);
+  auto a = 0x123_s25;
+  auto b = 0x456_s25;
+
+  SECTION("we can add, subtract, and multiply") {
+    sxt_curve25519_scalar_batch_add(to_c(res), n, to_c(x), to_c(y));
+    for (size_t i = 0; i < n; ++i) {
+      REQUIRE(res[i] == x[i] + y[i]);
+    }
+    sxt_curve25519_scalar_batch_sub(to_c(res), n, to_c(x), to_c(y));
+    for (size_t i = 0; i < n; ++i) {
+      REQUIRE(res[i] == x[i] - y[i]);
+    }
+    sxt_curve25519_scalar_batch_mul(to_c(res), n, to_c(x), to_c(y));
+    for (size_t i = 0; i < n; ++i) {
+      REQUIRE(res[i] == x[i] * y[i]);
+    }
+  }
+
+  SECTION("we can multiply-add by a scalar") {
+    sxt_curve25519_scalar_batch_muladd(to_c(res), n, to_c(a), to_c(x), to_c(y));
+    for (size_t i = 0; i < n; ++i) {
+      REQUIRE(res[i] == a * x[i] + y[i]);
+    }
+  }
+
+  SECTION("we can compute an inner product") {
+    s25t::element expected = 0x0_s25;
+    for (size_t i = 0; i < n; ++i) {
+      expected = expected + x[i] * y[i];
+    }
+    s25t::element ip;
+    sxt_curve25519_scalar_inner_product(reinterpret_cast<sxt_curve25519_scalar*>(&ip), n, to_c(x),
+                                        to_c(y));
+    REQUIRE(ip == expected);
+    sxt_curve25519_scalar_inner_product(reinterpret_cast<sxt_curve25519_scalar*>(&ip), 0, nullptr,
+                                        nullptr);
+    REQUIRE(ip == 0x0_s25);
+  }
+
+  SECTION("we can fold") {
+    sxt_curve25519_scalar_batch_fold(to_c(res), n, to_c(a), to_c(b), to_c(x), 3, to_c(y));
+    for (size_t i = 0; i < n; ++i) {
+      if (i < 3) {
+        REQUIRE(res[i] == a * x[i] + b * y[i]);
+      } else {
+        REQUIRE(res[i] == a * x[i]);
+      }
+    }
+  }
+
+  SECTION("we can invert") {
+    sxt_curve25519_scalar_batch_inv(to_c(res), n, to_c(x));
+    for (size_t i = 0; i < n; ++i) {
+      s25t::element expected;
+      s25o::inv(expected, x[i]);
+      REQUIRE(res[i] == expected);
+    }
+  }
+}
@@ -0,0 +1,61 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+
+#include "sxt/algorithm/base/index_functor.h"
+#include "sxt/base/iterator/chunk_options.h"
+#include "sxt/base/iterator/index_range.h"
+#include "sxt/execution/async/future.h"
+#include "sxt/execution/thread/parallel_for.h"
+
+namespace sxt::algi {
+//--------------------------------------------------------------------------------------------------
+// host_iteration_min_chunk_size_v
+//--------------------------------------------------------------------------------------------------
+/**
+ * Default minimum number of indexes a thread visits so that thread startup is amortized.
+ */
+constexpr size_t host_iteration_min_chunk_size_v = 1024;
+
+//--------------------------------------------------------------------------------------------------
+// host_for_each
+//--------------------------------------------------------------------------------------------------
+/**
+ * Host counterpart of for_each: invoke f(n, i) for every index, with contiguous chunks of
+ * indexes visited by separate threads.
+ */
+template <algb::index_functor F>
+xena::future<> host_for_each(basit::chunk_options chunk_options, F f, unsigned n) noexcept {
+  xent::parallel_for(basit::index_range{0, n}
+                         .min_chunk_size(chunk_options.min_size)
+                         .max_chunk_size(chunk_options.max_size),
+                     [&](basit::index_range rng) noexcept {
+                       auto a = static_cast<unsigned>(rng.a());
+                       auto b = static_cast<unsigned>(rng.b());
+                       for (unsigned i = a; i < b; ++i) {
+                         f(n, i);
+                       }
+                     });
+  return xena::make_ready_future();
+}
+
+template <algb::index_functor F> xena::future<> host_for_each(F f, unsigned n) noexcept {
+  return host_for_each(basit::chunk_options{.min_size = host_iteration_min_chunk_size_v}, f, n);
+}
+} // namespace sxt::algi
@@ -0,0 +1,44 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/algorithm/iteration/host_for_each.h"
+
+#include <atomic>
+#include <vector>
+
+#include "sxt/base/test/unit_test.h"
+
+using namespace sxt;
+using namespace sxt::algi;
+
+TEST_CASE("we can iterate over indexes on the host") {
+  SECTION("we handle the empty case") {
+    auto f = [](unsigned /*n*/, unsigned /*i*/) noexcept {};
+    auto fut = host_for_each(f, 0);
+    REQUIRE(fut.ready());
+  }
+
+  SECTION("we visit every index once") {
+    std::vector<std::atomic<unsigned>> counts(100);
+    auto f = [&](unsigned n, unsigned i) noexcept { counts[i] += n; };
+    auto fut = host_for_each(basit::chunk_options{.min_size = 1, .max_size = 3}, f,
+                             static_cast<unsigned>(counts.size()));
+    REQUIRE(fut.ready());
+    for (auto& count : counts) {
+      REQUIRE(count == 100);
+    }
+  }
+}
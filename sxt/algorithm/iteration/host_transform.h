@@ -0,0 +1,72 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <algorithm>
+#include <tuple>
+
+#include "sxt/algorithm/base/transform_functor.h"
+#include "sxt/algorithm/iteration/host_for_each.h"
+#include "sxt/base/container/span.h"
+#include "sxt/base/error/assert.h"
+#include "sxt/base/iterator/chunk_options.h"
+#include "sxt/base/type/value_type.h"
+#include "sxt/execution/async/future.h"
+
+namespace sxt::algi {
+//--------------------------------------------------------------------------------------------------
+// host_transform
+//--------------------------------------------------------------------------------------------------
+/**
+ * Host counterpart of transform: res is assigned x1 and then f(res[i], xrest[i]...) is applied
+ * over chunks of indexes in parallel.
+ *
+ * As with the device version, f sees its own copy of the remaining arguments so that it can't
+ * modify the inputs.
+ */
+template <class F, class Arg1, class... ArgsRest>
+  requires algb::transform_functor<F, bast::value_type_t<Arg1>, bast::value_type_t<ArgsRest>...>
+xena::future<> host_transform(basct::span<bast::value_type_t<Arg1>> res,
+                              basit::chunk_options chunk_options, F f, const Arg1& x1,
+                              const ArgsRest&... xrest) noexcept {
+  auto n = res.size();
+  SXT_DEBUG_ASSERT(x1.size() == n && ((xrest.size() == n) && ...));
+  if (n == 0) {
+    return xena::make_ready_future();
+  }
+  auto srcs = std::make_tuple(xrest.data()...);
+  auto x1_data = x1.data();
+  auto fp = [&](unsigned /*n*/, unsigned i) noexcept {
+    if (res.data() != x1_data) {
+      res[i] = x1_data[i];
+    }
+    std::apply([&](const auto*... ptrs) noexcept {
+      auto ys = std::make_tuple(ptrs[i]...);
+      std::apply([&](auto&... yi) noexcept { f(res[i], yi...); }, ys);
+    }, srcs);
+  };
+  return host_for_each(chunk_options, fp, static_cast<unsigned>(n));
+}
+
+template <class F, class Arg1, class... ArgsRest>
+  requires algb::transform_functor<F, bast::value_type_t<Arg1>, bast::value_type_t<ArgsRest>...>
+xena::future<> host_transform(basct::span<bast::value_type_t<Arg1>> res, F f, const Arg1& x1,
+                              const ArgsRest&... xrest) noexcept {
+  return host_transform(res, basit::chunk_options{.min_size = host_iteration_min_chunk_size_v}, f,
+                        x1, xrest...);
+}
+} // namespace sxt::algi
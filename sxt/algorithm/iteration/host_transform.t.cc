@@ -0,0 +1,74 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/algorithm/iteration/host_transform.h"
+
+#include <vector>
+
+#include "sxt/base/test/unit_test.h"
+
+using namespace sxt;
+using namespace sxt::algi;
+
+TEST_CASE("we can transform contiguous regions of memory on the host") {
+  std::vector<double> res;
+  basit::chunk_options chunk_options;
+
+  SECTION("we handle the empty case") {
+    auto f = [](double& x) noexcept { x *= 2; };
+    auto fut = host_transform(res, chunk_options, f, res);
+    REQUIRE(fut.ready());
+  }
+
+  SECTION("we can transform a vector in place") {
+    res = {123};
+    auto f = [](double& x) noexcept { x *= 2; };
+    auto fut = host_transform(res, chunk_options, f, res);
+    REQUIRE(fut.ready());
+    REQUIRE(res[0] == 246);
+  }
+
+  SECTION("we can transform two vectors without modifying the inputs") {
+    res.resize(100);
+    std::vector<double> x(100);
+    std::vector<double> y(100);
+    for (size_t i = 0; i < x.size(); ++i) {
+      x[i] = static_cast<double>(i);
+      y[i] = 2.0 * static_cast<double>(i);
+    }
+    auto f = [](double& a, double& b) noexcept {
+      a = a + b;
+      b = 0;
+    };
+    chunk_options.max_size = 3;
+    auto fut = host_transform(res, chunk_options, f, x, y);
+    REQUIRE(fut.ready());
+    for (size_t i = 0; i < res.size(); ++i) {
+      REQUIRE(res[i] == 3.0 * static_cast<double>(i));
+      REQUIRE(x[i] == static_cast<double>(i));
+      REQUIRE(y[i] == 2.0 * static_cast<double>(i));
+    }
+  }
+
+  SECTION("we can use the default chunk options") {
+    res = {1, 2};
+    std::vector<double> y = {3, 4};
+    auto f = [](double& a, double& b) noexcept { a *= b; };
+    auto fut = host_transform(res, f, res, y);
+    REQUIRE(fut.ready());
+    REQUIRE(res == std::vector<double>{3, 8});
+  }
+}
@@ -0,0 +1,98 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <vector>
+
+#include "sxt/algorithm/base/mapper.h"
+#include "sxt/algorithm/base/reducer.h"
+#include "sxt/algorithm/base/reducer_utility.h"
+#include "sxt/base/error/assert.h"
+#include "sxt/base/iterator/chunk_options.h"
+#include "sxt/base/iterator/index_range.h"
+#include "sxt/base/iterator/index_range_iterator.h"
+#include "sxt/base/iterator/index_range_utility.h"
+#include "sxt/execution/async/future.h"
+#include "sxt/execution/thread/parallel_for.h"
+
+namespace sxt::algr {
+//--------------------------------------------------------------------------------------------------
+// host_reduction_min_chunk_size_v
+//--------------------------------------------------------------------------------------------------
+/**
+ * Default minimum number of elements a thread reduces so that thread startup is amortized.
+ */
+constexpr size_t host_reduction_min_chunk_size_v = 1024;
+
+//--------------------------------------------------------------------------------------------------
+// host_reduce_chunk
+//--------------------------------------------------------------------------------------------------
+template <algb::reducer Reducer, algb::mapper Mapper>
+  requires std::same_as<typename Reducer::value_type, typename Mapper::value_type>
+void host_reduce_chunk(typename Reducer::value_type& res, Mapper mapper,
+                       basit::index_range rng) noexcept {
+  SXT_DEBUG_ASSERT(rng.size() > 0);
+  auto a = static_cast<unsigned>(rng.a());
+  auto b = static_cast<unsigned>(rng.b());
+  mapper.map_index(res, a);
+  typename Reducer::value_type e;
+  for (unsigned i = a + 1; i < b; ++i) {
+    algb::accumulate<Reducer>(res, e, mapper, i);
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// host_reduce
+//--------------------------------------------------------------------------------------------------
+/**
+ * Host counterpart of reduce: each thread reduces a contiguous chunk and the partial results are
+ * combined in chunk order, so the result is deterministic for a given chunking.
+ */
+template <algb::reducer Reducer, algb::mapper Mapper>
+  requires std::same_as<typename Reducer::value_type, typename Mapper::value_type>
+xena::future<typename Reducer::value_type>
+host_reduce(basit::chunk_options chunk_options, Mapper mapper, unsigned n) noexcept {
+  using T = typename Reducer::value_type;
+  SXT_RELEASE_ASSERT(n > 0);
+  auto [chunk_first, chunk_last] =
+      basit::split(basit::index_range{0, n}
+                       .min_chunk_size(chunk_options.min_size)
+                       .max_chunk_size(chunk_options.max_size),
+                   xent::get_num_threads());
+  std::vector<basit::index_range> chunks(chunk_first, chunk_last);
+  std::vector<T> partials(chunks.size());
+  xent::parallel_for(basit::index_range{0, chunks.size()}.max_chunk_size(1),
+                     [&](basit::index_range rng) noexcept {
+                       auto j = rng.a();
+                       host_reduce_chunk<Reducer>(partials[j], mapper, chunks[j]);
+                     });
+  auto res = partials[0];
+  for (size_t j = 1; j < partials.size(); ++j) {
+    Reducer::accumulate_inplace(res, partials[j]);
+  }
+  return xena::make_ready_future(std::move(res));
+}
+
+template <algb::reducer Reducer, algb::mapper Mapper>
+  requires std::same_as<typename Reducer::value_type, typename Mapper::value_type>
+xena::future<typename Reducer::value_type> host_reduce(Mapper mapper, unsigned n) noexcept {
+  return host_reduce<Reducer>(basit::chunk_options{.min_size = host_reduction_min_chunk_size_v},
+                              mapper, n);
+}
+} // namespace sxt::algr
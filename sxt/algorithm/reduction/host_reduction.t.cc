@@ -0,0 +1,68 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/algorithm/reduction/host_reduction.h"
+
+#include "sxt/algorithm/base/identity_mapper.h"
+#include "sxt/algorithm/reduction/test_reducer.h"
+#include "sxt/base/test/unit_test.h"
+#include "sxt/memory/management/managed_array.h"
+
+using namespace sxt;
+using namespace sxt::algr;
+
+TEST_CASE("we can reduce on the host") {
+  SECTION("we can reduce a single element") {
+    memmg::managed_array<uint64_t> data = {123};
+    auto fut = host_reduce<test_add_reducer>(algb::identity_mapper{data.data()}, 1);
+    REQUIRE(fut.ready());
+    REQUIRE(fut.value() == 123);
+  }
+
+  SECTION("we can reduce many elements split across chunks") {
+    memmg::managed_array<uint64_t> data(1000);
+    uint64_t expected = 0;
+    for (size_t i = 0; i < data.size(); ++i) {
+      data[i] = i * i + 1;
+      expected += data[i];
+    }
+    basit::chunk_options chunk_options{.min_size = 1, .max_size = 7};
+    auto fut = host_reduce<test_add_reducer>(chunk_options, algb::identity_mapper{data.data()},
+                                             static_cast<unsigned>(data.size()));
+    REQUIRE(fut.value() == expected);
+
+    fut = host_reduce<test_add_reducer>(algb::identity_mapper{data.data()},
+                                        static_cast<unsigned>(data.size()));
+    REQUIRE(fut.value() == expected);
+  }
+
+  SECTION("we use a reducer's specialized accumulate") {
+    struct double_reducer {
+      using value_type = uint64_t;
+
+      static void accumulate_inplace(uint64_t& res, uint64_t& /*e*/,
+                                     algb::identity_mapper<uint64_t> m,
+                                     unsigned i) noexcept {
+        res += 2 * m.map_index(i);
+      }
+
+      static void accumulate_inplace(uint64_t& res, uint64_t& e) noexcept { res += e; }
+    };
+    memmg::managed_array<uint64_t> data = {1, 2, 3};
+    auto fut = host_reduce<double_reducer>(algb::identity_mapper{data.data()}, 3);
+    REQUIRE(fut.value() == 1 + 4 + 6);
+  }
+}
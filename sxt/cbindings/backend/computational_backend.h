@@ -20,10 +20,14 @@
 #include <vector>
 
 #include "sxt/base/container/span.h"
+#include "sxt/base/functional/function_ref.h"
+#include "sxt/multiexp/curve/engine.h"
 
 namespace sxt::mtxb {
 struct exponent_sequence;
-}
+struct packed_sequence;
+template <class T> class segmented_generators;
+} // namespace sxt::mtxb
 
 namespace sxt::rstt {
 class compressed_element;
@@ -52,6 +56,16 @@ struct proof_descriptor;
 
 namespace sxt::cbnbck {
 
+//--------------------------------------------------------------------------------------------------
+// exponent_slicer
+//--------------------------------------------------------------------------------------------------
+/**
+ * slice(res, first, size) writes the terms [first, first + size) of each exponent sequence into
+ * res. The sequences it writes only need to stay valid until its next call.
+ */
+using exponent_slicer =
+    basf::function_ref<void(basct::span<mtxb::exponent_sequence>, size_t, size_t)>;
+
 //--------------------------------------------------------------------------------------------------
 // computational_backend
 //--------------------------------------------------------------------------------------------------
@@ -67,10 +81,39 @@ public:
                                    basct::cspan<mtxb::exponent_sequence> value_sequences,
                                    basct::cspan<cg1t::element_p2> generators) const noexcept = 0;
 
+  virtual void compute_multiexponentiation(basct::span<c21t::element_p3> res,
+                                           basct::cspan<mtxb::exponent_sequence> exponents,
+                                           basct::cspan<c21t::element_p3> generators,
+                                           mtxcrv::engine_t engine) const noexcept = 0;
+
+  virtual void compute_multiexponentiation(basct::span<cg1t::element_p2> res,
+                                           basct::cspan<mtxb::exponent_sequence> exponents,
+                                           basct::cspan<cg1t::element_p2> generators,
+                                           mtxcrv::engine_t engine) const noexcept = 0;
+
   virtual basct::cspan<c21t::element_p3>
   get_precomputed_generators(std::vector<c21t::element_p3>& temp_generators, uint64_t n,
                              uint64_t offset_generators) const noexcept = 0;
 
+  virtual void
+  compute_multiexponentiation(basct::span<c21t::element_p3> res,
+                              basct::cspan<mtxb::exponent_sequence> exponents,
+                              const mtxb::segmented_generators<c21t::element_p3>& generators,
+                              mtxcrv::engine_t engine) const noexcept = 0;
+
+  virtual void
+  compute_multiexponentiation(basct::span<c21t::element_p3> res,
+                              basct::cspan<mtxb::packed_sequence> exponents,
+                              const mtxb::segmented_generators<c21t::element_p3>& generators,
+                              mtxcrv::engine_t engine) const noexcept = 0;
+
+  virtual void compute_multiexponentiation(
+      basct::span<c21t::element_p3> res, size_t n, exponent_slicer slice,
+      const mtxb::segmented_generators<c21t::element_p3>& generators) const noexcept = 0;
+
+  virtual mtxb::segmented_generators<c21t::element_p3>
+  get_precomputed_generator_segments(uint64_t n, uint64_t offset_generators) const noexcept = 0;
+
   virtual void prove_inner_product(basct::span<rstt::compressed_element> l_vector,
                                    basct::span<rstt::compressed_element> r_vector,
                                    s25t::element& ap_value, prft::transcript& transcript,
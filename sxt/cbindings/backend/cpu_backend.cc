@@ -16,6 +16,7 @@
  */
 #include "sxt/cbindings/backend/cpu_backend.h"
 
+#include <algorithm>
 #include <cstring>
 #include <vector>
 
@@ -32,7 +33,12 @@
 #include "sxt/execution/async/future.h"
 #include "sxt/memory/management/managed_array.h"
 #include "sxt/multiexp/base/exponent_sequence.h"
+#include "sxt/multiexp/base/packed_sequence.h"
+#include "sxt/multiexp/base/segmented_generators.h"
+#include "sxt/multiexp/curve/engine_calibration.h"
 #include "sxt/multiexp/curve/multiexponentiation.h"
+#include "sxt/multiexp/curve/pipelined_multiexponentiation.h"
+#include "sxt/multiexp/curve/pippenger_multiproduct_solver.h"
 #include "sxt/proof/inner_product/cpu_driver.h"
 #include "sxt/proof/inner_product/proof_computation.h"
 #include "sxt/proof/inner_product/proof_descriptor.h"
@@ -49,7 +55,9 @@ namespace sxt::cbnbck {
 void cpu_backend::compute_commitments(basct::span<rstt::compressed_element> commitments,
                                       basct::cspan<mtxb::exponent_sequence> value_sequences,
                                       basct::cspan<c21t::element_p3> generators) const noexcept {
-  auto values = mtxcrv::compute_multiexponentiation<c21t::element_p3>(generators, value_sequences);
+  auto engine = resolve_cpu_engine<c21t::element_p3>(mtxcrv::engine_t::automatic);
+  auto values =
+      mtxcrv::compute_multiexponentiation<c21t::element_p3>(generators, value_sequences, engine);
   rsto::batch_compress(commitments, values);
 }
 
@@ -59,10 +67,38 @@ void cpu_backend::compute_commitments(basct::span<rstt::compressed_element> comm
 void cpu_backend::compute_commitments(basct::span<cg1t::compressed_element> commitments,
                                       basct::cspan<mtxb::exponent_sequence> value_sequences,
                                       basct::cspan<cg1t::element_p2> generators) const noexcept {
-  auto values = mtxcrv::compute_multiexponentiation<cg1t::element_p2>(generators, value_sequences);
+  auto engine = resolve_cpu_engine<cg1t::element_p2>(mtxcrv::engine_t::automatic);
+  auto values =
+      mtxcrv::compute_multiexponentiation<cg1t::element_p2>(generators, value_sequences, engine);
   cg1o::batch_compress(commitments, values);
 }
 
+//--------------------------------------------------------------------------------------------------
+// compute_multiexponentiation
+//--------------------------------------------------------------------------------------------------
+void cpu_backend::compute_multiexponentiation(basct::span<c21t::element_p3> res,
+                                              basct::cspan<mtxb::exponent_sequence> exponents,
+                                              basct::cspan<c21t::element_p3> generators,
+                                              mtxcrv::engine_t engine) const noexcept {
+  auto values = mtxcrv::compute_multiexponentiation<c21t::element_p3>(
+      generators, exponents, resolve_cpu_engine<c21t::element_p3>(engine));
+  SXT_DEBUG_ASSERT(res.size() == values.size());
+  std::copy(values.begin(), values.end(), res.begin());
+}
+
+//--------------------------------------------------------------------------------------------------
+// compute_multiexponentiation
+//--------------------------------------------------------------------------------------------------
+void cpu_backend::compute_multiexponentiation(basct::span<cg1t::element_p2> res,
+                                              basct::cspan<mtxb::exponent_sequence> exponents,
+                                              basct::cspan<cg1t::element_p2> generators,
+                                              mtxcrv::engine_t engine) const noexcept {
+  auto values = mtxcrv::compute_multiexponentiation<cg1t::element_p2>(
+      generators, exponents, resolve_cpu_engine<cg1t::element_p2>(engine));
+  SXT_DEBUG_ASSERT(res.size() == values.size());
+  std::copy(values.begin(), values.end(), res.begin());
+}
+
 //--------------------------------------------------------------------------------------------------
 // get_precomputed_generators
 //--------------------------------------------------------------------------------------------------
@@ -72,6 +108,62 @@ cpu_backend::get_precomputed_generators(std::vector<c21t::element_p3>& temp_gene
   return sqcgn::get_precomputed_generators(temp_generators, n, offset_generators, false);
 }
 
+//--------------------------------------------------------------------------------------------------
+// compute_multiexponentiation
+//--------------------------------------------------------------------------------------------------
+void cpu_backend::compute_multiexponentiation(
+    basct::span<c21t::element_p3> res, basct::cspan<mtxb::exponent_sequence> exponents,
+    const mtxb::segmented_generators<c21t::element_p3>& generators,
+    mtxcrv::engine_t engine) const noexcept {
+  auto values = mtxcrv::compute_multiexponentiation<c21t::element_p3>(
+      generators, exponents, resolve_cpu_engine<c21t::element_p3>(engine));
+  SXT_DEBUG_ASSERT(res.size() == values.size());
+  std::copy(values.begin(), values.end(), res.begin());
+}
+
+//--------------------------------------------------------------------------------------------------
+// compute_multiexponentiation
+//--------------------------------------------------------------------------------------------------
+void cpu_backend::compute_multiexponentiation(
+    basct::span<c21t::element_p3> res, basct::cspan<mtxb::packed_sequence> exponents,
+    const mtxb::segmented_generators<c21t::element_p3>& generators,
+    mtxcrv::engine_t engine) const noexcept {
+  auto values = mtxcrv::compute_multiexponentiation<c21t::element_p3>(
+      generators, exponents, resolve_cpu_engine<c21t::element_p3>(engine));
+  SXT_DEBUG_ASSERT(res.size() == values.size());
+  std::copy(values.begin(), values.end(), res.begin());
+}
+
+//--------------------------------------------------------------------------------------------------
+// compute_multiexponentiation
+//--------------------------------------------------------------------------------------------------
+void cpu_backend::compute_multiexponentiation(
+    basct::span<c21t::element_p3> res, size_t n, exponent_slicer slice,
+    const mtxb::segmented_generators<c21t::element_p3>& generators) const noexcept {
+  // a problem that fits in a single chunk is sliced once and computed like any other
+  if (n <= mtxcrv::pipelined_multiexponentiation_chunk_size_v) {
+    memmg::managed_array<mtxb::exponent_sequence> exponents(res.size());
+    slice(exponents, 0, n);
+    this->compute_multiexponentiation(res, exponents, generators, mtxcrv::engine_t::automatic);
+    return;
+  }
+  mtxcrv::pippenger_multiproduct_solver<c21t::element_p3> solver;
+  auto values = mtxcrv::compute_multiexponentiation_pipelined_impl<c21t::element_p3>(
+      generators, res.size(), n, slice, solver,
+      mtxcrv::pipelined_multiexponentiation_chunk_size_v);
+  SXT_DEBUG_ASSERT(res.size() == values.size());
+  std::copy(values.begin(), values.end(), res.begin());
+}
+
+//--------------------------------------------------------------------------------------------------
+// get_precomputed_generator_segments
+//--------------------------------------------------------------------------------------------------
+mtxb::segmented_generators<c21t::element_p3>
+cpu_backend::get_precomputed_generator_segments(uint64_t n,
+                                                uint64_t offset_generators) const noexcept {
+  return sqcgn::get_precomputed_generator_segments(n, offset_generators, false);
+}
+
 //--------------------------------------------------------------------------------------------------
 // prove_inner_product
 //--------------------------------------------------------------------------------------------------
@@ -21,10 +21,14 @@
 
 #include "sxt/base/container/span.h"
 #include "sxt/cbindings/backend/computational_backend.h"
+#include "sxt/multiexp/curve/engine.h"
+#include "sxt/multiexp/curve/engine_calibration.h"
 
 namespace sxt::mtxb {
 struct exponent_sequence;
-}
+struct packed_sequence;
+template <class T> class segmented_generators;
+} // namespace sxt::mtxb
 
 namespace sxt::rstt {
 class compressed_element;
@@ -52,6 +56,23 @@ struct proof_descriptor;
 }
 
 namespace sxt::cbnbck {
+//--------------------------------------------------------------------------------------------------
+// resolve_cpu_engine
+//--------------------------------------------------------------------------------------------------
+/**
+ * The engine the cpu backend runs a multiexponentiation over Element with.
+ *
+ * Without a calibration installed for Element, an automatic engine is Pippenger's algorithm at
+ * every size, so a commitment runs the same engine whichever path computes it. With one, the
+ * engine is passed through and resolved by the calibration.
+ */
+template <class Element> mtxcrv::engine_t resolve_cpu_engine(mtxcrv::engine_t engine) noexcept {
+  if (engine == mtxcrv::engine_t::automatic &&
+      mtxcrv::get_engine_calibration<Element>() == nullptr) {
+    return mtxcrv::engine_t::pippenger;
+  }
+  return engine;
+}
 
 //--------------------------------------------------------------------------------------------------
 // cpu_backend
@@ -66,10 +87,38 @@ public:
                            basct::cspan<mtxb::exponent_sequence> value_sequences,
                            basct::cspan<cg1t::element_p2> generators) const noexcept override;
 
+  void compute_multiexponentiation(basct::span<c21t::element_p3> res,
+                                   basct::cspan<mtxb::exponent_sequence> exponents,
+                                   basct::cspan<c21t::element_p3> generators,
+                                   mtxcrv::engine_t engine) const noexcept override;
+
+  void compute_multiexponentiation(basct::span<cg1t::element_p2> res,
+                                   basct::cspan<mtxb::exponent_sequence> exponents,
+                                   basct::cspan<cg1t::element_p2> generators,
+                                   mtxcrv::engine_t engine) const noexcept override;
+
   basct::cspan<c21t::element_p3>
   get_precomputed_generators(std::vector<c21t::element_p3>& temp_generators, uint64_t n,
                              uint64_t offset_generators) const noexcept override;
 
+  void compute_multiexponentiation(basct::span<c21t::element_p3> res,
+                                   basct::cspan<mtxb::exponent_sequence> exponents,
+                                   const mtxb::segmented_generators<c21t::element_p3>& generators,
+                                   mtxcrv::engine_t engine) const noexcept override;
+
+  void compute_multiexponentiation(basct::span<c21t::element_p3> res,
+                                   basct::cspan<mtxb::packed_sequence> exponents,
+                                   const mtxb::segmented_generators<c21t::element_p3>& generators,
+                                   mtxcrv::engine_t engine) const noexcept override;
+
+  void compute_multiexponentiation(
+      basct::span<c21t::element_p3> res, size_t n, exponent_slicer slice,
+      const mtxb::segmented_generators<c21t::element_p3>& generators) const noexcept override;
+
+  mtxb::segmented_generators<c21t::element_p3>
+  get_precomputed_generator_segments(uint64_t n,
+                                     uint64_t offset_generators) const noexcept override;
+
   void prove_inner_product(basct::span<rstt::compressed_element> l_vector,
                            basct::span<rstt::compressed_element> r_vector, s25t::element& ap_value,
                            prft::transcript& transcript, const prfip::proof_descriptor& descriptor,
@@ -0,0 +1,122 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/cbindings/backend/cpu_backend.h"
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "sxt/base/test/unit_test.h"
+#include "sxt/curve21/operation/add.h"
+#include "sxt/curve21/operation/double.h"
+#include "sxt/curve21/operation/neg.h"
+#include "sxt/curve21/type/element_p3.h"
+#include "sxt/multiexp/base/exponent_sequence.h"
+#include "sxt/multiexp/base/segmented_generators.h"
+#include "sxt/multiexp/curve/engine_calibration.h"
+#include "sxt/multiexp/curve/multiexponentiation.h"
+#include "sxt/ristretto/operation/compression.h"
+#include "sxt/ristretto/random/element.h"
+#include "sxt/ristretto/type/compressed_element.h"
+
+using namespace sxt;
+using namespace sxt::cbnbck;
+
+//--------------------------------------------------------------------------------------------------
+// is_same_representation
+//--------------------------------------------------------------------------------------------------
+/**
+ * Engines add the terms in different orders, so they yield different projective representations
+ * of the same point; comparing representations tells which engine computed a value.
+ */
+static bool is_same_representation(const c21t::element_p3& lhs,
+                                   const c21t::element_p3& rhs) noexcept {
+  return std::memcmp(&lhs, &rhs, sizeof(c21t::element_p3)) == 0;
+}
+
+TEST_CASE("the cpu backend runs the same engine on every commitment path") {
+  mtxcrv::reset_engine_calibration_for_testing<c21t::element_p3>();
+  cpu_backend backend;
+
+  std::mt19937 rng{9873324};
+  std::vector<c21t::element_p3> generators(8);
+  rstrn::generate_random_elements(generators, rng);
+  std::vector<uint8_t> data(generators.size() * 4);
+  std::generate(data.begin(), data.end(), [&]() noexcept { return static_cast<uint8_t>(rng()); });
+  mtxb::exponent_sequence exponents{
+      .element_nbytes = 4, .n = generators.size(), .data = data.data(), .is_signed = 0};
+  mtxb::segmented_generators<c21t::element_p3> segments{
+      basct::cspan<c21t::element_p3>{generators}.subspan(0, 2), generators.size(),
+      [&](basct::span<c21t::element_p3> tail, size_t first) noexcept {
+        std::copy_n(generators.begin() + first, tail.size(), tail.begin());
+      }};
+
+  // the exponents are small enough for the host's automatic engine to pick the naive engine
+  auto pippenger = mtxcrv::compute_multiexponentiation<c21t::element_p3>(
+      generators, {&exponents, 1}, mtxcrv::engine_t::pippenger);
+  auto naive = mtxcrv::compute_multiexponentiation<c21t::element_p3>(
+      generators, {&exponents, 1}, mtxcrv::engine_t::naive);
+  REQUIRE(!is_same_representation(pippenger[0], naive[0]));
+  auto segmented_pippenger = mtxcrv::compute_multiexponentiation<c21t::element_p3>(
+      segments, {&exponents, 1}, mtxcrv::engine_t::pippenger);
+  auto segmented_naive = mtxcrv::compute_multiexponentiation<c21t::element_p3>(
+      segments, {&exponents, 1}, mtxcrv::engine_t::naive);
+  REQUIRE(!is_same_representation(segmented_pippenger[0], segmented_naive[0]));
+
+  SECTION("without a calibration, automatic is pippenger's algorithm") {
+    REQUIRE(resolve_cpu_engine<c21t::element_p3>(mtxcrv::engine_t::automatic) ==
+            mtxcrv::engine_t::pippenger);
+    REQUIRE(resolve_cpu_engine<c21t::element_p3>(mtxcrv::engine_t::naive) ==
+            mtxcrv::engine_t::naive);
+
+    rstt::compressed_element commitment, expected;
+    backend.compute_commitments({&commitment, 1}, {&exponents, 1}, generators);
+    rsto::compress(expected, pippenger[0]);
+    REQUIRE(commitment == expected);
+
+    c21t::element_p3 value;
+    backend.compute_multiexponentiation({&value, 1}, {&exponents, 1}, generators,
+                                        mtxcrv::engine_t::automatic);
+    REQUIRE(is_same_representation(value, pippenger[0]));
+
+    backend.compute_multiexponentiation({&value, 1}, {&exponents, 1}, segments,
+                                        mtxcrv::engine_t::automatic);
+    REQUIRE(is_same_representation(value, segmented_pippenger[0]));
+  }
+
+  SECTION("with a calibration, automatic is the calibrated engine") {
+    mtxcrv::engine_calibration calibration;
+    for (size_t shape_index = 0; shape_index < mtxcrv::engine_calibration::num_shapes_v;
+         ++shape_index) {
+      calibration.set_engine(shape_index, mtxcrv::engine_t::naive);
+    }
+    mtxcrv::set_engine_calibration<c21t::element_p3>(calibration);
+    REQUIRE(resolve_cpu_engine<c21t::element_p3>(mtxcrv::engine_t::automatic) ==
+            mtxcrv::engine_t::automatic);
+
+    c21t::element_p3 value;
+    backend.compute_multiexponentiation({&value, 1}, {&exponents, 1}, generators,
+                                        mtxcrv::engine_t::automatic);
+    REQUIRE(is_same_representation(value, naive[0]));
+
+    backend.compute_multiexponentiation({&value, 1}, {&exponents, 1}, segments,
+                                        mtxcrv::engine_t::automatic);
+    REQUIRE(is_same_representation(value, segmented_naive[0]));
+    mtxcrv::reset_engine_calibration_for_testing<c21t::element_p3>();
+  }
+}
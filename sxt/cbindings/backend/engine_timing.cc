@@ -0,0 +1,133 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/cbindings/backend/engine_timing.h"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <vector>
+
+#include "sxt/base/error/assert.h"
+#include "sxt/base/num/fast_random_number_generator.h"
+#include "sxt/cbindings/backend/computational_backend.h"
+#include "sxt/curve21/type/element_p3.h"
+#include "sxt/curve_g1/constant/generator.h"
+#include "sxt/curve_g1/operation/add.h"
+#include "sxt/curve_g1/type/element_p2.h"
+#include "sxt/memory/management/managed_array.h"
+#include "sxt/multiexp/base/exponent_sequence.h"
+#include "sxt/multiexp/curve/engine_calibration.h"
+
+namespace sxt::cbnbck {
+//--------------------------------------------------------------------------------------------------
+// time_multiexponentiation_impl
+//--------------------------------------------------------------------------------------------------
+template <class Element>
+static double time_multiexponentiation_impl(const computational_backend& backend,
+                                            mtxcrv::engine_t engine,
+                                            const mtxcrv::calibration_shape& shape,
+                                            basct::cspan<Element> generators) noexcept {
+  SXT_RELEASE_ASSERT(generators.size() >= shape.n);
+  generators = generators.subspan(0, shape.n);
+
+  memmg::managed_array<uint8_t> exponents_data(shape.num_outputs * shape.n *
+                                               shape.element_nbytes);
+  basn::fast_random_number_generator rng{static_cast<uint64_t>(shape.n),
+                                         static_cast<uint64_t>(shape.num_outputs)};
+  std::generate(exponents_data.begin(), exponents_data.end(),
+                [&]() noexcept { return static_cast<uint8_t>(rng()); });
+  memmg::managed_array<mtxb::exponent_sequence> exponents(shape.num_outputs);
+  for (size_t output_index = 0; output_index < shape.num_outputs; ++output_index) {
+    exponents[output_index] = {
+        .element_nbytes = static_cast<uint8_t>(shape.element_nbytes),
+        .n = shape.n,
+        .data = exponents_data.data() + output_index * shape.n * shape.element_nbytes,
+        .is_signed = 0,
+    };
+  }
+
+  memmg::managed_array<Element> res(shape.num_outputs);
+  backend.compute_multiexponentiation(res, exponents, generators, engine);
+  auto best = std::numeric_limits<double>::max();
+  for (unsigned run = 0; run < num_timing_runs_v; ++run) {
+    auto t1 = std::chrono::steady_clock::now();
+    backend.compute_multiexponentiation(res, exponents, generators, engine);
+    auto t2 = std::chrono::steady_clock::now();
+    best = std::min(best, std::chrono::duration<double>(t2 - t1).count());
+  }
+  return best;
+}
+
+//--------------------------------------------------------------------------------------------------
+// make_bls12_381_g1_generators
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write the distinct multiples g, 2g, 3g, ... of the G1 generator g.
+ */
+static void make_bls12_381_g1_generators(basct::span<cg1t::element_p2> generators) noexcept {
+  for (size_t i = 0; i < generators.size(); ++i) {
+    if (i == 0) {
+      generators[i] = cg1cn::generator_p2_v;
+    } else {
+      cg1o::add(generators[i], generators[i - 1], cg1cn::generator_p2_v);
+    }
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// time_multiexponentiation
+//--------------------------------------------------------------------------------------------------
+double time_multiexponentiation(const computational_backend& backend, mtxcrv::engine_t engine,
+                                const mtxcrv::calibration_shape& shape,
+                                basct::cspan<c21t::element_p3> generators) noexcept {
+  return time_multiexponentiation_impl(backend, engine, shape, generators);
+}
+
+double time_multiexponentiation(const computational_backend& backend, mtxcrv::engine_t engine,
+                                const mtxcrv::calibration_shape& shape,
+                                basct::cspan<cg1t::element_p2> generators) noexcept {
+  return time_multiexponentiation_impl(backend, engine, shape, generators);
+}
+
+//--------------------------------------------------------------------------------------------------
+// calibrate_backend_engines
+//--------------------------------------------------------------------------------------------------
+void calibrate_backend_engines(mtxcrv::engine_calibration& curve25519_calibration,
+                               mtxcrv::engine_calibration& bls12_381_g1_calibration,
+                               const computational_backend& backend) noexcept {
+  auto max_n = mtxcrv::calibration_ns_v.back();
+
+  std::vector<c21t::element_p3> temp_generators;
+  auto curve25519_generators = backend.get_precomputed_generators(temp_generators, max_n, 0);
+  mtxcrv::calibrate_engines(curve25519_calibration,
+                            [&](mtxcrv::engine_t engine,
+                                const mtxcrv::calibration_shape& shape) noexcept {
+                              return time_multiexponentiation(backend, engine, shape,
+                                                              curve25519_generators);
+                            });
+
+  memmg::managed_array<cg1t::element_p2> bls12_381_g1_generators(max_n);
+  make_bls12_381_g1_generators(bls12_381_g1_generators);
+  mtxcrv::calibrate_engines(bls12_381_g1_calibration,
+                            [&](mtxcrv::engine_t engine,
+                                const mtxcrv::calibration_shape& shape) noexcept {
+                              return time_multiexponentiation(
+                                  backend, engine, shape,
+                                  basct::cspan<cg1t::element_p2>{bls12_381_g1_generators});
+                            });
+}
+} // namespace sxt::cbnbck
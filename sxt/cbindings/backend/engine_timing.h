@@ -0,0 +1,72 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "sxt/base/container/span.h"
+#include "sxt/multiexp/curve/engine.h"
+
+namespace sxt::mtxcrv {
+class engine_calibration;
+struct calibration_shape;
+} // namespace sxt::mtxcrv
+
+namespace sxt::c21t {
+struct element_p3;
+}
+
+namespace sxt::cg1t {
+struct element_p2;
+}
+
+namespace sxt::cbnbck {
+class computational_backend;
+
+//--------------------------------------------------------------------------------------------------
+// num_timing_runs_v
+//--------------------------------------------------------------------------------------------------
+/**
+ * Each multiexponentiation is computed once untimed to warm up caches and allocations and then
+ * timed this many times.
+ */
+constexpr unsigned num_timing_runs_v = 5;
+
+//--------------------------------------------------------------------------------------------------
+// time_multiexponentiation
+//--------------------------------------------------------------------------------------------------
+/**
+ * Return the best wall-clock timing, in seconds, of a multiexponentiation of the given shape with
+ * random exponents over the first shape.n generators, computed by backend using engine.
+ */
+double time_multiexponentiation(const computational_backend& backend, mtxcrv::engine_t engine,
+                                const mtxcrv::calibration_shape& shape,
+                                basct::cspan<c21t::element_p3> generators) noexcept;
+
+double time_multiexponentiation(const computational_backend& backend, mtxcrv::engine_t engine,
+                                const mtxcrv::calibration_shape& shape,
+                                basct::cspan<cg1t::element_p2> generators) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// calibrate_backend_engines
+//--------------------------------------------------------------------------------------------------
+/**
+ * Time each engine of backend on the calibration grid, separately for curve25519 and for
+ * bls12-381 G1.
+ */
+void calibrate_backend_engines(mtxcrv::engine_calibration& curve25519_calibration,
+                               mtxcrv::engine_calibration& bls12_381_g1_calibration,
+                               const computational_backend& backend) noexcept;
+} // namespace sxt::cbnbck
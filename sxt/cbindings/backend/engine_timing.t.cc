@@ -0,0 +1,193 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/cbindings/backend/engine_timing.h"
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "sxt/base/test/unit_test.h"
+#include "sxt/cbindings/backend/computational_backend.h"
+#include "sxt/curve21/type/element_p3.h"
+#include "sxt/curve_g1/type/element_p2.h"
+#include "sxt/multiexp/base/exponent_sequence.h"
+#include "sxt/multiexp/base/segmented_generators.h"
+#include "sxt/multiexp/curve/engine_calibration.h"
+
+using namespace sxt;
+using namespace sxt::cbnbck;
+
+namespace {
+//--------------------------------------------------------------------------------------------------
+// fake_backend
+//--------------------------------------------------------------------------------------------------
+/**
+ * A backend whose multiexponentiations only record their arguments. Engines listed as slow sleep
+ * so that calibration has a clear winner.
+ */
+class fake_backend final : public computational_backend {
+public:
+  struct call {
+    size_t num_outputs;
+    size_t n;
+    unsigned element_nbytes;
+    mtxcrv::engine_t engine;
+  };
+
+  mutable std::vector<call> curve25519_calls;
+  mutable std::vector<call> bls12_381_g1_calls;
+  mtxcrv::engine_t curve25519_fast_engine = mtxcrv::engine_t::pippenger;
+  mtxcrv::engine_t bls12_381_g1_fast_engine = mtxcrv::engine_t::pippenger;
+
+  void compute_commitments(basct::span<rstt::compressed_element> /*commitments*/,
+                           basct::cspan<mtxb::exponent_sequence> /*value_sequences*/,
+                           basct::cspan<c21t::element_p3> /*generators*/) const noexcept override {}
+
+  void compute_commitments(basct::span<cg1t::compressed_element> /*commitments*/,
+                           basct::cspan<mtxb::exponent_sequence> /*value_sequences*/,
+                           basct::cspan<cg1t::element_p2> /*generators*/) const noexcept override {}
+
+  void compute_multiexponentiation(basct::span<c21t::element_p3> res,
+                                   basct::cspan<mtxb::exponent_sequence> exponents,
+                                   basct::cspan<c21t::element_p3> generators,
+                                   mtxcrv::engine_t engine) const noexcept override {
+    record(curve25519_calls, res.size(), exponents, generators.size(), engine,
+           curve25519_fast_engine);
+  }
+
+  void compute_multiexponentiation(basct::span<cg1t::element_p2> res,
+                                   basct::cspan<mtxb::exponent_sequence> exponents,
+                                   basct::cspan<cg1t::element_p2> generators,
+                                   mtxcrv::engine_t engine) const noexcept override {
+    record(bls12_381_g1_calls, res.size(), exponents, generators.size(), engine,
+           bls12_381_g1_fast_engine);
+  }
+
+  basct::cspan<c21t::element_p3>
+  get_precomputed_generators(std::vector<c21t::element_p3>& temp_generators, uint64_t n,
+                             uint64_t /*offset_generators*/) const noexcept override {
+    temp_generators.resize(n);
+    return temp_generators;
+  }
+
+  void compute_multiexponentiation(
+      basct::span<c21t::element_p3> /*res*/, basct::cspan<mtxb::exponent_sequence> /*exponents*/,
+      const mtxb::segmented_generators<c21t::element_p3>& /*generators*/,
+      mtxcrv::engine_t /*engine*/) const noexcept override {}
+
+  void compute_multiexponentiation(
+      basct::span<c21t::element_p3> /*res*/, basct::cspan<mtxb::packed_sequence> /*exponents*/,
+      const mtxb::segmented_generators<c21t::element_p3>& /*generators*/,
+      mtxcrv::engine_t /*engine*/) const noexcept override {}
+
+  void compute_multiexponentiation(
+      basct::span<c21t::element_p3> /*res*/, size_t /*n*/, exponent_slicer /*slice*/,
+      const mtxb::segmented_generators<c21t::element_p3>& /*generators*/) const noexcept override {
+  }
+
+  mtxb::segmented_generators<c21t::element_p3>
+  get_precomputed_generator_segments(uint64_t /*n*/,
+                                     uint64_t /*offset_generators*/) const noexcept override {
+    return {};
+  }
+
+  void prove_inner_product(basct::span<rstt::compressed_element> /*l_vector*/,
+                           basct::span<rstt::compressed_element> /*r_vector*/,
+                           s25t::element& /*ap_value*/, prft::transcript& /*transcript*/,
+                           const prfip::proof_descriptor& /*descriptor*/,
+                           basct::cspan<s25t::element> /*a_vector*/) const noexcept override {}
+
+  bool verify_inner_product(prft::transcript& /*transcript*/,
+                            const prfip::proof_descriptor& /*descriptor*/,
+                            const s25t::element& /*product*/, const c21t::element_p3& /*a_commit*/,
+                            basct::cspan<rstt::compressed_element> /*l_vector*/,
+                            basct::cspan<rstt::compressed_element> /*r_vector*/,
+                            const s25t::element& /*ap_value*/) const noexcept override {
+    return false;
+  }
+
+private:
+  static void record(std::vector<call>& calls, size_t num_outputs,
+                     basct::cspan<mtxb::exponent_sequence> exponents, size_t num_generators,
+                     mtxcrv::engine_t engine, mtxcrv::engine_t fast_engine) noexcept {
+    REQUIRE(exponents.size() == num_outputs);
+    REQUIRE(num_generators == exponents[0].n);
+    calls.push_back({
+        .num_outputs = num_outputs,
+        .n = exponents[0].n,
+        .element_nbytes = exponents[0].element_nbytes,
+        .engine = engine,
+    });
+    if (engine != fast_engine) {
+      std::this_thread::sleep_for(std::chrono::microseconds{500});
+    }
+  }
+};
+} // namespace
+
+TEST_CASE("we can time multiexponentiations") {
+  fake_backend backend;
+  mtxcrv::calibration_shape shape{.n = 10, .element_nbytes = 32, .num_outputs = 3};
+
+  SECTION("we time curve25519 multiexponentiations with the given engine and shape") {
+    std::vector<c21t::element_p3> generators(20);
+    auto t = time_multiexponentiation(backend, mtxcrv::engine_t::bucket, shape, generators);
+    REQUIRE(t >= 0);
+    REQUIRE(backend.bls12_381_g1_calls.empty());
+    REQUIRE(backend.curve25519_calls.size() == num_timing_runs_v + 1);
+    for (auto& call : backend.curve25519_calls) {
+      REQUIRE(call.num_outputs == 3);
+      REQUIRE(call.n == 10);
+      REQUIRE(call.element_nbytes == 32);
+      REQUIRE(call.engine == mtxcrv::engine_t::bucket);
+    }
+  }
+
+  SECTION("we time bls12-381 G1 multiexponentiations with the given engine and shape") {
+    std::vector<cg1t::element_p2> generators(10);
+    auto t = time_multiexponentiation(backend, mtxcrv::engine_t::naive, shape, generators);
+    REQUIRE(t >= 0);
+    REQUIRE(backend.curve25519_calls.empty());
+    REQUIRE(backend.bls12_381_g1_calls.size() == num_timing_runs_v + 1);
+    for (auto& call : backend.bls12_381_g1_calls) {
+      REQUIRE(call.num_outputs == 3);
+      REQUIRE(call.n == 10);
+      REQUIRE(call.engine == mtxcrv::engine_t::naive);
+    }
+  }
+}
+
+TEST_CASE("we calibrate each curve separately") {
+  fake_backend backend;
+  backend.curve25519_fast_engine = mtxcrv::engine_t::pippenger;
+  backend.bls12_381_g1_fast_engine = mtxcrv::engine_t::naive;
+  mtxcrv::engine_calibration curve25519_calibration, bls12_381_g1_calibration;
+  calibrate_backend_engines(curve25519_calibration, bls12_381_g1_calibration, backend);
+
+  REQUIRE(!backend.curve25519_calls.empty());
+  REQUIRE(!backend.bls12_381_g1_calls.empty());
+  for (size_t shape_index = 0; shape_index < mtxcrv::engine_calibration::num_shapes_v;
+       ++shape_index) {
+    auto shape = mtxcrv::engine_calibration::shape(shape_index);
+    REQUIRE(curve25519_calibration.engine(shape_index) == mtxcrv::engine_t::pippenger);
+    if (shape.n <= mtxcrv::naive_calibration_max_n_v) {
+      REQUIRE(bls12_381_g1_calibration.engine(shape_index) == mtxcrv::engine_t::naive);
+    } else {
+      REQUIRE(bls12_381_g1_calibration.engine(shape_index) != mtxcrv::engine_t::naive);
+    }
+  }
+}
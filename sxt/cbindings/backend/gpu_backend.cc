@@ -16,6 +16,7 @@
  */
 #include "sxt/cbindings/backend/gpu_backend.h"
 
+#include <algorithm>
 #include <vector>
 
 #include "sxt/base/error/assert.h"
@@ -33,7 +34,10 @@
 #include "sxt/execution/schedule/scheduler.h"
 #include "sxt/memory/management/managed_array.h"
 #include "sxt/multiexp/base/exponent_sequence.h"
+#include "sxt/multiexp/base/packed_sequence.h"
+#include "sxt/multiexp/base/segmented_generators.h"
 #include "sxt/multiexp/curve/multiexponentiation.h"
+#include "sxt/multiexp/curve/pipelined_multiexponentiation.h"
 #include "sxt/proof/inner_product/gpu_driver.h"
 #include "sxt/proof/inner_product/proof_computation.h"
 #include "sxt/proof/inner_product/proof_descriptor.h"
@@ -47,6 +51,14 @@
 using sxt::rstt::operator""_rs;
 
 namespace sxt::cbnbck {
+//--------------------------------------------------------------------------------------------------
+// generator_chunk_size_v
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of generators past the precomputed segment that are assembled on the host at a time.
+ */
+static constexpr size_t generator_chunk_size_v = 1ull << 20u;
+
 //--------------------------------------------------------------------------------------------------
 // pre_initialize_gpu
 //--------------------------------------------------------------------------------------------------
@@ -97,6 +109,34 @@ void gpu_backend::compute_commitments(basct::span<cg1t::compressed_element> comm
   cg1o::batch_compress(commitments, fut.value());
 }
 
+//--------------------------------------------------------------------------------------------------
+// compute_multiexponentiation
+//--------------------------------------------------------------------------------------------------
+void gpu_backend::compute_multiexponentiation(basct::span<c21t::element_p3> res,
+                                              basct::cspan<mtxb::exponent_sequence> exponents,
+                                              basct::cspan<c21t::element_p3> generators,
+                                              mtxcrv::engine_t engine) const noexcept {
+  auto fut =
+      mtxcrv::async_compute_multiexponentiation<c21t::element_p3>(generators, exponents, engine);
+  xens::get_scheduler().run();
+  SXT_DEBUG_ASSERT(res.size() == fut.value().size());
+  std::copy(fut.value().begin(), fut.value().end(), res.begin());
+}
+
+//--------------------------------------------------------------------------------------------------
+// compute_multiexponentiation
+//--------------------------------------------------------------------------------------------------
+void gpu_backend::compute_multiexponentiation(basct::span<cg1t::element_p2> res,
+                                              basct::cspan<mtxb::exponent_sequence> exponents,
+                                              basct::cspan<cg1t::element_p2> generators,
+                                              mtxcrv::engine_t engine) const noexcept {
+  auto fut =
+      mtxcrv::async_compute_multiexponentiation<cg1t::element_p2>(generators, exponents, engine);
+  xens::get_scheduler().run();
+  SXT_DEBUG_ASSERT(res.size() == fut.value().size());
+  std::copy(fut.value().begin(), fut.value().end(), res.begin());
+}
+
 //--------------------------------------------------------------------------------------------------
 // get_precomputed_generators
 //--------------------------------------------------------------------------------------------------
@@ -106,6 +146,100 @@ gpu_backend::get_precomputed_generators(std::vector<c21t::element_p3>& temp_gene
   return sqcgn::get_precomputed_generators(temp_generators, n, offset_generators, true);
 }
 
+//--------------------------------------------------------------------------------------------------
+// compute_multiexponentiation
+//--------------------------------------------------------------------------------------------------
+void gpu_backend::compute_multiexponentiation(
+    basct::span<c21t::element_p3> res, basct::cspan<mtxb::exponent_sequence> exponents,
+    const mtxb::segmented_generators<c21t::element_p3>& generators,
+    mtxcrv::engine_t engine) const noexcept {
+  size_t n = 0;
+  for (auto& exponent_sequence : exponents) {
+    n = std::max(n, static_cast<size_t>(exponent_sequence.n));
+  }
+  auto precomputed = generators.precomputed();
+  if (n <= precomputed.size()) {
+    this->compute_multiexponentiation(res, exponents, precomputed, engine);
+    return;
+  }
+
+  // the precomputed segment is used in place; the rest of the generators are assembled on the
+  // host a chunk at a time so that at most one chunk of them is held in memory
+  std::fill(res.begin(), res.end(), c21t::element_p3::identity());
+  memmg::managed_array<mtxb::exponent_sequence> chunk_exponents(exponents.size());
+  memmg::managed_array<c21t::element_p3> partial(res.size());
+  memmg::managed_array<c21t::element_p3> generators_data;
+  size_t first = 0;
+  while (first < n) {
+    auto m = first < precomputed.size() ? precomputed.size()
+                                        : std::min(generator_chunk_size_v, n - first);
+    mtxcrv::slice_exponents(chunk_exponents, exponents, first, m);
+    this->compute_multiexponentiation(partial, chunk_exponents,
+                                      generators.get(generators_data, first, m), engine);
+    for (size_t output_index = 0; output_index < res.size(); ++output_index) {
+      c21o::add_inplace(res[output_index], partial[output_index]);
+    }
+    first += m;
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// compute_multiexponentiation
+//--------------------------------------------------------------------------------------------------
+void gpu_backend::compute_multiexponentiation(
+    basct::span<c21t::element_p3> res, basct::cspan<mtxb::packed_sequence> exponents,
+    const mtxb::segmented_generators<c21t::element_p3>& generators,
+    mtxcrv::engine_t engine) const noexcept {
+  // the device decomposition reads whole bytes, so unpack the sequences on the host
+  size_t num_bytes = 0;
+  for (auto& exponent : exponents) {
+    num_bytes += exponent.n * mtxb::unpacked_element_nbytes(exponent.element_nbits);
+  }
+  memmg::managed_array<uint8_t> data(num_bytes);
+  memmg::managed_array<mtxb::exponent_sequence> unpacked(exponents.size());
+  auto out = data.data();
+  for (size_t i = 0; i < exponents.size(); ++i) {
+    auto& exponent = exponents[i];
+    auto n = static_cast<size_t>(exponent.n);
+    auto exponent_num_bytes = n * mtxb::unpacked_element_nbytes(exponent.element_nbits);
+    unpacked[i] = mtxb::unpack_sequence({out, exponent_num_bytes}, exponent, 0, n);
+    out += exponent_num_bytes;
+  }
+  this->compute_multiexponentiation(res, unpacked, generators, engine);
+}
+
+//--------------------------------------------------------------------------------------------------
+// compute_multiexponentiation
+//--------------------------------------------------------------------------------------------------
+void gpu_backend::compute_multiexponentiation(
+    basct::span<c21t::element_p3> res, size_t n, exponent_slicer slice,
+    const mtxb::segmented_generators<c21t::element_p3>& generators) const noexcept {
+  // slice and assemble the generators a chunk at a time and sum the chunks' multiexponentiations
+  std::fill(res.begin(), res.end(), c21t::element_p3::identity());
+  memmg::managed_array<mtxb::exponent_sequence> chunk_exponents(res.size());
+  memmg::managed_array<c21t::element_p3> partial(res.size());
+  memmg::managed_array<c21t::element_p3> generators_data;
+  for (size_t first = 0; first < n; first += generator_chunk_size_v) {
+    auto m = std::min(generator_chunk_size_v, n - first);
+    slice(chunk_exponents, first, m);
+    this->compute_multiexponentiation(partial, chunk_exponents,
+                                      generators.get(generators_data, first, m),
+                                      mtxcrv::engine_t::automatic);
+    for (size_t output_index = 0; output_index < res.size(); ++output_index) {
+      c21o::add_inplace(res[output_index], partial[output_index]);
+    }
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// get_precomputed_generator_segments
+//--------------------------------------------------------------------------------------------------
+mtxb::segmented_generators<c21t::element_p3>
+gpu_backend::get_precomputed_generator_segments(uint64_t n,
+                                                uint64_t offset_generators) const noexcept {
+  return sqcgn::get_precomputed_generator_segments(n, offset_generators, true);
+}
+
 //--------------------------------------------------------------------------------------------------
 // prove_inner_product
 //--------------------------------------------------------------------------------------------------
@@ -24,7 +24,9 @@
 
 namespace sxt::mtxb {
 struct exponent_sequence;
-}
+struct packed_sequence;
+template <class T> class segmented_generators;
+} // namespace sxt::mtxb
 
 namespace sxt::rstt {
 class compressed_element;
@@ -68,10 +70,38 @@ public:
                            basct::cspan<mtxb::exponent_sequence> value_sequences,
                            basct::cspan<cg1t::element_p2> generators) const noexcept override;
 
+  void compute_multiexponentiation(basct::span<c21t::element_p3> res,
+                                   basct::cspan<mtxb::exponent_sequence> exponents,
+                                   basct::cspan<c21t::element_p3> generators,
+                                   mtxcrv::engine_t engine) const noexcept override;
+
+  void compute_multiexponentiation(basct::span<cg1t::element_p2> res,
+                                   basct::cspan<mtxb::exponent_sequence> exponents,
+                                   basct::cspan<cg1t::element_p2> generators,
+                                   mtxcrv::engine_t engine) const noexcept override;
+
   basct::cspan<c21t::element_p3>
   get_precomputed_generators(std::vector<c21t::element_p3>& temp_generators, uint64_t n,
                              uint64_t offset_generators) const noexcept override;
 
+  void compute_multiexponentiation(basct::span<c21t::element_p3> res,
+                                   basct::cspan<mtxb::exponent_sequence> exponents,
+                                   const mtxb::segmented_generators<c21t::element_p3>& generators,
+                                   mtxcrv::engine_t engine) const noexcept override;
+
+  void compute_multiexponentiation(basct::span<c21t::element_p3> res,
+                                   basct::cspan<mtxb::packed_sequence> exponents,
+                                   const mtxb::segmented_generators<c21t::element_p3>& generators,
+                                   mtxcrv::engine_t engine) const noexcept override;
+
+  void compute_multiexponentiation(
+      basct::span<c21t::element_p3> res, size_t n, exponent_slicer slice,
+      const mtxb::segmented_generators<c21t::element_p3>& generators) const noexcept override;
+
+  mtxb::segmented_generators<c21t::element_p3>
+  get_precomputed_generator_segments(uint64_t n,
+                                     uint64_t offset_generators) const noexcept override;
+
   void prove_inner_product(basct::span<rstt::compressed_element> l_vector,
                            basct::span<rstt::compressed_element> r_vector, s25t::element& ap_value,
                            prft::transcript& transcript, const prfip::proof_descriptor& descriptor,
@@ -25,10 +25,9 @@
 
 #include "sxt/curve21/operation/add.h"
 
-#include "sxt/field51/operation/add.h"
-#include "sxt/field51/operation/mul.h"
-#include "sxt/field51/operation/sub.h"
+#include "sxt/field51/operation/unreduced_arithmetic.h"
 #include "sxt/field51/type/element.h"
+#include "sxt/field51/type/unreduced_element.h"
 
 namespace sxt::c21o {
 //--------------------------------------------------------------------------------------------------
@@ -39,18 +38,17 @@ namespace sxt::c21o {
  */
 CUDA_CALLABLE
 void add(c21t::element_p1p1& r, const c21t::element_p3& p, const c21t::element_cached& q) noexcept {
-  f51t::element t0;
+  using cached_element = f51t::unreduced_element<f51o::max_mul_operand_bound_v>;
+  f51t::unreduced_element px{p.X}, py{p.Y}, pz{p.Z}, pt{p.T};
 
-  f51o::add(r.X, p.Y, p.X);
-  f51o::sub(r.Y, p.Y, p.X);
-  f51o::mul(r.Z, r.X, q.YplusX);
-  f51o::mul(r.Y, r.Y, q.YminusX);
-  f51o::mul(r.T, q.T2d, p.T);
-  f51o::mul(r.X, p.Z, q.Z);
-  f51o::add(t0, r.X, r.X);
-  f51o::sub(r.X, r.Z, r.Y);
-  f51o::add(r.Y, r.Z, r.Y);
-  f51o::add(r.Z, t0, r.T);
-  f51o::sub(r.T, t0, r.T);
+  auto a = f51o::mul(f51o::add(py, px), cached_element{q.YplusX});
+  auto b = f51o::mul(f51o::sub(py, px), cached_element{q.YminusX});
+  auto c = f51o::mul(cached_element{q.T2d}, pt);
+  auto d = f51o::mul(pz, cached_element{q.Z});
+  auto t0 = f51o::add(d, d);
+  f51o::to_element(r.X, f51o::sub(a, b));
+  f51o::to_element(r.Y, f51o::add(a, b));
+  f51o::to_element(r.Z, f51o::add(t0, c));
+  f51o::to_element(r.T, f51o::sub(t0, c));
 }
 } // namespace sxt::c21o
@@ -24,6 +24,8 @@
 #include "sxt/curve21/type/element_p1p1.h"
 #include "sxt/curve21/type/element_p3.h"
 #include "sxt/field51/constant/d.h"
+#include "sxt/field51/operation/unreduced_arithmetic.h"
+#include "sxt/field51/type/unreduced_element.h"
 
 namespace sxt::c21o {
 //--------------------------------------------------------------------------------------------------
@@ -52,30 +54,25 @@ inline void add(c21t::element_p3& res, const c21t::element_p3& lhs,
  p = p + q (q value is not preserved)
  */
 CUDA_CALLABLE inline void add_inplace(c21t::element_p3& p, c21t::element_p3& q) noexcept {
-  // convert q into a `c21t::element_cached`
-  f51o::add(q.X, q.Y, q.X);
-  f51o::add(q.Y, q.Y, q.Y);
-  f51o::sub(q.Y, q.Y, q.X);
-  f51o::mul(q.T, q.T, f51t::element{f51cn::d2_v});
+  f51t::unreduced_element px{p.X}, py{p.Y}, pz{p.Z}, pt{p.T};
+  f51t::unreduced_element qx{q.X}, qy{q.Y}, qz{q.Z}, qt{q.T};
+  f51t::unreduced_element<f51t::reduced_bound_v> d2{f51t::element{f51cn::d2_v}};
 
-  // add p and q_cached
-  f51o::add(p.X, p.Y, p.X);
-  f51o::add(p.Y, p.Y, p.Y);
-  f51o::sub(p.Y, p.Y, p.X);
-  f51o::mul(p.Y, p.Y, q.Y);
-  f51o::mul(p.T, q.T, p.T);
-  f51o::mul(p.X, p.X, q.X);
-  f51o::sub(q.X, p.X, p.Y);
-  f51o::add(q.Y, p.X, p.Y);
-  f51o::mul(p.Z, p.Z, q.Z);
-  f51o::add(q.T, p.Z, p.Z);
-  f51o::add(q.Z, q.T, p.T);
-  f51o::sub(q.T, q.T, p.T);
+  // add p and q as p1p1
+  auto a = f51o::mul(f51o::sub(py, px), f51o::sub(qy, qx));
+  auto b = f51o::mul(f51o::add(py, px), f51o::add(qy, qx));
+  auto c = f51o::mul(f51o::mul(qt, d2), pt);
+  auto d = f51o::mul(pz, qz);
+  auto t0 = f51o::add(d, d);
+  auto x = f51o::sub(b, a);
+  auto y = f51o::add(b, a);
+  auto z = f51o::add(t0, c);
+  auto t = f51o::sub(t0, c);
 
-  // convert q back into a `c21t::element_p3`
-  f51o::mul(p.X, q.X, q.T);
-  f51o::mul(p.Y, q.Y, q.Z);
-  f51o::mul(p.Z, q.Z, q.T);
-  f51o::mul(p.T, q.X, q.Y);
+  // convert back into a `c21t::element_p3`
+  f51o::to_element(p.X, f51o::mul(x, t));
+  f51o::to_element(p.Y, f51o::mul(y, z));
+  f51o::to_element(p.Z, f51o::mul(z, t));
+  f51o::to_element(p.T, f51o::mul(x, y));
 }
 } // namespace sxt::c21o
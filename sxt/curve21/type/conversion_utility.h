@@ -34,6 +34,8 @@
 #include "sxt/field51/operation/add.h"
 #include "sxt/field51/operation/mul.h"
 #include "sxt/field51/operation/sub.h"
+#include "sxt/field51/operation/unreduced_arithmetic.h"
+#include "sxt/field51/type/unreduced_element.h"
 
 namespace sxt::c21t {
 struct element_p3;
@@ -44,8 +46,9 @@ struct element_cached;
 //--------------------------------------------------------------------------------------------------
 CUDA_CALLABLE
 inline void to_element_cached(element_cached& r, const element_p3& p) noexcept {
-  f51o::add(r.YplusX, p.Y, p.X);
-  f51o::sub(r.YminusX, p.Y, p.X);
+  f51t::unreduced_element x{p.X}, y{p.Y};
+  f51o::to_element(r.YplusX, f51o::add(y, x));
+  f51o::to_element(r.YminusX, f51o::sub(y, x));
   r.Z = p.Z;
   f51o::mul(r.T2d, p.T, f51t::element{f51cn::d2_v});
 }
@@ -27,10 +27,9 @@
 
 #include "sxt/curve21/type/element_p1p1.h"
 #include "sxt/curve21/type/element_p2.h"
-#include "sxt/field51/operation/add.h"
-#include "sxt/field51/operation/sq.h"
-#include "sxt/field51/operation/sub.h"
+#include "sxt/field51/operation/unreduced_arithmetic.h"
 #include "sxt/field51/type/element.h"
+#include "sxt/field51/type/unreduced_element.h"
 
 namespace sxt::c21t {
 //--------------------------------------------------------------------------------------------------
@@ -41,16 +40,17 @@ namespace sxt::c21t {
 */
 CUDA_CALLABLE
 void double_element_impl(c21t::element_p1p1& r, const c21t::element_p2& p) noexcept {
-  f51t::element t0;
+  f51t::unreduced_element px{p.X}, py{p.Y}, pz{p.Z};
 
-  f51o::sq(r.X, p.X);
-  f51o::sq(r.Z, p.Y);
-  f51o::sq2(r.T, p.Z);
-  f51o::add(r.Y, p.X, p.Y);
-  f51o::sq(t0, r.Y);
-  f51o::add(r.Y, r.Z, r.X);
-  f51o::sub(r.Z, r.Z, r.X);
-  f51o::sub(r.X, t0, r.Y);
-  f51o::sub(r.T, r.T, r.Z);
+  auto xx = f51o::sq(px);
+  auto yy = f51o::sq(py);
+  auto zz2 = f51o::sq2(pz);
+  auto t0 = f51o::sq(f51o::add(px, py));
+  auto y = f51o::add(yy, xx);
+  auto z = f51o::sub(yy, xx);
+  f51o::to_element(r.X, f51o::sub(t0, y));
+  f51o::to_element(r.Y, y);
+  f51o::to_element(r.Z, z);
+  f51o::to_element(r.T, f51o::sub(zz2, z));
 }
 } // namespace sxt::c21t
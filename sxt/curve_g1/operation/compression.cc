@@ -25,25 +25,40 @@
  */
 #include "sxt/curve_g1/operation/compression.h"
 
+#include <atomic>
+#include <cstring>
+
+#include "sxt/base/bit/zero_equality.h"
 #include "sxt/base/error/assert.h"
+#include "sxt/base/iterator/index_range.h"
 #include "sxt/base/num/cmov.h"
+#include "sxt/curve_g1/constant/b.h"
+#include "sxt/curve_g1/property/subgroup.h"
 #include "sxt/curve_g1/type/compressed_element.h"
 #include "sxt/curve_g1/type/conversion_utility.h"
 #include "sxt/curve_g1/type/element_affine.h"
 #include "sxt/curve_g1/type/element_p2.h"
+#include "sxt/execution/thread/parallel_for.h"
 #include "sxt/field12/base/byte_conversion.h"
+#include "sxt/field12/constant/one.h"
 #include "sxt/field12/constant/zero.h"
+#include "sxt/field12/operation/add.h"
 #include "sxt/field12/operation/cmov.h"
+#include "sxt/field12/operation/invert.h"
+#include "sxt/field12/operation/mul.h"
+#include "sxt/field12/operation/neg.h"
+#include "sxt/field12/operation/sqrt.h"
+#include "sxt/field12/operation/square.h"
 #include "sxt/field12/property/lexicographically_largest.h"
+#include "sxt/field12/property/zero.h"
+#include "sxt/field12/type/element.h"
+#include "sxt/memory/management/managed_array.h"
 
 namespace sxt::cg1o {
 //--------------------------------------------------------------------------------------------------
-// compress
+// compress_affine
 //--------------------------------------------------------------------------------------------------
-void compress(cg1t::compressed_element& e_c, const cg1t::element_p2& e_p) noexcept {
-  cg1t::element_affine e_a;
-  cg1t::to_element_affine(e_a, e_p);
-
+static void compress_affine(cg1t::compressed_element& e_c, cg1t::element_affine e_a) noexcept {
   f12o::cmov(e_a.X, f12cn::zero_v, e_a.infinity);
 
   f12b::to_bytes(e_c.data(), e_a.X.data());
@@ -67,14 +82,179 @@ void compress(cg1t::compressed_element& e_c, const cg1t::element_p2& e_p) noexce
   e_c.data()[0] |= y_lx_lrg;
 }
 
+//--------------------------------------------------------------------------------------------------
+// compress
+//--------------------------------------------------------------------------------------------------
+void compress(cg1t::compressed_element& e_c, const cg1t::element_p2& e_p) noexcept {
+  cg1t::element_affine e_a;
+  cg1t::to_element_affine(e_a, e_p);
+  compress_affine(e_c, e_a);
+}
+
+//--------------------------------------------------------------------------------------------------
+// decompress
+//--------------------------------------------------------------------------------------------------
+int decompress(cg1t::element_p2& e_p, const cg1t::compressed_element& e_c) noexcept {
+  constexpr uint8_t compressed_bit{static_cast<uint8_t>(1) << 7};
+  constexpr uint8_t pt_inf_bit{static_cast<uint8_t>(1) << 6};
+  constexpr uint8_t lx_lrg_bit{static_cast<uint8_t>(1) << 5};
+  const uint8_t flags{e_c.data()[0]};
+  if ((flags & compressed_bit) == 0) {
+    return -1;
+  }
+
+  // Mask away the flag bits to get the x-coordinate.
+  uint8_t x_bytes[48];
+  std::memcpy(x_bytes, e_c.data(), sizeof(x_bytes));
+  x_bytes[0] &= static_cast<uint8_t>(0x1f);
+
+  // The point at infinity must have every other bit unset.
+  if ((flags & pt_inf_bit) != 0) {
+    if ((flags & lx_lrg_bit) != 0 || !basbt::is_zero(x_bytes, sizeof(x_bytes))) {
+      return -1;
+    }
+    e_p = cg1t::element_p2::identity();
+    return 0;
+  }
+
+  bool below_modulus;
+  f12t::element x;
+  f12b::from_bytes(below_modulus, x.data(), x_bytes);
+  if (!below_modulus) {
+    return -1;
+  }
+
+  // Recover y from y^2 = x^3 + b, picking the root indicated by the sort flag.
+  f12t::element y2;
+  f12o::square(y2, x);
+  f12o::mul(y2, y2, x);
+  f12o::add(y2, y2, cg1cn::b_v);
+  f12t::element y;
+  if (!f12o::sqrt(y, y2)) {
+    return -1;
+  }
+  if (f12p::lexicographically_largest(y) != ((flags & lx_lrg_bit) != 0)) {
+    f12o::neg(y, y);
+  }
+
+  e_p = cg1t::element_p2{x, y, f12cn::one_v};
+  if (!cg1p::is_in_subgroup(e_p)) {
+    return -1;
+  }
+  return 0;
+}
+
+//--------------------------------------------------------------------------------------------------
+// compress_min_chunk_size_v
+//--------------------------------------------------------------------------------------------------
+/*
+ Each chunk shares a single inversion, so chunks need to be large enough for the shared inversion
+ to be amortized.
+ */
+static constexpr size_t compress_min_chunk_size_v = 256;
+
+//--------------------------------------------------------------------------------------------------
+// batch_compress_chunk
+//--------------------------------------------------------------------------------------------------
+/*
+ Convert the elements to affine coordinates with Montgomery's trick, so that the chunk costs one
+ inversion, and compress them.
+ */
+static void batch_compress_chunk(basct::span<cg1t::compressed_element> ex_c,
+                                 basct::cspan<cg1t::element_p2> ex_p) noexcept {
+  auto n = ex_p.size();
+  memmg::managed_array<f12t::element> prefixes(n);
+  f12t::element acc = f12cn::one_v;
+  for (size_t i = 0; i < n; ++i) {
+    prefixes[i] = acc;
+    if (!f12p::is_zero(ex_p[i].Z)) {
+      f12o::mul(acc, acc, ex_p[i].Z);
+    }
+  }
+  f12t::element acc_inv;
+  f12o::invert(acc_inv, acc);
+  for (size_t i = n; i-- > 0;) {
+    auto& e_p = ex_p[i];
+    if (f12p::is_zero(e_p.Z)) {
+      compress_affine(ex_c[i], cg1t::element_affine::identity());
+      continue;
+    }
+    f12t::element z_inv;
+    f12o::mul(z_inv, acc_inv, prefixes[i]);
+    f12o::mul(acc_inv, acc_inv, e_p.Z);
+    cg1t::element_affine e_a;
+    f12o::mul(e_a.X, e_p.X, z_inv);
+    f12o::mul(e_a.Y, e_p.Y, z_inv);
+    e_a.infinity = false;
+    compress_affine(ex_c[i], e_a);
+  }
+}
+
 //--------------------------------------------------------------------------------------------------
 // batch_compress
 //--------------------------------------------------------------------------------------------------
 void batch_compress(basct::span<cg1t::compressed_element> ex_c,
                     basct::cspan<cg1t::element_p2> ex_p) noexcept {
   SXT_DEBUG_ASSERT(ex_c.size() == ex_p.size());
-  for (size_t i = 0; i < ex_p.size(); ++i) {
-    compress(ex_c[i], ex_p[i]);
-  }
+  xent::parallel_for(
+      basit::index_range{0, ex_p.size()}.min_chunk_size(compress_min_chunk_size_v),
+      [&](basit::index_range rng) noexcept {
+        batch_compress_chunk(ex_c.subspan(rng.a(), rng.size()), ex_p.subspan(rng.a(), rng.size()));
+      });
+}
+
+//--------------------------------------------------------------------------------------------------
+// decompress_min_chunk_size_v
+//--------------------------------------------------------------------------------------------------
+/*
+ Each decompression costs a square root and a subgroup check, so fairly small chunks are enough
+ to amortize the cost of a thread.
+ */
+static constexpr size_t decompress_min_chunk_size_v = 64;
+
+//--------------------------------------------------------------------------------------------------
+// batch_decompress_impl
+//--------------------------------------------------------------------------------------------------
+template <class F>
+static int batch_decompress_impl(size_t n, F f) noexcept {
+  std::atomic<int> res = 0;
+  xent::parallel_for(basit::index_range{0, n}.min_chunk_size(decompress_min_chunk_size_v),
+                     [&](basit::index_range rng) noexcept {
+                       int chunk_res = 0;
+                       for (size_t i = rng.a(); i < rng.b(); ++i) {
+                         chunk_res |= f(i);
+                       }
+                       res.fetch_or(chunk_res);
+                     });
+  return res;
+}
+
+//--------------------------------------------------------------------------------------------------
+// batch_decompress
+//--------------------------------------------------------------------------------------------------
+int batch_decompress(basct::span<cg1t::element_p2> ex_p,
+                     basct::cspan<cg1t::compressed_element> ex_c) noexcept {
+  SXT_DEBUG_ASSERT(ex_p.size() == ex_c.size());
+  return batch_decompress_impl(ex_c.size(),
+                               [&](size_t i) noexcept { return decompress(ex_p[i], ex_c[i]); });
+}
+
+int batch_decompress(basct::span<cg1t::element_affine> ex_a,
+                     basct::cspan<cg1t::compressed_element> ex_c) noexcept {
+  SXT_DEBUG_ASSERT(ex_a.size() == ex_c.size());
+  return batch_decompress_impl(ex_c.size(), [&](size_t i) noexcept {
+    // decompress produces either the identity or an element with Z = 1, so no inversion is
+    // needed to get to affine coordinates
+    cg1t::element_p2 e_p;
+    if (decompress(e_p, ex_c[i]) != 0) {
+      return -1;
+    }
+    if (e_p == cg1t::element_p2::identity()) {
+      ex_a[i] = cg1t::element_affine::identity();
+    } else {
+      ex_a[i] = cg1t::element_affine{e_p.X, e_p.Y, false};
+    }
+    return 0;
+  });
 }
 } // namespace sxt::cg1o
@@ -20,6 +20,7 @@
 
 namespace sxt::cg1t {
 class compressed_element;
+struct element_affine;
 struct element_p2;
 } // namespace sxt::cg1t
 
@@ -29,9 +30,32 @@ namespace sxt::cg1o {
 //--------------------------------------------------------------------------------------------------
 void compress(cg1t::compressed_element& e_c, const cg1t::element_p2& e_p) noexcept;
 
+//--------------------------------------------------------------------------------------------------
+// decompress
+//--------------------------------------------------------------------------------------------------
+/*
+ Returns 0 if e_c encodes an element of the G1 subgroup; otherwise, returns -1 and leaves e_p
+ unspecified.
+ */
+int decompress(cg1t::element_p2& e_p, const cg1t::compressed_element& e_c) noexcept;
+
 //--------------------------------------------------------------------------------------------------
 // batch_compress
 //--------------------------------------------------------------------------------------------------
 void batch_compress(basct::span<cg1t::compressed_element> ex_c,
                     basct::cspan<cg1t::element_p2> ex_p) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// batch_decompress
+//--------------------------------------------------------------------------------------------------
+/*
+ Decompress the elements in parallel over host threads.
+
+ Returns 0 if every element was decompressed; otherwise, returns -1.
+ */
+int batch_decompress(basct::span<cg1t::element_p2> ex_p,
+                     basct::cspan<cg1t::compressed_element> ex_c) noexcept;
+
+int batch_decompress(basct::span<cg1t::element_affine> ex_a,
+                     basct::cspan<cg1t::compressed_element> ex_c) noexcept;
 } // namespace sxt::cg1o
@@ -16,10 +16,17 @@
  */
 #include "sxt/curve_g1/operation/compression.h"
 
+#include <vector>
+
 #include "sxt/base/test/unit_test.h"
 #include "sxt/curve_g1/constant/generator.h"
+#include "sxt/curve_g1/operation/add.h"
+#include "sxt/curve_g1/operation/neg.h"
 #include "sxt/curve_g1/type/compressed_element.h"
+#include "sxt/curve_g1/type/conversion_utility.h"
+#include "sxt/curve_g1/type/element_affine.h"
 #include "sxt/curve_g1/type/element_p2.h"
+#include "sxt/field12/base/byte_conversion.h"
 #include "sxt/field12/constant/one.h"
 #include "sxt/field12/constant/zero.h"
 #include "sxt/field12/operation/mul.h"
@@ -131,3 +138,118 @@ TEST_CASE("compression of two G1 curve elements that are") {
     REQUIRE(ce1 == ce2);
   }
 }
+
+TEST_CASE("we can decompress G1 elements") {
+  cg1t::compressed_element ce;
+  cg1t::element_p2 e;
+
+  SECTION("we can round trip the generator") {
+    compress(ce, cg1cn::generator_p2_v);
+    REQUIRE(decompress(e, ce) == 0);
+    REQUIRE(e == cg1cn::generator_p2_v);
+  }
+
+  SECTION("we can round trip an element whose y-coordinate is lexicographically largest") {
+    cg1t::element_p2 p;
+    neg(p, cg1cn::generator_p2_v);
+    compress(ce, p);
+    REQUIRE(decompress(e, ce) == 0);
+    REQUIRE(e == p);
+  }
+
+  SECTION("we can round trip the point at infinity") {
+    compress(ce, cg1t::element_p2::identity());
+    REQUIRE(decompress(e, ce) == 0);
+    REQUIRE(e == cg1t::element_p2::identity());
+  }
+
+  SECTION("we fail if the compression bit isn't set") {
+    compress(ce, cg1cn::generator_p2_v);
+    ce.data()[0] &= 0x7f;
+    REQUIRE(decompress(e, ce) != 0);
+  }
+
+  SECTION("we fail on a malformed point at infinity") {
+    compress(ce, cg1t::element_p2::identity());
+    ce.data()[47] = 1;
+    REQUIRE(decompress(e, ce) != 0);
+  }
+
+  SECTION("we fail if the x-coordinate isn't on the curve") {
+    // x = 1 gives y^2 = 5 which isn't a square
+    f12b::to_bytes(ce.data(), f12cn::one_v.data());
+    ce.data()[0] |= static_cast<uint8_t>(1) << 7;
+    REQUIRE(decompress(e, ce) != 0);
+  }
+
+  SECTION("we fail if the element isn't in the subgroup") {
+    // (0, 2) is on the curve but has order 3
+    f12b::to_bytes(ce.data(), f12cn::zero_v.data());
+    ce.data()[0] |= static_cast<uint8_t>(1) << 7;
+    REQUIRE(decompress(e, ce) != 0);
+  }
+}
+
+TEST_CASE("we can batch decompress G1 elements") {
+  std::vector<cg1t::element_p2> elements = {cg1cn::generator_p2_v,
+                                            cg1t::element_p2::identity()};
+  std::vector<cg1t::compressed_element> compressed(2);
+  batch_compress(compressed, elements);
+  std::vector<cg1t::element_p2> res(2);
+
+  SECTION("we can decompress valid elements") {
+    REQUIRE(batch_decompress(res, compressed) == 0);
+    REQUIRE(res == elements);
+  }
+
+  SECTION("we fail if any element is invalid") {
+    compressed[1].data()[0] = 0;
+    REQUIRE(batch_decompress(res, compressed) != 0);
+  }
+
+  SECTION("we can decompress to affine coordinates") {
+    std::vector<cg1t::element_affine> res_a(2);
+    REQUIRE(batch_decompress(res_a, compressed) == 0);
+    REQUIRE(res_a[0] == cg1cn::generator_affine_v);
+    REQUIRE(res_a[1] == cg1t::element_affine::identity());
+  }
+
+  SECTION("we can decompress batches split across threads") {
+    elements.resize(500);
+    elements[0] = cg1cn::generator_p2_v;
+    for (size_t i = 1; i < elements.size(); ++i) {
+      add(elements[i], elements[i - 1], cg1cn::generator_p2_v);
+    }
+    compressed.resize(elements.size());
+    batch_compress(compressed, elements);
+
+    std::vector<cg1t::element_affine> res_a(elements.size());
+    REQUIRE(batch_decompress(res_a, compressed) == 0);
+    for (size_t i = 0; i < elements.size(); ++i) {
+      cg1t::element_affine expected;
+      cg1t::to_element_affine(expected, elements[i]);
+      REQUIRE(res_a[i] == expected);
+    }
+
+    compressed[321].data()[0] = 0;
+    REQUIRE(batch_decompress(res_a, compressed) != 0);
+  }
+}
+
+TEST_CASE("batch compression matches compressing elements one at a time") {
+  std::vector<cg1t::element_p2> elements(1000);
+  elements[0] = cg1cn::generator_p2_v;
+  for (size_t i = 1; i < elements.size(); ++i) {
+    add(elements[i], elements[i - 1], cg1cn::generator_p2_v);
+  }
+  elements[1] = cg1t::element_p2::identity();
+  elements[777] = cg1t::element_p2::identity();
+
+  std::vector<cg1t::compressed_element> compressed(elements.size());
+  batch_compress(compressed, elements);
+  for (size_t i = 0; i < elements.size(); ++i) {
+    cg1t::compressed_element expected;
+    compress(expected, elements[i]);
+    REQUIRE(compressed[i] == expected);
+  }
+}
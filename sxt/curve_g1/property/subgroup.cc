@@ -0,0 +1,72 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/curve_g1/property/subgroup.h"
+
+#include <cstdint>
+
+#include "sxt/curve_g1/constant/beta.h"
+#include "sxt/curve_g1/operation/add.h"
+#include "sxt/curve_g1/operation/double.h"
+#include "sxt/curve_g1/operation/neg.h"
+#include "sxt/curve_g1/type/element_p2.h"
+#include "sxt/field12/operation/mul.h"
+
+namespace sxt::cg1p {
+//--------------------------------------------------------------------------------------------------
+// x_v
+//--------------------------------------------------------------------------------------------------
+/*
+ The absolute value of the curve parameter, x = -0xd201000000010000
+ */
+static constexpr uint64_t x_v = 0xd201000000010000;
+
+//--------------------------------------------------------------------------------------------------
+// multiply_by_abs_x
+//--------------------------------------------------------------------------------------------------
+static void multiply_by_abs_x(cg1t::element_p2& h, const cg1t::element_p2& p) noexcept {
+  cg1t::element_p2 acc{p};
+  for (int bit_index = 62; bit_index >= 0; --bit_index) {
+    cg1o::double_element(acc, acc);
+    if ((x_v >> bit_index) & 1) {
+      cg1o::add(acc, acc, p);
+    }
+  }
+  h = acc;
+}
+
+//--------------------------------------------------------------------------------------------------
+// is_in_subgroup
+//--------------------------------------------------------------------------------------------------
+/*
+ Check that phi(p) == -[x^2] p where phi(X : Y : Z) = (beta X : Y : Z) is the GLV endomorphism.
+
+ See Section 6 of https://eprint.iacr.org/2021/1130 and the updated proof of correctness in
+ https://eprint.iacr.org/2022/352. Since x has only 64 bits and a Hamming weight of 6, this is
+ about a quarter of the cost of checking that [r] p is the identity.
+ */
+bool is_in_subgroup(const cg1t::element_p2& p) noexcept {
+  cg1t::element_p2 phi_p{p};
+  f12o::mul(phi_p.X, p.X, cg1cn::beta_v);
+
+  cg1t::element_p2 q;
+  multiply_by_abs_x(q, p);
+  multiply_by_abs_x(q, q);
+  cg1o::neg(q, q);
+
+  return phi_p == q;
+}
+} // namespace sxt::cg1p
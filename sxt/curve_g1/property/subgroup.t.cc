@@ -0,0 +1,97 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/curve_g1/property/subgroup.h"
+
+#include "sxt/base/test/unit_test.h"
+#include "sxt/curve_g1/constant/generator.h"
+#include "sxt/curve_g1/constant/b.h"
+#include "sxt/curve_g1/operation/double.h"
+#include "sxt/curve_g1/operation/scalar_multiply.h"
+#include "sxt/curve_g1/property/identity.h"
+#include "sxt/curve_g1/type/element_p2.h"
+#include "sxt/field12/base/montgomery.h"
+#include "sxt/field12/constant/one.h"
+#include "sxt/field12/constant/zero.h"
+#include "sxt/field12/operation/add.h"
+#include "sxt/field12/operation/mul.h"
+#include "sxt/field12/operation/sqrt.h"
+#include "sxt/field12/operation/square.h"
+#include "sxt/field12/type/element.h"
+
+using namespace sxt;
+using namespace sxt::cg1p;
+
+//--------------------------------------------------------------------------------------------------
+// r_v
+//--------------------------------------------------------------------------------------------------
+// The order of the G1 subgroup in little endian
+static constexpr uint8_t r_v[32] = {
+    0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x5b, 0xfe, 0xff, 0x02, 0xa4, 0xbd, 0x53,
+    0x05, 0xd8, 0xa1, 0x09, 0x08, 0xd8, 0x39, 0x33, 0x48, 0x7d, 0x9d, 0x29, 0x53, 0xa7, 0xed, 0x73,
+};
+
+TEST_CASE("we can check if an element is in the G1 subgroup") {
+  SECTION("the identity is in the subgroup") {
+    REQUIRE(is_in_subgroup(cg1t::element_p2::identity()));
+  }
+
+  SECTION("the generator and its multiples are in the subgroup") {
+    REQUIRE(is_in_subgroup(cg1cn::generator_p2_v));
+    cg1t::element_p2 p;
+    cg1o::double_element(p, cg1cn::generator_p2_v);
+    REQUIRE(is_in_subgroup(p));
+  }
+
+  SECTION("an element of order 3 is not in the subgroup") {
+    // (0, 2) is on the curve y^2 = x^3 + 4
+    f12t::element two;
+    f12o::add(two, f12cn::one_v, f12cn::one_v);
+    cg1t::element_p2 p{f12cn::zero_v, two, f12cn::one_v};
+    REQUIRE(!is_in_subgroup(p));
+  }
+
+  SECTION("we agree with checking that [r] p is the identity") {
+    size_t num_points = 0;
+    for (uint64_t i = 1; i < 50; ++i) {
+      uint64_t x_raw[6] = {i};
+      f12t::element x;
+      f12b::to_montgomery_form(x.data(), x_raw);
+      f12t::element y2;
+      f12o::square(y2, x);
+      f12o::mul(y2, y2, x);
+      f12o::add(y2, y2, cg1cn::b_v);
+      f12t::element y;
+      if (!f12o::sqrt(y, y2)) {
+        continue;
+      }
+      ++num_points;
+      cg1t::element_p2 p{x, y, f12cn::one_v};
+      cg1t::element_p2 rp;
+      cg1o::scalar_multiply255(rp, p, r_v);
+      REQUIRE(is_in_subgroup(p) == is_identity(rp));
+    }
+    REQUIRE(num_points > 0);
+
+    // the generator is in the subgroup and has a projective representation with Z != 1
+    cg1t::element_p2 g2;
+    cg1o::double_element(g2, cg1cn::generator_p2_v);
+    cg1t::element_p2 rp;
+    cg1o::scalar_multiply255(rp, g2, r_v);
+    REQUIRE(is_identity(rp));
+    REQUIRE(is_in_subgroup(g2));
+  }
+}
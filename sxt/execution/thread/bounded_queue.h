@@ -0,0 +1,94 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <optional>
+
+#include "sxt/base/error/assert.h"
+
+namespace sxt::xent {
+//--------------------------------------------------------------------------------------------------
+// bounded_queue
+//--------------------------------------------------------------------------------------------------
+/**
+ * A multi-producer, multi-consumer queue holding at most capacity items, used to hand work between
+ * pipeline stages running on different threads.
+ *
+ * push blocks while the queue is full, and pop blocks while the queue is empty and still open.
+ */
+template <class T> class bounded_queue {
+public:
+  explicit bounded_queue(size_t capacity) noexcept : capacity_{capacity} {
+    SXT_RELEASE_ASSERT(capacity > 0);
+  }
+
+  bounded_queue(const bounded_queue&) = delete;
+  bounded_queue& operator=(const bounded_queue&) = delete;
+
+  /**
+   * Add an item, waiting for space if the queue is full.
+   */
+  void push(T&& item) noexcept {
+    std::unique_lock<std::mutex> lock{mutex_};
+    not_full_.wait(lock, [&]() noexcept { return items_.size() < capacity_; });
+    SXT_DEBUG_ASSERT(!closed_);
+    items_.emplace_back(std::move(item));
+    lock.unlock();
+    not_empty_.notify_one();
+  }
+
+  /**
+   * Remove the oldest item, waiting for one if the queue is empty. Returns an empty optional once
+   * the queue is closed and drained.
+   */
+  std::optional<T> pop() noexcept {
+    std::unique_lock<std::mutex> lock{mutex_};
+    not_empty_.wait(lock, [&]() noexcept { return !items_.empty() || closed_; });
+    if (items_.empty()) {
+      return std::nullopt;
+    }
+    std::optional<T> res{std::move(items_.front())};
+    items_.pop_front();
+    lock.unlock();
+    not_full_.notify_one();
+    return res;
+  }
+
+  /**
+   * Signal that no more items will be pushed.
+   */
+  void close() noexcept {
+    {
+      std::lock_guard<std::mutex> lock{mutex_};
+      closed_ = true;
+    }
+    not_empty_.notify_all();
+  }
+
+private:
+  size_t capacity_;
+  bool closed_ = false;
+  std::deque<T> items_;
+  std::mutex mutex_;
+  std::condition_variable not_full_;
+  std::condition_variable not_empty_;
+};
+} // namespace sxt::xent
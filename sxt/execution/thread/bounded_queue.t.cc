@@ -0,0 +1,69 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/execution/thread/bounded_queue.h"
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "sxt/base/test/unit_test.h"
+
+using namespace sxt;
+using namespace sxt::xent;
+
+TEST_CASE("we can pass items through a bounded queue") {
+  bounded_queue<int> queue{2};
+
+  SECTION("a closed empty queue pops nothing") {
+    queue.close();
+    REQUIRE(!queue.pop());
+  }
+
+  SECTION("items are popped in the order they're pushed") {
+    queue.push(1);
+    queue.push(2);
+    queue.close();
+    REQUIRE(*queue.pop() == 1);
+    REQUIRE(*queue.pop() == 2);
+    REQUIRE(!queue.pop());
+  }
+
+  SECTION("we can queue move-only items") {
+    bounded_queue<std::unique_ptr<int>> ptr_queue{1};
+    ptr_queue.push(std::make_unique<int>(3));
+    auto ptr = ptr_queue.pop();
+    REQUIRE(**ptr == 3);
+  }
+
+  SECTION("a producer blocks until a consumer makes space") {
+    std::thread producer{[&]() noexcept {
+      for (int i = 0; i < 100; ++i) {
+        queue.push(int{i});
+      }
+      queue.close();
+    }};
+    std::vector<int> values;
+    while (auto value = queue.pop()) {
+      values.push_back(*value);
+    }
+    producer.join();
+    REQUIRE(values.size() == 100);
+    for (int i = 0; i < 100; ++i) {
+      REQUIRE(values[i] == i);
+    }
+  }
+}
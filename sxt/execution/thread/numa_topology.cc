@@ -0,0 +1,214 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/execution/thread/numa_topology.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#endif
+
+namespace sxt::xent {
+//--------------------------------------------------------------------------------------------------
+// parse_uint
+//--------------------------------------------------------------------------------------------------
+static bool parse_uint(unsigned& res, std::string_view s) noexcept {
+  auto [ptr, ec] = std::from_chars(s.data(), s.data() + s.size(), res);
+  return ec == std::errc{} && ptr == s.data() + s.size();
+}
+
+//--------------------------------------------------------------------------------------------------
+// make_default_topology
+//--------------------------------------------------------------------------------------------------
+static std::vector<numa_node> make_default_topology() noexcept {
+  numa_node node{.id = 0, .cpus = {}};
+  auto num_cpus = std::max(std::thread::hardware_concurrency(), 1u);
+  for (unsigned cpu = 0; cpu < num_cpus; ++cpu) {
+    node.cpus.push_back(cpu);
+  }
+  return {node};
+}
+
+//--------------------------------------------------------------------------------------------------
+// parse_cpu_list
+//--------------------------------------------------------------------------------------------------
+std::vector<unsigned> parse_cpu_list(std::string_view s) noexcept {
+  std::vector<unsigned> res;
+  while (!s.empty() && (s.back() == '\n' || s.back() == ' ')) {
+    s.remove_suffix(1);
+  }
+  while (!s.empty()) {
+    auto pos = s.find(',');
+    auto item = s.substr(0, pos);
+    s = pos == std::string_view::npos ? std::string_view{} : s.substr(pos + 1);
+    unsigned first, last;
+    auto dash = item.find('-');
+    if (dash == std::string_view::npos) {
+      if (!parse_uint(first, item)) {
+        return {};
+      }
+      last = first;
+    } else if (!parse_uint(first, item.substr(0, dash)) ||
+               !parse_uint(last, item.substr(dash + 1)) || last < first) {
+      return {};
+    }
+    for (auto cpu = first; cpu <= last; ++cpu) {
+      res.push_back(cpu);
+    }
+  }
+  return res;
+}
+
+//--------------------------------------------------------------------------------------------------
+// read_numa_topology
+//--------------------------------------------------------------------------------------------------
+std::vector<numa_node> read_numa_topology(const std::string& root) noexcept {
+  std::vector<numa_node> res;
+  std::error_code ec;
+  for (auto& entry : std::filesystem::directory_iterator{root, ec}) {
+    auto name = entry.path().filename().string();
+    numa_node node;
+    if (!name.starts_with("node") || !parse_uint(node.id, std::string_view{name}.substr(4))) {
+      continue;
+    }
+    std::ifstream in{entry.path() / "cpulist"};
+    std::string cpulist;
+    if (!std::getline(in, cpulist)) {
+      continue;
+    }
+    node.cpus = parse_cpu_list(cpulist);
+    if (!node.cpus.empty()) {
+      res.emplace_back(std::move(node));
+    }
+  }
+  std::sort(res.begin(), res.end(),
+            [](const numa_node& lhs, const numa_node& rhs) noexcept { return lhs.id < rhs.id; });
+  return res;
+}
+
+//--------------------------------------------------------------------------------------------------
+// get_numa_topology
+//--------------------------------------------------------------------------------------------------
+const std::vector<numa_node>& get_numa_topology() noexcept {
+  static const std::vector<numa_node> topology = []() noexcept {
+    auto res = read_numa_topology("/sys/devices/system/node");
+    if (res.empty()) {
+      return make_default_topology();
+    }
+    return res;
+  }();
+  return topology;
+}
+
+//--------------------------------------------------------------------------------------------------
+// get_current_numa_node
+//--------------------------------------------------------------------------------------------------
+size_t get_current_numa_node() noexcept {
+  auto& topology = get_numa_topology();
+  if (topology.size() == 1) {
+    return 0;
+  }
+#ifdef __linux__
+  auto cpu = sched_getcpu();
+  if (cpu < 0) {
+    return 0;
+  }
+  for (size_t node_index = 0; node_index < topology.size(); ++node_index) {
+    auto& cpus = topology[node_index].cpus;
+    if (std::find(cpus.begin(), cpus.end(), static_cast<unsigned>(cpu)) != cpus.end()) {
+      return node_index;
+    }
+  }
+#endif
+  return 0;
+}
+
+//--------------------------------------------------------------------------------------------------
+// pin_current_thread
+//--------------------------------------------------------------------------------------------------
+void pin_current_thread(basct::cspan<unsigned> cpus) noexcept {
+#ifdef __linux__
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for (auto cpu : cpus) {
+    if (cpu < CPU_SETSIZE) {
+      CPU_SET(cpu, &set);
+    }
+  }
+  pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+  (void)cpus;
+#endif
+}
+
+//--------------------------------------------------------------------------------------------------
+// for_each_numa_node
+//--------------------------------------------------------------------------------------------------
+void for_each_numa_node(basf::function_ref<void(size_t)> f) noexcept {
+  auto& topology = get_numa_topology();
+  std::vector<std::thread> threads;
+  threads.reserve(topology.size());
+  for (size_t node_index = 0; node_index < topology.size(); ++node_index) {
+    threads.emplace_back([&, node_index]() noexcept {
+      pin_current_thread(topology[node_index].cpus);
+      f(node_index);
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// get_page_size
+//--------------------------------------------------------------------------------------------------
+static size_t get_page_size() noexcept {
+#ifdef __linux__
+  auto res = sysconf(_SC_PAGESIZE);
+  if (res > 0) {
+    return static_cast<size_t>(res);
+  }
+#endif
+  return 4096;
+}
+
+//--------------------------------------------------------------------------------------------------
+// interleave_first_touch
+//--------------------------------------------------------------------------------------------------
+void interleave_first_touch(basct::span<std::byte> data) noexcept {
+  auto num_nodes = get_numa_topology().size();
+  if (num_nodes == 1 || data.empty()) {
+    return;
+  }
+  auto page_size = get_page_size();
+  auto address = reinterpret_cast<uintptr_t>(data.data());
+  auto first_page = (page_size - address % page_size) % page_size;
+  for_each_numa_node([&](size_t node_index) noexcept {
+    for (auto offset = first_page + node_index * page_size; offset < data.size();
+         offset += num_nodes * page_size) {
+      data[offset] = std::byte{0};
+    }
+  });
+}
+} // namespace sxt::xent
@@ -0,0 +1,103 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "sxt/base/container/span.h"
+#include "sxt/base/functional/function_ref.h"
+
+namespace sxt::xent {
+//--------------------------------------------------------------------------------------------------
+// numa_node
+//--------------------------------------------------------------------------------------------------
+struct numa_node {
+  unsigned id;
+  std::vector<unsigned> cpus;
+
+  bool operator==(const numa_node&) const noexcept = default;
+};
+
+//--------------------------------------------------------------------------------------------------
+// parse_cpu_list
+//--------------------------------------------------------------------------------------------------
+/**
+ * Parse a cpu list in the kernel's format, e.g. "0-3,8,10-11".
+ */
+std::vector<unsigned> parse_cpu_list(std::string_view s) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// read_numa_topology
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read the NUMA nodes described by the node<N>/cpulist files of a directory laid out like
+ * /sys/devices/system/node. Nodes without cpus are skipped and the result is sorted by id.
+ */
+std::vector<numa_node> read_numa_topology(const std::string& root) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// get_numa_topology
+//--------------------------------------------------------------------------------------------------
+/**
+ * The NUMA nodes of this machine. If the topology can't be read, a single node holding every cpu
+ * is reported.
+ */
+const std::vector<numa_node>& get_numa_topology() noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// get_current_numa_node
+//--------------------------------------------------------------------------------------------------
+/**
+ * The index into get_numa_topology() of the node the calling thread is running on.
+ */
+size_t get_current_numa_node() noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// pin_current_thread
+//--------------------------------------------------------------------------------------------------
+/**
+ * Restrict the calling thread to the given cpus. Does nothing where thread affinity isn't
+ * supported.
+ */
+void pin_current_thread(basct::cspan<unsigned> cpus) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// for_each_numa_node
+//--------------------------------------------------------------------------------------------------
+/**
+ * Invoke f(node_index) for every NUMA node, each on its own thread pinned to that node, so that
+ * memory f first touches is placed on the node.
+ */
+void for_each_numa_node(basf::function_ref<void(size_t)> f) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// interleave_first_touch
+//--------------------------------------------------------------------------------------------------
+/**
+ * Spread the pages of memory that hasn't been touched yet round-robin across the NUMA nodes by
+ * writing a zero byte at the start of each page from a thread pinned to the page's node. Does
+ * nothing on a single node machine.
+ *
+ * This places a large table that every node reads, such as the precomputed generators, so that
+ * reads are balanced across the nodes' memory controllers instead of all landing on the node of
+ * the thread that allocated it.
+ */
+void interleave_first_touch(basct::span<std::byte> data) noexcept;
+} // namespace sxt::xent
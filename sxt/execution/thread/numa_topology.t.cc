@@ -0,0 +1,98 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/execution/thread/numa_topology.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#include "sxt/base/test/unit_test.h"
+
+using namespace sxt;
+using namespace sxt::xent;
+
+TEST_CASE("we can parse cpu lists") {
+  REQUIRE(parse_cpu_list("").empty());
+  REQUIRE(parse_cpu_list("3") == std::vector<unsigned>{3});
+  REQUIRE(parse_cpu_list("0-3\n") == std::vector<unsigned>{0, 1, 2, 3});
+  REQUIRE(parse_cpu_list("0-1,8,10-11") == std::vector<unsigned>{0, 1, 8, 10, 11});
+  REQUIRE(parse_cpu_list("3-1").empty());
+  REQUIRE(parse_cpu_list("a").empty());
+}
+
+TEST_CASE("we can read a NUMA topology") {
+  auto root = std::filesystem::temp_directory_path() / "sxt_numa_topology_test";
+  std::filesystem::remove_all(root);
+  std::filesystem::create_directories(root);
+
+  SECTION("we handle a missing directory") {
+    REQUIRE(read_numa_topology((root / "missing").string()).empty());
+  }
+
+  SECTION("we read nodes sorted by id and skip nodes without cpus") {
+    auto write_node = [&](const char* name, const char* cpulist) noexcept {
+      std::filesystem::create_directories(root / name);
+      std::ofstream{root / name / "cpulist"} << cpulist;
+    };
+    write_node("node1", "4-7\n");
+    write_node("node0", "0-3\n");
+    write_node("node2", "\n");
+    std::filesystem::create_directories(root / "power");
+    auto topology = read_numa_topology(root.string());
+    std::vector<numa_node> expected = {
+        {.id = 0, .cpus = {0, 1, 2, 3}},
+        {.id = 1, .cpus = {4, 5, 6, 7}},
+    };
+    REQUIRE(topology == expected);
+  }
+
+  std::filesystem::remove_all(root);
+}
+
+TEST_CASE("we can query the machine's NUMA topology") {
+  auto& topology = get_numa_topology();
+  REQUIRE(!topology.empty());
+  REQUIRE(get_current_numa_node() < topology.size());
+}
+
+TEST_CASE("we can run a function on every NUMA node") {
+  auto num_nodes = get_numa_topology().size();
+  std::vector<std::atomic<int>> counts(num_nodes);
+  for_each_numa_node([&](size_t node_index) noexcept { ++counts[node_index]; });
+  for (auto& count : counts) {
+    REQUIRE(count == 1);
+  }
+}
+
+TEST_CASE("we can interleave the first touch of memory across NUMA nodes") {
+  std::vector<std::byte> data(1u << 20u, std::byte{0xff});
+  interleave_first_touch(data);
+
+  // only the first byte of a page may have been written
+  for (size_t i = 0; i < data.size(); ++i) {
+    if (data[i] != std::byte{0xff}) {
+      REQUIRE(data[i] == std::byte{0});
+      REQUIRE(reinterpret_cast<uintptr_t>(data.data() + i) % 4096 == 0);
+    }
+  }
+  if (get_numa_topology().size() == 1) {
+    REQUIRE(std::count(data.begin(), data.end(), std::byte{0}) == 0);
+  }
+}
@@ -0,0 +1,74 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/execution/thread/parallel_for.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "sxt/base/iterator/index_range_iterator.h"
+#include "sxt/base/iterator/index_range_utility.h"
+
+namespace sxt::xent {
+//--------------------------------------------------------------------------------------------------
+// get_num_threads
+//--------------------------------------------------------------------------------------------------
+size_t get_num_threads() noexcept {
+  return std::max<size_t>(std::thread::hardware_concurrency(), 1);
+}
+
+//--------------------------------------------------------------------------------------------------
+// parallel_for
+//--------------------------------------------------------------------------------------------------
+void parallel_for(basit::index_range rng, basf::function_ref<void(basit::index_range)> f,
+                  size_t num_threads) noexcept {
+  if (rng.size() == 0) {
+    return;
+  }
+  num_threads = std::max<size_t>(num_threads, 1);
+  auto [first, last] = basit::split(rng, num_threads);
+  std::vector<basit::index_range> chunks(first, last);
+  if (chunks.size() == 1) {
+    f(chunks[0]);
+    return;
+  }
+
+  // chunk sizes can be capped below rng.size() / num_threads, so threads pull chunks until
+  // there are none left
+  std::atomic<size_t> next_chunk = 0;
+  auto work = [&]() noexcept {
+    for (auto j = next_chunk++; j < chunks.size(); j = next_chunk++) {
+      f(chunks[j]);
+    }
+  };
+  std::vector<std::thread> threads;
+  threads.reserve(std::min(num_threads, chunks.size()) - 1);
+  for (size_t i = 1; i < std::min(num_threads, chunks.size()); ++i) {
+    threads.emplace_back(work);
+  }
+  work();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+void parallel_for(basit::index_range rng,
+                  basf::function_ref<void(basit::index_range)> f) noexcept {
+  parallel_for(rng, f, get_num_threads());
+}
+} // namespace sxt::xent
@@ -0,0 +1,45 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+
+#include "sxt/base/functional/function_ref.h"
+#include "sxt/base/iterator/index_range.h"
+
+namespace sxt::xent {
+//--------------------------------------------------------------------------------------------------
+// get_num_threads
+//--------------------------------------------------------------------------------------------------
+/**
+ * The number of host threads to use for parallel work.
+ */
+size_t get_num_threads() noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// parallel_for
+//--------------------------------------------------------------------------------------------------
+/**
+ * Split rng into about num_threads chunks, respecting the range's chunk size bounds, and invoke
+ * f on each chunk using at most num_threads host threads. The calling thread takes part in the
+ * work and returns once every chunk is done.
+ */
+void parallel_for(basit::index_range rng, basf::function_ref<void(basit::index_range)> f,
+                  size_t num_threads) noexcept;
+
+void parallel_for(basit::index_range rng, basf::function_ref<void(basit::index_range)> f) noexcept;
+} // namespace sxt::xent
@@ -0,0 +1,91 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/execution/thread/parallel_for.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "sxt/base/test/unit_test.h"
+
+using namespace sxt;
+using namespace sxt::xent;
+
+TEST_CASE("we can run work over an index range in parallel") {
+  SECTION("we handle an empty range") {
+    size_t num_calls = 0;
+    parallel_for(basit::index_range{0, 0}, [&](basit::index_range) noexcept { ++num_calls; });
+    REQUIRE(num_calls == 0);
+  }
+
+  SECTION("we visit every index exactly once") {
+    std::vector<std::atomic<int>> counts(1000);
+    parallel_for(
+        basit::index_range{0, counts.size()},
+        [&](basit::index_range chunk) noexcept {
+          for (size_t i = chunk.a(); i < chunk.b(); ++i) {
+            ++counts[i];
+          }
+        },
+        7);
+    for (auto& count : counts) {
+      REQUIRE(count == 1);
+    }
+  }
+
+  SECTION("we bound the number of threads when chunks are capped") {
+    std::mutex m;
+    std::vector<std::thread::id> ids;
+    std::atomic<size_t> num_calls = 0;
+    parallel_for(
+        basit::index_range{0, 100}.max_chunk_size(1),
+        [&](basit::index_range /*chunk*/) noexcept {
+          ++num_calls;
+          std::lock_guard<std::mutex> lock{m};
+          ids.push_back(std::this_thread::get_id());
+        },
+        3);
+    REQUIRE(num_calls == 100);
+    std::sort(ids.begin(), ids.end());
+    REQUIRE(std::unique(ids.begin(), ids.end()) - ids.begin() <= 3);
+  }
+
+  SECTION("we respect the minimum chunk size") {
+    std::atomic<int> num_calls = 0;
+    std::atomic<size_t> min_size = 10;
+    parallel_for(
+        basit::index_range{0, 10}.min_chunk_size(5),
+        [&](basit::index_range chunk) noexcept {
+          min_size = std::min<size_t>(min_size, chunk.size());
+          ++num_calls;
+        },
+        8);
+    REQUIRE(num_calls == 2);
+    REQUIRE(min_size == 5);
+  }
+
+  SECTION("we can use the default number of threads") {
+    REQUIRE(get_num_threads() >= 1);
+    std::atomic<size_t> sum = 0;
+    parallel_for(basit::index_range{0, 100}, [&](basit::index_range chunk) noexcept {
+      sum += chunk.size();
+    });
+    REQUIRE(sum == 100);
+  }
+}
@@ -0,0 +1,165 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+
+#include "sxt/base/macro/cuda_callable.h"
+#include "sxt/field51/operation/mul.h"
+#include "sxt/field51/operation/sq.h"
+#include "sxt/field51/type/element.h"
+#include "sxt/field51/type/unreduced_element.h"
+
+namespace sxt::f51o {
+//--------------------------------------------------------------------------------------------------
+// max_mul_operand_bound_v
+//--------------------------------------------------------------------------------------------------
+/**
+ * Largest limb bound of a mul or sq operand for which the 128-bit accumulations and the final
+ * carry into the lowest limb can't overflow.
+ */
+constexpr uint64_t max_mul_operand_bound_v = 1ull << 54u;
+
+//--------------------------------------------------------------------------------------------------
+// max_sq2_operand_bound_v
+//--------------------------------------------------------------------------------------------------
+/**
+ * sq2 doubles its accumulations before carrying, which halves the headroom of the final carry.
+ */
+constexpr uint64_t max_sq2_operand_bound_v = 1ull << 53u;
+
+//--------------------------------------------------------------------------------------------------
+// p_low_limb_v
+//--------------------------------------------------------------------------------------------------
+/**
+ * The limbs of p = 2^255 - 19 are p_low_limb_v followed by four limbs of p_high_limb_v.
+ */
+constexpr uint64_t p_low_limb_v = 0x7ffffffffffedULL;
+
+//--------------------------------------------------------------------------------------------------
+// p_high_limb_v
+//--------------------------------------------------------------------------------------------------
+constexpr uint64_t p_high_limb_v = 0x7ffffffffffffULL;
+
+//--------------------------------------------------------------------------------------------------
+// sub_bias_multiple_v
+//--------------------------------------------------------------------------------------------------
+/**
+ * The smallest k such that every limb of k * p is at least Bound, so that g can be subtracted
+ * from f + k * p limb by limb without carrying g first.
+ */
+template <uint64_t Bound>
+constexpr uint64_t sub_bias_multiple_v = (Bound + p_low_limb_v - 1) / p_low_limb_v;
+
+//--------------------------------------------------------------------------------------------------
+// add
+//--------------------------------------------------------------------------------------------------
+/*
+ h = f + g
+ No limb is carried.
+ */
+template <uint64_t F, uint64_t G>
+CUDA_CALLABLE inline f51t::unreduced_element<F + G>
+add(const f51t::unreduced_element<F>& f, const f51t::unreduced_element<G>& g) noexcept {
+  static_assert(F + G >= F, "limb bound overflows");
+  f51t::unreduced_element<F + G> h;
+  for (int i = 0; i < 5; ++i) {
+    h[i] = f[i] + g[i];
+  }
+  return h;
+}
+
+//--------------------------------------------------------------------------------------------------
+// sub
+//--------------------------------------------------------------------------------------------------
+/*
+ h = f - g
+ Computed as f + k * p - g with k chosen at compile time from the bound of g, so no limb is
+ carried.
+ */
+template <uint64_t F, uint64_t G, uint64_t K = sub_bias_multiple_v<G>>
+CUDA_CALLABLE inline f51t::unreduced_element<F + K * p_high_limb_v>
+sub(const f51t::unreduced_element<F>& f, const f51t::unreduced_element<G>& g) noexcept {
+  static_assert(K <= 1024 && F + K * p_high_limb_v >= F, "limb bound overflows");
+  f51t::unreduced_element<F + K * p_high_limb_v> h;
+  h[0] = (f[0] + K * p_low_limb_v) - g[0];
+  for (int i = 1; i < 5; ++i) {
+    h[i] = (f[i] + K * p_high_limb_v) - g[i];
+  }
+  return h;
+}
+
+//--------------------------------------------------------------------------------------------------
+// mul
+//--------------------------------------------------------------------------------------------------
+/*
+ h = f * g
+ */
+template <uint64_t F, uint64_t G>
+CUDA_CALLABLE inline f51t::unreduced_element<f51t::reduced_bound_v>
+mul(const f51t::unreduced_element<F>& f, const f51t::unreduced_element<G>& g) noexcept {
+  static_assert(F <= max_mul_operand_bound_v && G <= max_mul_operand_bound_v,
+                "operand must be carried before it's multiplied");
+  f51t::unreduced_element<f51t::reduced_bound_v> h;
+  mul(h.value(), f.value(), g.value());
+  return h;
+}
+
+//--------------------------------------------------------------------------------------------------
+// sq
+//--------------------------------------------------------------------------------------------------
+/*
+ h = f * f
+ */
+template <uint64_t F>
+CUDA_CALLABLE inline f51t::unreduced_element<f51t::reduced_bound_v>
+sq(const f51t::unreduced_element<F>& f) noexcept {
+  static_assert(F <= max_mul_operand_bound_v, "operand must be carried before it's squared");
+  f51t::unreduced_element<f51t::reduced_bound_v> h;
+  sq(h.value(), f.value());
+  return h;
+}
+
+//--------------------------------------------------------------------------------------------------
+// sq2
+//--------------------------------------------------------------------------------------------------
+/*
+ h = 2 * f * f
+ */
+template <uint64_t F>
+CUDA_CALLABLE inline f51t::unreduced_element<f51t::reduced_bound_v>
+sq2(const f51t::unreduced_element<F>& f) noexcept {
+  static_assert(F <= max_sq2_operand_bound_v, "operand must be carried before it's squared");
+  f51t::unreduced_element<f51t::reduced_bound_v> h;
+  sq2(h.value(), f.value());
+  return h;
+}
+
+//--------------------------------------------------------------------------------------------------
+// to_element
+//--------------------------------------------------------------------------------------------------
+/*
+ h = f
+ The bound is dropped, so f must still be usable as an operand of mul.
+ */
+template <uint64_t F>
+CUDA_CALLABLE inline void to_element(f51t::element& h,
+                                     const f51t::unreduced_element<F>& f) noexcept {
+  static_assert(F <= max_mul_operand_bound_v, "element must be carried before it's stored");
+  h = f.value();
+}
+} // namespace sxt::f51o
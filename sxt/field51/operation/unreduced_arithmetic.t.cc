@@ -0,0 +1,144 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/field51/operation/unreduced_arithmetic.h"
+
+#include <random>
+
+#include "sxt/base/test/unit_test.h"
+#include "sxt/field51/base/reduce.h"
+#include "sxt/field51/operation/add.h"
+#include "sxt/field51/operation/sub.h"
+#include "sxt/field51/type/element.h"
+
+using namespace sxt;
+using namespace sxt::f51o;
+
+//--------------------------------------------------------------------------------------------------
+// make_random_element
+//--------------------------------------------------------------------------------------------------
+template <uint64_t Bound>
+static f51t::unreduced_element<Bound> make_random_element(std::mt19937_64& rng) noexcept {
+  std::uniform_int_distribution<uint64_t> dist{0, Bound};
+  f51t::unreduced_element<Bound> res;
+  for (int i = 0; i < 5; ++i) {
+    res[i] = dist(rng);
+  }
+  return res;
+}
+
+//--------------------------------------------------------------------------------------------------
+// reduce
+//--------------------------------------------------------------------------------------------------
+template <uint64_t Bound>
+static f51t::element reduce(const f51t::unreduced_element<Bound>& e) noexcept {
+  f51t::element res;
+  f51b::reduce(res.data(), e.value().data());
+  return res;
+}
+
+//--------------------------------------------------------------------------------------------------
+// is_bounded
+//--------------------------------------------------------------------------------------------------
+template <uint64_t Bound>
+static bool is_bounded(const f51t::unreduced_element<Bound>& e) noexcept {
+  for (int i = 0; i < 5; ++i) {
+    if (e[i] > Bound) {
+      return false;
+    }
+  }
+  return true;
+}
+
+TEST_CASE("we can compute the bias of a subtraction") {
+  STATIC_REQUIRE(sub_bias_multiple_v<1> == 1);
+  STATIC_REQUIRE(sub_bias_multiple_v<p_low_limb_v> == 1);
+  STATIC_REQUIRE(sub_bias_multiple_v<f51t::reduced_bound_v> == 2);
+  STATIC_REQUIRE(sub_bias_multiple_v<f51t::element_bound_v> == 3);
+}
+
+TEST_CASE("we can do arithmetic on unreduced elements") {
+  std::mt19937_64 rng{2023};
+
+  SECTION("addition tracks the sum of the bounds") {
+    for (int i = 0; i < 100; ++i) {
+      auto f = make_random_element<f51t::element_bound_v>(rng);
+      auto g = make_random_element<f51t::reduced_bound_v>(rng);
+      auto h = add(f, g);
+      STATIC_REQUIRE(decltype(h)::bound_v == f51t::element_bound_v + f51t::reduced_bound_v);
+      REQUIRE(is_bounded(h));
+      f51t::element expected;
+      f51o::add(expected, reduce(f), reduce(g));
+      REQUIRE(h.value() == expected);
+    }
+  }
+
+  SECTION("subtraction doesn't underflow for operands up to their bounds") {
+    f51t::unreduced_element<f51t::element_bound_v> f{f51t::element{0, 0, 0, 0, 0}};
+    f51t::unreduced_element<f51t::element_bound_v> g{f51t::element{
+        f51t::element_bound_v, f51t::element_bound_v, f51t::element_bound_v,
+        f51t::element_bound_v, f51t::element_bound_v}};
+    auto h = sub(f, g);
+    REQUIRE(is_bounded(h));
+    f51t::element expected;
+    f51o::sub(expected, reduce(f), reduce(g));
+    REQUIRE(h.value() == expected);
+  }
+
+  SECTION("we can subtract elements of different bounds") {
+    for (int i = 0; i < 100; ++i) {
+      auto f = make_random_element<f51t::reduced_bound_v>(rng);
+      auto g = make_random_element<2 * f51t::element_bound_v>(rng);
+      auto h = sub(f, g);
+      STATIC_REQUIRE(decltype(h)::bound_v <= max_mul_operand_bound_v);
+      REQUIRE(is_bounded(h));
+      f51t::element expected;
+      f51o::sub(expected, reduce(f), reduce(g));
+      REQUIRE(h.value() == expected);
+    }
+  }
+
+  SECTION("we can multiply and square operands up to the maximum bounds") {
+    for (int i = 0; i < 100; ++i) {
+      auto f = make_random_element<max_mul_operand_bound_v>(rng);
+      auto g = make_random_element<max_mul_operand_bound_v>(rng);
+      auto h = mul(f, g);
+      REQUIRE(is_bounded(h));
+      f51t::element expected;
+      f51o::mul(expected, reduce(f), reduce(g));
+      REQUIRE(h.value() == expected);
+
+      h = sq(f);
+      REQUIRE(is_bounded(h));
+      f51o::mul(expected, reduce(f), reduce(f));
+      REQUIRE(h.value() == expected);
+
+      auto f2 = make_random_element<max_sq2_operand_bound_v>(rng);
+      h = sq2(f2);
+      REQUIRE(is_bounded(h));
+      f51o::mul(expected, reduce(f2), reduce(f2));
+      f51o::add(expected, expected, expected);
+      REQUIRE(h.value() == expected);
+    }
+  }
+
+  SECTION("we can store an unreduced element") {
+    auto f = make_random_element<f51t::element_bound_v>(rng);
+    f51t::element h;
+    to_element(h, add(f, f));
+    REQUIRE(h == reduce(add(f, f)));
+  }
+}
@@ -0,0 +1,76 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+
+#include "sxt/base/macro/cuda_callable.h"
+#include "sxt/field51/type/element.h"
+
+namespace sxt::f51t {
+//--------------------------------------------------------------------------------------------------
+// reduced_bound_v
+//--------------------------------------------------------------------------------------------------
+/**
+ * Bound on the limbs of a product or square: mul, sq and sq2 carry their output so that every
+ * limb is at most 2^51.
+ */
+constexpr uint64_t reduced_bound_v = 1ull << 51u;
+
+//--------------------------------------------------------------------------------------------------
+// element_bound_v
+//--------------------------------------------------------------------------------------------------
+/**
+ * Bound on the limbs of an element stored in a curve21 point.
+ *
+ * Coordinates are either products or negations of reduced elements, both of which have limbs
+ * below 2^52.
+ */
+constexpr uint64_t element_bound_v = 1ull << 52u;
+
+//--------------------------------------------------------------------------------------------------
+// unreduced_element
+//--------------------------------------------------------------------------------------------------
+/**
+ * A field element whose limbs are at most Bound.
+ *
+ * The bound is part of the type, so operations on unreduced elements can compute the bound of
+ * their result at compile time and only carry where an operand would otherwise overflow. See
+ * sxt/field51/operation/unreduced_arithmetic.h.
+ */
+template <uint64_t Bound = element_bound_v> class unreduced_element {
+public:
+  static constexpr uint64_t bound_v = Bound;
+
+  unreduced_element() noexcept = default;
+
+  CUDA_CALLABLE constexpr explicit unreduced_element(const element& e) noexcept : value_{e} {}
+
+  CUDA_CALLABLE constexpr const element& value() const noexcept { return value_; }
+
+  CUDA_CALLABLE constexpr element& value() noexcept { return value_; }
+
+  CUDA_CALLABLE constexpr const uint64_t& operator[](int index) const noexcept {
+    return value_[index];
+  }
+
+  CUDA_CALLABLE constexpr uint64_t& operator[](int index) noexcept { return value_[index]; }
+
+private:
+  element value_;
+};
+} // namespace sxt::f51t
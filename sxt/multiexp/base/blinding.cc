@@ -0,0 +1,34 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/base/blinding.h"
+
+#include "sxt/base/error/assert.h"
+
+namespace sxt::mtxb {
+//--------------------------------------------------------------------------------------------------
+// make_blinding_sequence
+//--------------------------------------------------------------------------------------------------
+exponent_sequence make_blinding_sequence(basct::cspan<uint8_t> blinding) noexcept {
+  SXT_RELEASE_ASSERT(blinding.size() == num_blinding_digits_v);
+  return exponent_sequence{
+      .element_nbytes = 1,
+      .n = num_blinding_digits_v,
+      .data = blinding.data(),
+      .is_signed = 0,
+  };
+}
+} // namespace sxt::mtxb
@@ -0,0 +1,48 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "sxt/base/container/span.h"
+#include "sxt/multiexp/base/exponent_sequence.h"
+
+namespace sxt::mtxb {
+//--------------------------------------------------------------------------------------------------
+// num_blinding_digits_v
+//--------------------------------------------------------------------------------------------------
+/**
+ * A 32-byte blinding scalar r is committed to as the base-256 digits
+ *
+ *    r = sum_k d_k 2^(8k),  k = 0, ..., 31
+ *
+ * paired with the generators 2^(8k) H. The digits are the little-endian bytes of r, so the
+ * blinding terms of a batch of commitments form a multiexponentiation of num_blinding_digits_v
+ * terms with 1-byte exponents. It's computed apart from the commitments and added to them, so
+ * hiding doesn't touch the committed sequences or their generators.
+ */
+constexpr size_t num_blinding_digits_v = 32;
+
+//--------------------------------------------------------------------------------------------------
+// make_blinding_sequence
+//--------------------------------------------------------------------------------------------------
+/**
+ * Return the digits of blinding as an exponent sequence that views blinding.
+ */
+exponent_sequence make_blinding_sequence(basct::cspan<uint8_t> blinding) noexcept;
+} // namespace sxt::mtxb
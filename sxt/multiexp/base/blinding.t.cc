@@ -0,0 +1,36 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/base/blinding.h"
+
+#include <array>
+
+#include "sxt/base/test/unit_test.h"
+
+using namespace sxt;
+using namespace sxt::mtxb;
+
+TEST_CASE("we can view a blinding scalar as a sequence of digits") {
+  std::array<uint8_t, 32> blinding;
+  for (size_t i = 0; i < blinding.size(); ++i) {
+    blinding[i] = static_cast<uint8_t>(0x81 + 7 * i);
+  }
+  auto seq = make_blinding_sequence(blinding);
+  REQUIRE(seq.element_nbytes == 1);
+  REQUIRE(seq.n == num_blinding_digits_v);
+  REQUIRE(seq.data == blinding.data());
+  REQUIRE(seq.is_signed == 0);
+}
@@ -0,0 +1,191 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/base/column_expression.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "sxt/base/error/assert.h"
+#include "sxt/multiexp/base/exponent_sequence.h"
+#include "sxt/scalar25/operation/add.h"
+#include "sxt/scalar25/operation/mul.h"
+#include "sxt/scalar25/operation/neg.h"
+#include "sxt/scalar25/operation/reduce.h"
+#include "sxt/scalar25/operation/sub.h"
+
+namespace sxt::mtxb {
+//--------------------------------------------------------------------------------------------------
+// load_scalar
+//--------------------------------------------------------------------------------------------------
+static void load_scalar(s25t::element& res, const uint8_t* data, unsigned num_bytes,
+                        bool is_signed) noexcept {
+  auto bytes = res.data();
+  std::memset(bytes, 0, 32);
+  std::memcpy(bytes, data, num_bytes);
+  if (!is_signed || (bytes[num_bytes - 1] & 0x80u) == 0) {
+    s25o::reduce32(res);
+    return;
+  }
+
+  // take the two's complement to get the magnitude, then negate in the field
+  unsigned carry = 1;
+  for (unsigned i = 0; i < num_bytes; ++i) {
+    auto t = static_cast<unsigned>(static_cast<uint8_t>(~bytes[i])) + carry;
+    bytes[i] = static_cast<uint8_t>(t);
+    carry = t >> 8u;
+  }
+  s25o::neg(res, res);
+}
+
+//--------------------------------------------------------------------------------------------------
+// is_valid_column_expression
+//--------------------------------------------------------------------------------------------------
+bool is_valid_column_expression(basct::cspan<column_expression_node> nodes,
+                                size_t num_columns) noexcept {
+  if (nodes.empty()) {
+    return false;
+  }
+  for (size_t node_index = 0; node_index < nodes.size(); ++node_index) {
+    auto& node = nodes[node_index];
+    switch (node.op) {
+    case column_operation::column:
+      if (node.lhs >= num_columns) {
+        return false;
+      }
+      break;
+    case column_operation::add:
+    case column_operation::sub:
+    case column_operation::mul:
+      if (node.lhs >= node_index || node.rhs >= node_index) {
+        return false;
+      }
+      break;
+    case column_operation::scale:
+      if (node.lhs >= node_index) {
+        return false;
+      }
+      break;
+    case column_operation::select:
+      if (node.lhs >= node_index || node.bitmap == nullptr) {
+        return false;
+      }
+      break;
+    default:
+      return false;
+    }
+  }
+  return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+// column_expression_length
+//--------------------------------------------------------------------------------------------------
+size_t column_expression_length(basct::cspan<column_expression_node> nodes,
+                                basct::cspan<exponent_sequence> columns) noexcept {
+  size_t res = 0;
+  for (auto& node : nodes) {
+    if (node.op == column_operation::column) {
+      res = std::max(res, static_cast<size_t>(columns[node.lhs].n));
+    }
+  }
+  return res;
+}
+
+//--------------------------------------------------------------------------------------------------
+// load_column_scalars
+//--------------------------------------------------------------------------------------------------
+void load_column_scalars(basct::span<s25t::element> res, const exponent_sequence& column,
+                         size_t first) noexcept {
+  auto num_bytes = column.element_nbytes;
+  SXT_DEBUG_ASSERT(0 < num_bytes && num_bytes <= 32);
+  auto last = std::min(first + res.size(), static_cast<size_t>(std::max(column.n, first)));
+  auto m = last - first;
+  for (size_t i = 0; i < m; ++i) {
+    load_scalar(res[i], column.data + (first + i) * num_bytes, num_bytes,
+                static_cast<bool>(column.is_signed));
+  }
+  std::fill(res.begin() + m, res.end(), s25t::element::identity());
+}
+
+//--------------------------------------------------------------------------------------------------
+// evaluate_column_expression
+//--------------------------------------------------------------------------------------------------
+void evaluate_column_expression(basct::span<s25t::element> res,
+                                basct::span<s25t::element> scratch,
+                                basct::cspan<column_expression_node> nodes,
+                                basct::cspan<exponent_sequence> columns, size_t first) noexcept {
+  auto m = res.size();
+  SXT_DEBUG_ASSERT(
+      // clang-format off
+      scratch.size() == nodes.size() * m &&
+      is_valid_column_expression(nodes, columns.size())
+      // clang-format on
+  );
+  auto node_values = [&](size_t node_index) noexcept { return scratch.subspan(node_index * m, m); };
+  for (size_t node_index = 0; node_index < nodes.size(); ++node_index) {
+    auto& node = nodes[node_index];
+    auto values = node_values(node_index);
+    switch (node.op) {
+    case column_operation::column:
+      load_column_scalars(values, columns[node.lhs], first);
+      break;
+    case column_operation::add: {
+      auto lhs = node_values(node.lhs);
+      auto rhs = node_values(node.rhs);
+      for (size_t i = 0; i < m; ++i) {
+        s25o::add(values[i], lhs[i], rhs[i]);
+      }
+      break;
+    }
+    case column_operation::sub: {
+      auto lhs = node_values(node.lhs);
+      auto rhs = node_values(node.rhs);
+      for (size_t i = 0; i < m; ++i) {
+        s25o::sub(values[i], lhs[i], rhs[i]);
+      }
+      break;
+    }
+    case column_operation::mul: {
+      auto lhs = node_values(node.lhs);
+      auto rhs = node_values(node.rhs);
+      for (size_t i = 0; i < m; ++i) {
+        s25o::mul(values[i], lhs[i], rhs[i]);
+      }
+      break;
+    }
+    case column_operation::scale: {
+      auto lhs = node_values(node.lhs);
+      for (size_t i = 0; i < m; ++i) {
+        s25o::mul(values[i], lhs[i], node.constant);
+      }
+      break;
+    }
+    case column_operation::select: {
+      auto lhs = node_values(node.lhs);
+      for (size_t i = 0; i < m; ++i) {
+        auto row = first + i;
+        auto is_selected = (node.bitmap[row / 8u] >> (row % 8u)) & 1u;
+        values[i] = is_selected ? lhs[i] : s25t::element::identity();
+      }
+      break;
+    }
+    }
+  }
+  auto values = node_values(nodes.size() - 1);
+  std::copy(values.begin(), values.end(), res.begin());
+}
+} // namespace sxt::mtxb
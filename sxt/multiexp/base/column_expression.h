@@ -0,0 +1,108 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "sxt/base/container/span.h"
+#include "sxt/scalar25/type/element.h"
+
+namespace sxt::mtxb {
+struct exponent_sequence;
+
+//--------------------------------------------------------------------------------------------------
+// column_operation
+//--------------------------------------------------------------------------------------------------
+enum class column_operation : int {
+  // the source column with index lhs
+  column = 0,
+
+  // nodes lhs + rhs
+  add = 1,
+
+  // nodes lhs - rhs
+  sub = 2,
+
+  // the elementwise product of nodes lhs and rhs
+  mul = 3,
+
+  // node lhs multiplied by constant
+  scale = 4,
+
+  // node lhs where the row's bit in bitmap is set; otherwise, zero
+  select = 5,
+};
+
+//--------------------------------------------------------------------------------------------------
+// column_expression_node
+//--------------------------------------------------------------------------------------------------
+/**
+ * A node of a column expression. Nodes are topologically ordered: operands refer to earlier nodes
+ * and the expression's value is that of its last node. Arithmetic is in the scalar field.
+ */
+struct column_expression_node {
+  column_operation op;
+  unsigned lhs;
+  unsigned rhs;
+  s25t::element constant;
+
+  // bit i of bitmap (little endian bit order) selects row i; it must cover every row of the
+  // expression
+  const uint8_t* bitmap;
+};
+
+//--------------------------------------------------------------------------------------------------
+// is_valid_column_expression
+//--------------------------------------------------------------------------------------------------
+bool is_valid_column_expression(basct::cspan<column_expression_node> nodes,
+                                size_t num_columns) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// column_expression_length
+//--------------------------------------------------------------------------------------------------
+/**
+ * The number of rows of an expression: the longest of the columns it references. Shorter columns
+ * are treated as zero-padded.
+ */
+size_t column_expression_length(basct::cspan<column_expression_node> nodes,
+                                basct::cspan<exponent_sequence> columns) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// load_column_scalars
+//--------------------------------------------------------------------------------------------------
+/**
+ * Convert rows first, ..., first + res.size() - 1 of a column to scalars. Signed values are
+ * mapped to their negation in the field.
+ */
+void load_column_scalars(basct::span<s25t::element> res, const exponent_sequence& column,
+                         size_t first) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// evaluate_column_expression
+//--------------------------------------------------------------------------------------------------
+/**
+ * Evaluate rows first, ..., first + res.size() - 1 of an expression.
+ *
+ * scratch must hold nodes.size() * res.size() elements. Evaluating a chunk at a time with a
+ * cache-sized scratch buffer avoids materializing derived columns in full.
+ */
+void evaluate_column_expression(basct::span<s25t::element> res,
+                                basct::span<s25t::element> scratch,
+                                basct::cspan<column_expression_node> nodes,
+                                basct::cspan<exponent_sequence> columns, size_t first) noexcept;
+} // namespace sxt::mtxb
@@ -0,0 +1,130 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/base/column_expression.h"
+
+#include <vector>
+
+#include "sxt/base/test/unit_test.h"
+#include "sxt/multiexp/base/exponent_sequence.h"
+#include "sxt/scalar25/operation/overload.h"
+#include "sxt/scalar25/type/literal.h"
+
+using namespace sxt;
+using namespace sxt::mtxb;
+using s25t::operator""_s25;
+
+TEST_CASE("we can load a column as scalars") {
+  std::vector<s25t::element> res(3);
+
+  SECTION("we handle unsigned values") {
+    std::vector<uint8_t> data = {1, 2, 255};
+    exponent_sequence column{.element_nbytes = 1, .n = 3, .data = data.data(), .is_signed = 0};
+    load_column_scalars(res, column, 0);
+    REQUIRE(res == std::vector<s25t::element>{0x1_s25, 0x2_s25, 0xff_s25});
+  }
+
+  SECTION("we handle signed values") {
+    std::vector<int16_t> data = {-1, 3, -300};
+    exponent_sequence column{.element_nbytes = 2,
+                             .n = 3,
+                             .data = reinterpret_cast<const uint8_t*>(data.data()),
+                             .is_signed = 1};
+    load_column_scalars(res, column, 0);
+    REQUIRE(res == std::vector<s25t::element>{-0x1_s25, 0x3_s25, -0x12c_s25});
+  }
+
+  SECTION("rows past the end of the column are zero") {
+    std::vector<uint8_t> data = {1, 2, 3, 4};
+    exponent_sequence column{.element_nbytes = 1, .n = 4, .data = data.data(), .is_signed = 0};
+    load_column_scalars(res, column, 2);
+    REQUIRE(res == std::vector<s25t::element>{0x3_s25, 0x4_s25, 0x0_s25});
+  }
+}
+
+TEST_CASE("we can validate column expressions") {
+  column_expression_node column_node{.op = column_operation::column, .lhs = 0};
+  column_expression_node add_node{.op = column_operation::add, .lhs = 0, .rhs = 0};
+
+  REQUIRE(!is_valid_column_expression({}, 1));
+
+  std::vector<column_expression_node> nodes = {column_node, add_node};
+  REQUIRE(is_valid_column_expression(nodes, 1));
+  REQUIRE(!is_valid_column_expression(nodes, 0));
+
+  // operands must refer to earlier nodes
+  nodes = {add_node};
+  REQUIRE(!is_valid_column_expression(nodes, 1));
+
+  // select needs a bitmap
+  nodes = {column_node, {.op = column_operation::select, .lhs = 0, .bitmap = nullptr}};
+  REQUIRE(!is_valid_column_expression(nodes, 1));
+}
+
+TEST_CASE("we can evaluate column expressions") {
+  std::vector<uint8_t> a_data = {1, 2, 3, 4, 5};
+  std::vector<uint8_t> b_data = {10, 20, 30};
+  std::vector<exponent_sequence> columns = {
+      {.element_nbytes = 1, .n = 5, .data = a_data.data(), .is_signed = 0},
+      {.element_nbytes = 1, .n = 3, .data = b_data.data(), .is_signed = 0},
+  };
+  std::vector<column_expression_node> nodes = {
+      {.op = column_operation::column, .lhs = 0},
+      {.op = column_operation::column, .lhs = 1},
+  };
+  std::vector<s25t::element> res(2);
+  std::vector<s25t::element> scratch;
+
+  auto evaluate = [&](size_t first) noexcept {
+    scratch.resize(nodes.size() * res.size());
+    evaluate_column_expression(res, scratch, nodes, columns, first);
+  };
+
+  SECTION("the length of an expression is that of its longest column") {
+    REQUIRE(column_expression_length(nodes, columns) == 5);
+  }
+
+  SECTION("we can add and subtract columns") {
+    nodes.push_back({.op = column_operation::sub, .lhs = 0, .rhs = 1});
+    evaluate(0);
+    REQUIRE(res == std::vector<s25t::element>{-0x9_s25, -0x12_s25});
+
+    nodes.push_back({.op = column_operation::add, .lhs = 2, .rhs = 1});
+    evaluate(2);
+    REQUIRE(res == std::vector<s25t::element>{0x3_s25, 0x4_s25});
+  }
+
+  SECTION("we can multiply columns") {
+    nodes.push_back({.op = column_operation::mul, .lhs = 0, .rhs = 1});
+    evaluate(1);
+    REQUIRE(res == std::vector<s25t::element>{0x28_s25, 0x5a_s25});
+  }
+
+  SECTION("we can scale a column") {
+    nodes.push_back({.op = column_operation::scale, .lhs = 1, .constant = 0x3_s25});
+    evaluate(2);
+    REQUIRE(res == std::vector<s25t::element>{0x5a_s25, 0x0_s25});
+  }
+
+  SECTION("we can select rows with a bitmap") {
+    uint8_t bitmap = 0b10110;
+    nodes.push_back({.op = column_operation::select, .lhs = 0, .bitmap = &bitmap});
+    evaluate(0);
+    REQUIRE(res == std::vector<s25t::element>{0x0_s25, 0x2_s25});
+    evaluate(3);
+    REQUIRE(res == std::vector<s25t::element>{0x0_s25, 0x5_s25});
+  }
+}
@@ -0,0 +1,91 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/base/packed_sequence.h"
+
+#include <algorithm>
+
+#include "sxt/base/error/assert.h"
+#include "sxt/base/num/ceil_log2.h"
+#include "sxt/base/num/divide_up.h"
+
+namespace sxt::mtxb {
+//--------------------------------------------------------------------------------------------------
+// unpack_element
+//--------------------------------------------------------------------------------------------------
+static void unpack_element(uint8_t* out, const uint8_t* data, size_t bit_first,
+                           unsigned element_nbits) noexcept {
+  auto src = data + bit_first / 8u;
+  auto shift = static_cast<unsigned>(bit_first % 8u);
+  auto num_bytes = basn::divide_up(element_nbits, 8u);
+  if (shift == 0) {
+    std::copy_n(src, num_bytes, out);
+  } else {
+    for (unsigned byte_index = 0; byte_index < num_bytes; ++byte_index) {
+      unsigned x = src[byte_index] >> shift;
+      // only read the next byte if the element extends into it
+      if (8u * byte_index + 8u - shift < element_nbits) {
+        x |= static_cast<unsigned>(src[byte_index + 1]) << (8u - shift);
+      }
+      out[byte_index] = static_cast<uint8_t>(x);
+    }
+  }
+  auto num_high_bits = element_nbits % 8u;
+  if (num_high_bits != 0) {
+    out[num_bytes - 1] &= static_cast<uint8_t>((1u << num_high_bits) - 1u);
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// packed_sequence_num_bytes
+//--------------------------------------------------------------------------------------------------
+size_t packed_sequence_num_bytes(const packed_sequence& seq) noexcept {
+  return basn::divide_up(static_cast<size_t>(seq.n) * seq.element_nbits, 8ul);
+}
+
+//--------------------------------------------------------------------------------------------------
+// unpacked_element_nbytes
+//--------------------------------------------------------------------------------------------------
+unsigned unpacked_element_nbytes(unsigned element_nbits) noexcept {
+  SXT_DEBUG_ASSERT(0 < element_nbits && element_nbits <= 256);
+  return 1u << basn::ceil_log2(basn::divide_up(element_nbits, 8u));
+}
+
+//--------------------------------------------------------------------------------------------------
+// unpack_sequence
+//--------------------------------------------------------------------------------------------------
+exponent_sequence unpack_sequence(basct::span<uint8_t> data, const packed_sequence& seq,
+                                  size_t first, size_t size) noexcept {
+  auto element_nbits = static_cast<unsigned>(seq.element_nbits);
+  auto element_nbytes = unpacked_element_nbytes(element_nbits);
+  SXT_RELEASE_ASSERT(data.size() >= size * element_nbytes);
+  size_t n = 0;
+  if (first < seq.n) {
+    n = std::min(size, seq.n - first);
+  }
+  auto out = data.data();
+  std::fill_n(out, n * element_nbytes, 0);
+  for (size_t term_index = 0; term_index < n; ++term_index) {
+    unpack_element(out + term_index * element_nbytes, seq.data,
+                   (first + term_index) * element_nbits, element_nbits);
+  }
+  return exponent_sequence{
+      .element_nbytes = static_cast<uint8_t>(element_nbytes),
+      .n = n,
+      .data = out,
+  };
+}
+} // namespace sxt::mtxb
@@ -0,0 +1,69 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "sxt/base/container/span.h"
+#include "sxt/multiexp/base/exponent_sequence.h"
+
+namespace sxt::mtxb {
+//--------------------------------------------------------------------------------------------------
+// packed_sequence
+//--------------------------------------------------------------------------------------------------
+struct packed_sequence {
+  // the number of bits used to represent an element in the sequence
+  // element_nbits must satisfy 1 <= element_nbits <= 256
+  uint16_t element_nbits = 0;
+
+  // the number of elements in the sequence
+  uint64_t n = 0;
+
+  // pointer to the unsigned elements of the sequence packed as a little endian stream of bits,
+  // where element i occupies the bits [i * element_nbits, (i + 1) * element_nbits)
+  const uint8_t* data = nullptr;
+};
+
+//--------------------------------------------------------------------------------------------------
+// packed_sequence_num_bytes
+//--------------------------------------------------------------------------------------------------
+/**
+ * The number of bytes spanned by the packed elements of seq.
+ */
+size_t packed_sequence_num_bytes(const packed_sequence& seq) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// unpacked_element_nbytes
+//--------------------------------------------------------------------------------------------------
+/**
+ * The smallest power of 2 number of bytes that holds an element of element_nbits bits.
+ */
+unsigned unpacked_element_nbytes(unsigned element_nbits) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// unpack_sequence
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write into data the terms [first, first + size) of seq, clamped to its length, as an exponent
+ * sequence of unpacked_element_nbytes(seq.element_nbits) bytes per element.
+ *
+ * data must have at least size * unpacked_element_nbytes(seq.element_nbits) bytes.
+ */
+exponent_sequence unpack_sequence(basct::span<uint8_t> data, const packed_sequence& seq,
+                                  size_t first, size_t size) noexcept;
+} // namespace sxt::mtxb
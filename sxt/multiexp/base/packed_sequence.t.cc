@@ -0,0 +1,111 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/base/packed_sequence.h"
+
+#include <random>
+#include <vector>
+
+#include "sxt/base/test/unit_test.h"
+
+using namespace sxt;
+using namespace sxt::mtxb;
+
+TEST_CASE("we can determine the unpacked size of elements") {
+  REQUIRE(unpacked_element_nbytes(1) == 1);
+  REQUIRE(unpacked_element_nbytes(8) == 1);
+  REQUIRE(unpacked_element_nbytes(12) == 2);
+  REQUIRE(unpacked_element_nbytes(20) == 4);
+  REQUIRE(unpacked_element_nbytes(40) == 8);
+  REQUIRE(unpacked_element_nbytes(255) == 32);
+  REQUIRE(unpacked_element_nbytes(256) == 32);
+}
+
+TEST_CASE("we can unpack a bit-packed sequence") {
+  std::vector<uint8_t> data;
+
+  SECTION("we handle an empty sequence") {
+    packed_sequence seq{.element_nbits = 3};
+    REQUIRE(packed_sequence_num_bytes(seq) == 0);
+    auto res = unpack_sequence(data, seq, 0, 0);
+    REQUIRE(res.n == 0);
+    REQUIRE(res.element_nbytes == 1);
+  }
+
+  SECTION("we handle elements of a single bit") {
+    std::vector<uint8_t> packed = {0b10100101, 0b1};
+    packed_sequence seq{.element_nbits = 1, .n = 9, .data = packed.data()};
+    REQUIRE(packed_sequence_num_bytes(seq) == 2);
+    data.resize(9);
+    auto res = unpack_sequence(data, seq, 0, 9);
+    REQUIRE(res.n == 9);
+    REQUIRE(res.is_signed == 0);
+    std::vector<uint8_t> expected = {1, 0, 1, 0, 0, 1, 0, 1, 1};
+    REQUIRE(data == expected);
+  }
+
+  SECTION("we handle 12-bit elements that straddle bytes") {
+    std::vector<uint8_t> packed = {0x21, 0x43, 0x65, 0x87};
+    packed_sequence seq{.element_nbits = 12, .n = 2, .data = packed.data()};
+    data.resize(4);
+    auto res = unpack_sequence(data, seq, 0, 2);
+    REQUIRE(res.element_nbytes == 2);
+    REQUIRE(reinterpret_cast<const uint16_t*>(res.data)[0] == 0x321);
+    REQUIRE(reinterpret_cast<const uint16_t*>(res.data)[1] == 0x654);
+  }
+
+  SECTION("we clamp a slice to the length of the sequence") {
+    std::vector<uint8_t> packed = {0b11011011};
+    packed_sequence seq{.element_nbits = 3, .n = 2, .data = packed.data()};
+    data.resize(4, 0xff);
+    auto res = unpack_sequence(data, seq, 1, 4);
+    REQUIRE(res.n == 1);
+    REQUIRE(data[0] == 0b011);
+    REQUIRE(unpack_sequence(data, seq, 2, 4).n == 0);
+  }
+
+  SECTION("unpacking matches the bits of random elements") {
+    std::mt19937 rng{1234};
+    for (unsigned element_nbits : {5u, 13u, 20u, 40u, 64u, 100u, 256u}) {
+      size_t n = 37;
+      auto element_nbytes = unpacked_element_nbytes(element_nbits);
+      std::vector<uint8_t> bits(n * element_nbits);
+      for (auto& bit : bits) {
+        bit = static_cast<uint8_t>(rng() % 2);
+      }
+      packed_sequence seq{.element_nbits = static_cast<uint16_t>(element_nbits), .n = n};
+      std::vector<uint8_t> packed(packed_sequence_num_bytes(seq));
+      for (size_t bit_index = 0; bit_index < bits.size(); ++bit_index) {
+        packed[bit_index / 8] |= static_cast<uint8_t>(bits[bit_index] << (bit_index % 8));
+      }
+      seq.data = packed.data();
+      data.assign(n * element_nbytes, 0xff);
+      auto res = unpack_sequence(data, seq, 0, n);
+      REQUIRE(res.n == n);
+      for (size_t term_index = 0; term_index < n; ++term_index) {
+        for (size_t bit_index = 0; bit_index < 8 * element_nbytes; ++bit_index) {
+          auto byte = data[term_index * element_nbytes + bit_index / 8];
+          auto bit = (byte >> (bit_index % 8)) & 1;
+          uint8_t expected = 0;
+          if (bit_index < element_nbits) {
+            expected = bits[term_index * element_nbits + bit_index];
+          }
+          REQUIRE(bit == expected);
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,93 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+#include "sxt/base/container/span.h"
+#include "sxt/base/error/assert.h"
+#include "sxt/memory/management/managed_array.h"
+
+namespace sxt::mtxb {
+//--------------------------------------------------------------------------------------------------
+// segmented_generators
+//--------------------------------------------------------------------------------------------------
+/**
+ * A sequence of generators made of a precomputed segment followed by a tail that is computed on
+ * demand.
+ *
+ * Requests that fall within the precomputed segment are served without copying. Requests that
+ * reach into the tail are written into a caller-provided buffer, so a multiexponentiation that
+ * walks the generators a chunk at a time can compute the tail one chunk at a time, concurrently
+ * with accumulating the previous chunk.
+ */
+template <class T> class segmented_generators {
+public:
+  /**
+   * Write the generators [first, first + generators.size()) of the sequence into generators,
+   * where first is at least the size of the precomputed segment.
+   */
+  using tail_generator = std::function<void(basct::span<T> generators, size_t first)>;
+
+  segmented_generators() noexcept = default;
+
+  segmented_generators(basct::cspan<T> generators) noexcept
+      : precomputed_{generators}, size_{generators.size()} {}
+
+  segmented_generators(basct::cspan<T> precomputed, size_t size,
+                       tail_generator generate_tail) noexcept
+      : precomputed_{precomputed.subspan(0, std::min(precomputed.size(), size))}, size_{size},
+        generate_tail_{std::move(generate_tail)} {
+    SXT_RELEASE_ASSERT(size_ == precomputed_.size() || generate_tail_);
+  }
+
+  size_t size() const noexcept { return size_; }
+
+  basct::cspan<T> precomputed() const noexcept { return precomputed_; }
+
+  /**
+   * Return the generators [first, first + n).
+   *
+   * If the range lies in the precomputed segment, a view of it is returned and data is untouched.
+   * Otherwise the range is assembled in data: the part overlapping the precomputed segment is
+   * copied and the rest is computed.
+   */
+  basct::cspan<T> get(memmg::managed_array<T>& data, size_t first, size_t n) const noexcept {
+    SXT_DEBUG_ASSERT(first + n <= size_);
+    auto num_precomputed = precomputed_.size();
+    if (first + n <= num_precomputed) {
+      return precomputed_.subspan(first, n);
+    }
+    data.resize(n);
+    size_t num_copied = 0;
+    if (first < num_precomputed) {
+      num_copied = num_precomputed - first;
+      std::copy_n(precomputed_.begin() + first, num_copied, data.begin());
+    }
+    generate_tail_(basct::span<T>{data.data() + num_copied, n - num_copied}, first + num_copied);
+    return data;
+  }
+
+private:
+  basct::cspan<T> precomputed_;
+  size_t size_ = 0;
+  tail_generator generate_tail_;
+};
+} // namespace sxt::mtxb
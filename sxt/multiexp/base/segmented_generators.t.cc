@@ -0,0 +1,72 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/base/segmented_generators.h"
+
+#include <numeric>
+#include <vector>
+
+#include "sxt/base/test/unit_test.h"
+
+using namespace sxt;
+using namespace sxt::mtxb;
+
+TEST_CASE("we can access generators split into a precomputed segment and a computed tail") {
+  std::vector<int> precomputed = {0, 1, 2, 3};
+  size_t num_tail_calls = 0;
+  auto generate_tail = [&](basct::span<int> generators, size_t first) noexcept {
+    ++num_tail_calls;
+    std::iota(generators.begin(), generators.end(), static_cast<int>(first));
+  };
+  memmg::managed_array<int> data;
+
+  SECTION("a sequence of only precomputed generators is never computed") {
+    segmented_generators<int> generators{basct::cspan<int>{precomputed}};
+    REQUIRE(generators.size() == 4);
+    auto res = generators.get(data, 1, 3);
+    REQUIRE(res.data() == precomputed.data() + 1);
+    REQUIRE(res.size() == 3);
+    REQUIRE(data.empty());
+  }
+
+  SECTION("ranges within the precomputed segment aren't copied") {
+    segmented_generators<int> generators{precomputed, 10, generate_tail};
+    auto res = generators.get(data, 0, 4);
+    REQUIRE(res.data() == precomputed.data());
+    REQUIRE(num_tail_calls == 0);
+  }
+
+  SECTION("ranges within the tail are computed") {
+    segmented_generators<int> generators{precomputed, 10, generate_tail};
+    auto res = generators.get(data, 6, 3);
+    REQUIRE(res.data() == data.data());
+    REQUIRE(std::vector<int>(res.begin(), res.end()) == std::vector<int>{6, 7, 8});
+    REQUIRE(num_tail_calls == 1);
+  }
+
+  SECTION("ranges that straddle the segments are assembled") {
+    segmented_generators<int> generators{precomputed, 10, generate_tail};
+    auto res = generators.get(data, 2, 8);
+    std::vector<int> expected(8);
+    std::iota(expected.begin(), expected.end(), 2);
+    REQUIRE(std::vector<int>(res.begin(), res.end()) == expected);
+  }
+
+  SECTION("the precomputed segment is truncated to the size of the sequence") {
+    segmented_generators<int> generators{precomputed, 2, generate_tail};
+    REQUIRE(generators.precomputed().size() == 2);
+  }
+}
@@ -84,3 +84,38 @@ TEST_CASE("we can compute the multiproduct from a bitset") {
     REQUIRE(add_counter == 2);
   }
 }
+
+TEST_CASE("we can compute the multiproduct from an eagerly filled cache") {
+  size_t add_counter = 0;
+  test_operator op{&add_counter};
+
+  std::vector<uint64_t> values = {1, 2, 3, 4, 5};
+  std::vector<uint64_t> cache_data(compute_cache_size(values.size()));
+  value_cache cache{cache_data.data(), values.size()};
+  fill_value_cache(cache, op, basct::cspan<uint64_t>{values});
+
+  SECTION("filling uses one addition per entry that isn't a single term") {
+    REQUIRE(add_counter == cache_data.size() - values.size());
+  }
+
+  SECTION("lookups only combine the two sides") {
+    uint64_t res;
+    for (uint64_t bitset = 1; bitset < (1u << values.size()); ++bitset) {
+      add_counter = 0;
+      compute_multiproduct(res, cache, op, bitset);
+      uint64_t expected = 0;
+      for (size_t i = 0; i < values.size(); ++i) {
+        if (bitset & (1u << i)) {
+          expected += values[i];
+        }
+      }
+      REQUIRE(res == expected);
+      REQUIRE(add_counter <= 1);
+    }
+  }
+
+  SECTION("we fill caches for dense partitions only") {
+    REQUIRE(!prefer_filled_value_cache(values.size(), 1));
+    REQUIRE(prefer_filled_value_cache(values.size(), 32));
+  }
+}
@@ -25,4 +25,11 @@ size_t compute_cache_size(size_t num_terms) noexcept {
   auto right_size = num_terms - left_size;
   return (1 << left_size) + (1 << right_size) - 2;
 }
+
+//--------------------------------------------------------------------------------------------------
+// prefer_filled_value_cache
+//--------------------------------------------------------------------------------------------------
+bool prefer_filled_value_cache(size_t num_terms, size_t num_products) noexcept {
+  return num_products * num_terms >= 2 * compute_cache_size(num_terms);
+}
 } // namespace sxt::mtxbmp
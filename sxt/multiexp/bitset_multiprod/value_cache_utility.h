@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 
 #include "sxt/base/error/assert.h"
 #include "sxt/multiexp/bitset_multiprod/value_cache.h"
@@ -27,6 +28,19 @@ namespace sxt::mtxbmp {
 //--------------------------------------------------------------------------------------------------
 size_t compute_cache_size(size_t num_terms) noexcept;
 
+//--------------------------------------------------------------------------------------------------
+// prefer_filled_value_cache
+//--------------------------------------------------------------------------------------------------
+/**
+ * Decide whether to fill a value cache for num_terms terms eagerly with fill_value_cache rather
+ * than computing entries lazily on lookup.
+ *
+ * A product looks up subsets of about half the terms on each side, so lazily computing num_products
+ * products costs up to about num_products * num_terms / 2 additions; filling costs one addition per
+ * cache entry. We fill when the products are numerous enough that most entries get used anyway.
+ */
+bool prefer_filled_value_cache(size_t num_terms, size_t num_products) noexcept;
+
 //--------------------------------------------------------------------------------------------------
 // init_value_cache_side
 //--------------------------------------------------------------------------------------------------
@@ -40,6 +54,30 @@ void init_value_cache_side(basct::span<T> cache_side, Op op, basct::cspan<T> ter
   }
 }
 
+//--------------------------------------------------------------------------------------------------
+// fill_value_cache_side
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute every subset sum of terms, iterating over the bitsets in increasing order so that the
+ * entry for a bitset is its lowest term plus the already computed entry for the remaining bits.
+ */
+template <class T, class Op>
+void fill_value_cache_side(basct::span<T> cache_side, Op op, basct::cspan<T> terms) noexcept {
+  SXT_DEBUG_ASSERT(cache_side.size() == (1ull << terms.size()) - 1);
+  for (size_t term_index = 0; term_index < terms.size(); ++term_index) {
+    cache_side[(1ull << term_index) - 1] = terms[term_index];
+  }
+  uint64_t num_entries = cache_side.size();
+  for (uint64_t bitset = 3; bitset <= num_entries; ++bitset) {
+    auto low_bit = bitset & -bitset;
+    auto rest = bitset ^ low_bit;
+    if (rest == 0) {
+      continue;
+    }
+    op.add_bitwise_entries(cache_side[bitset - 1], cache_side[low_bit - 1], cache_side[rest - 1]);
+  }
+}
+
 //--------------------------------------------------------------------------------------------------
 // init_value_cache
 //--------------------------------------------------------------------------------------------------
@@ -51,4 +89,20 @@ void init_value_cache(value_cache<T> cache, Op op, basct::cspan<T> terms) noexce
   init_value_cache_side(left_cache, op, terms.subspan(0, left_num_terms));
   init_value_cache_side(right_cache, op, terms.subspan(left_num_terms));
 }
+
+//--------------------------------------------------------------------------------------------------
+// fill_value_cache
+//--------------------------------------------------------------------------------------------------
+/**
+ * Eager counterpart of init_value_cache: compute every entry up front so that lookups never
+ * recurse.
+ */
+template <class T, class Op>
+void fill_value_cache(value_cache<T> cache, Op op, basct::cspan<T> terms) noexcept {
+  SXT_DEBUG_ASSERT(terms.size() == cache.num_terms());
+  auto [left_cache, right_cache] = cache.split();
+  auto left_num_terms = cache.half_num_terms();
+  fill_value_cache_side(left_cache, op, terms.subspan(0, left_num_terms));
+  fill_value_cache_side(right_cache, op, terms.subspan(left_num_terms));
+}
 } // namespace sxt::mtxbmp
@@ -16,25 +16,102 @@
  */
 #pragma once
 
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
 #include "sxt/base/container/span.h"
 #include "sxt/base/curve/element.h"
 #include "sxt/base/error/assert.h"
+#include "sxt/base/iterator/index_range.h"
+#include "sxt/base/num/divide_up.h"
+#include "sxt/base/num/log2p1.h"
+#include "sxt/execution/thread/parallel_for.h"
+#include "sxt/memory/management/managed_array.h"
 
 namespace sxt::mtxbk {
+//--------------------------------------------------------------------------------------------------
+// combine_bucket_group
+//--------------------------------------------------------------------------------------------------
+/**
+ * Host counterpart of the combine_bucket_groups kernel for a single bucket: given a pointer to the
+ * bucket in group 0, compute
+ *
+ *    sum = sum_{bucket_group_index} 2^{log2(BucketGroupSize+1) * bucket_group_index} *
+ *              bucket_sums[BucketGroupSize * bucket_group_index]
+ */
+template <unsigned BucketGroupSize, unsigned NumBucketGroups, bascrv::element T>
+void combine_bucket_group(T& sum, const T* bucket_sums) noexcept {
+  static_assert(NumBucketGroups > 0);
+  constexpr auto bucket_group_size_log2p1 = basn::log2p1(BucketGroupSize);
+  unsigned i = NumBucketGroups - 1;
+  sum = bucket_sums[i * BucketGroupSize];
+  while (i-- > 0) {
+    for (int j = 0; j < bucket_group_size_log2p1; ++j) {
+      double_element(sum, sum);
+    }
+    add(sum, sum, bucket_sums[BucketGroupSize * i]);
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// bucket_combination_min_segment_size_v
+//--------------------------------------------------------------------------------------------------
+/**
+ * Minimum number of buckets a thread combines so that the offset correction of a segment stays
+ * small compared to its running sum.
+ */
+constexpr size_t bucket_combination_min_segment_size_v = 32;
+
+//--------------------------------------------------------------------------------------------------
+// add_multiple
+//--------------------------------------------------------------------------------------------------
+/**
+ * Add k * e to res using double-and-add.
+ */
+template <bascrv::element T> void add_multiple(T& res, const T& e, size_t k) noexcept {
+  if (k == 0) {
+    return;
+  }
+  auto bit_index = 63 - std::countl_zero(static_cast<uint64_t>(k));
+  T t = e;
+  while (bit_index-- > 0) {
+    double_element(t, t);
+    if ((k >> bit_index) & 1u) {
+      add(t, t, e);
+    }
+  }
+  add_inplace(res, t);
+}
+
 //--------------------------------------------------------------------------------------------------
 // combine_buckets_impl
 //--------------------------------------------------------------------------------------------------
+/**
+ * Compute the running sum
+ *
+ *    sum = sum_i (i + 1) * bucket_sums[i]
+ *
+ * along with total = sum_i bucket_sums[i].
+ */
 template <bascrv::element T>
-void combine_buckets_impl(T& sum, basct::span<T> bucket_sums) noexcept {
+void combine_buckets_impl(T& sum, T& total, basct::span<T> bucket_sums) noexcept {
   auto i = bucket_sums.size() - 1u;
-  T t = bucket_sums[i];
+  total = bucket_sums[i];
   sum = bucket_sums[i];
   while (i-- > 0) {
-    add_inplace(t, bucket_sums[i]);
-    add(sum, sum, t);
+    add_inplace(total, bucket_sums[i]);
+    add(sum, sum, total);
   }
 }
 
+template <bascrv::element T>
+void combine_buckets_impl(T& sum, basct::span<T> bucket_sums) noexcept {
+  T total;
+  combine_buckets_impl(sum, total, bucket_sums);
+}
+
 //--------------------------------------------------------------------------------------------------
 // combine_buckets
 //--------------------------------------------------------------------------------------------------
@@ -45,20 +122,77 @@ void combine_buckets_impl(T& sum, basct::span<T> bucket_sums) noexcept {
  *
  *    PipeMSM: Hardware Acceleration for Multi-Scalar Multiplication
  *    https://eprint.iacr.org/2022/999.pdf
+ *
+ * Work is spread across threads by output and, when there are fewer outputs than threads, by
+ * segments of buckets. For a segment starting at bucket a, the running sum only weights the
+ * buckets by (i - a + 1), so a times the segment's total is added back when the segments are
+ * folded.
  */
 template <bascrv::element T>
-void combine_buckets(basct::span<T> sums, basct::span<T> bucket_sums) noexcept {
+void combine_buckets(basct::span<T> sums, basct::span<T> bucket_sums,
+                     size_t num_threads) noexcept {
   auto num_outputs = sums.size();
+  if (num_outputs == 0) {
+    return;
+  }
   auto bucket_group_size = bucket_sums.size() / num_outputs;
   SXT_DEBUG_ASSERT(
       // clang-format off
-      sums.size() == num_outputs && 
+      bucket_group_size > 0 &&
       bucket_sums.size() == num_outputs * bucket_group_size
       // clang-format on
   );
-  for (size_t output_index = 0; output_index < num_outputs; ++output_index) {
-    combine_buckets_impl(sums[output_index],
-                         bucket_sums.subspan(bucket_group_size * output_index, bucket_group_size));
+  auto max_num_segments =
+      std::max<size_t>(bucket_group_size / bucket_combination_min_segment_size_v, 1);
+  auto num_segments = std::min(basn::divide_up(num_threads, num_outputs), max_num_segments);
+  auto segment_size = basn::divide_up(bucket_group_size, num_segments);
+  num_segments = basn::divide_up(bucket_group_size, segment_size);
+  if (num_segments == 1) {
+    auto f = [&](basit::index_range rng) noexcept {
+      for (auto output_index = rng.a(); output_index < rng.b(); ++output_index) {
+        combine_buckets_impl(
+            sums[output_index],
+            bucket_sums.subspan(bucket_group_size * output_index, bucket_group_size));
+      }
+    };
+    xent::parallel_for(basit::index_range{0, num_outputs}, f, num_threads);
+    return;
   }
+
+  // running sums of each segment
+  memmg::managed_array<T> segment_sums(num_outputs * num_segments);
+  memmg::managed_array<T> segment_totals(num_outputs * num_segments);
+  auto f_segment = [&](basit::index_range rng) noexcept {
+    for (auto i = rng.a(); i < rng.b(); ++i) {
+      auto segment_index = i % num_segments;
+      auto output_index = i / num_segments;
+      auto first = segment_size * segment_index;
+      auto last = std::min(first + segment_size, bucket_group_size);
+      combine_buckets_impl(
+          segment_sums[i], segment_totals[i],
+          bucket_sums.subspan(bucket_group_size * output_index + first, last - first));
+    }
+  };
+  xent::parallel_for(basit::index_range{0, segment_sums.size()}, f_segment, num_threads);
+
+  // fold the segments
+  auto f_fold = [&](basit::index_range rng) noexcept {
+    for (auto output_index = rng.a(); output_index < rng.b(); ++output_index) {
+      auto segment_first = num_segments * output_index;
+      auto& sum = sums[output_index];
+      sum = segment_sums[segment_first];
+      for (size_t segment_index = 1; segment_index < num_segments; ++segment_index) {
+        add(sum, sum, segment_sums[segment_first + segment_index]);
+        add_multiple(sum, segment_totals[segment_first + segment_index],
+                     segment_size * segment_index);
+      }
+    }
+  };
+  xent::parallel_for(basit::index_range{0, num_outputs}, f_fold, num_threads);
+}
+
+template <bascrv::element T>
+void combine_buckets(basct::span<T> sums, basct::span<T> bucket_sums) noexcept {
+  combine_buckets(sums, bucket_sums, xent::get_num_threads());
 }
 } // namespace sxt::mtxbk
@@ -16,6 +16,7 @@
  */
 #include "sxt/multiexp/bucket_method/combination.h"
 
+#include <random>
 #include <vector>
 
 #include "sxt/base/curve/example_element.h"
@@ -54,3 +55,58 @@ TEST_CASE("we can sum up bucket entries") {
     REQUIRE(sums[1] == 13u);
   }
 }
+
+TEST_CASE("we can add a multiple of an element") {
+  bascrv::element97 res = 3u;
+
+  SECTION("adding zero times an element does nothing") {
+    add_multiple<bascrv::element97>(res, 5u, 0);
+    REQUIRE(res == 3u);
+  }
+
+  SECTION("we can add small multiples") {
+    add_multiple<bascrv::element97>(res, 5u, 1);
+    REQUIRE(res == 3u + 5u);
+    add_multiple<bascrv::element97>(res, 5u, 6);
+    REQUIRE(res == 3u + 5u + 6u * 5u);
+  }
+
+  SECTION("we can add a large multiple") {
+    add_multiple<bascrv::element97>(res, 5u, 1234567);
+    REQUIRE(res == (3u + 5ull * 1234567u) % 97u);
+  }
+}
+
+TEST_CASE("we can combine many buckets in segments") {
+  std::mt19937 rng{0};
+  auto num_threads = GENERATE(1u, 4u, 16u);
+  auto num_outputs = GENERATE(1u, 3u, 100u);
+  auto bucket_group_size = GENERATE(1u, 63u, 64u, 255u, 1000u);
+  std::vector<bascrv::element97> bucket_sums(num_outputs * bucket_group_size);
+  std::vector<bascrv::element97> expected(num_outputs, 0u);
+  for (size_t i = 0; i < bucket_sums.size(); ++i) {
+    bucket_sums[i] = rng();
+    auto bucket_index = i % bucket_group_size;
+    auto& e = expected[i / bucket_group_size];
+    add(e, e, bascrv::element97{static_cast<uint32_t>((bucket_index + 1) * bucket_sums[i].value)});
+  }
+  std::vector<bascrv::element97> sums(num_outputs);
+  combine_buckets<bascrv::element97>(sums, bucket_sums, num_threads);
+  REQUIRE(sums == expected);
+}
+
+TEST_CASE("we can combine the groups of a bucket") {
+  bascrv::element97 sum;
+
+  SECTION("we handle a single group") {
+    std::vector<bascrv::element97> bucket_sums = {12u};
+    combine_bucket_group<1, 1>(sum, bucket_sums.data());
+    REQUIRE(sum == 12u);
+  }
+
+  SECTION("we handle multiple groups") {
+    std::vector<bascrv::element97> bucket_sums = {2u, 0u, 0u, 3u, 0u, 0u, 5u};
+    combine_bucket_group<3, 3>(sum, bucket_sums.data());
+    REQUIRE(sum == 2u + 4u * 3u + 16u * 5u);
+  }
+}
@@ -0,0 +1,62 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/bucket_method/digit_sort.h"
+
+#include <algorithm>
+
+#include "sxt/base/error/assert.h"
+
+namespace sxt::mtxbk {
+//--------------------------------------------------------------------------------------------------
+// sort_by_digit
+//--------------------------------------------------------------------------------------------------
+void sort_by_digit(basct::span<unsigned> offsets, basct::span<unsigned> indexes,
+                   const uint8_t* scalars, unsigned scalar_num_bytes,
+                   unsigned byte_index) noexcept {
+  SXT_DEBUG_ASSERT(
+      // clang-format off
+      offsets.size() == 257 &&
+      byte_index < scalar_num_bytes
+      // clang-format on
+  );
+  auto n = static_cast<unsigned>(indexes.size());
+  scalars += byte_index;
+
+  // count
+  std::fill(offsets.begin(), offsets.end(), 0u);
+  for (unsigned i = 0; i < n; ++i) {
+    ++offsets[scalars[i * scalar_num_bytes] + 1u];
+  }
+
+  // prefix sum
+  for (unsigned d = 1; d < 257u; ++d) {
+    offsets[d] += offsets[d - 1];
+  }
+
+  // scatter
+  for (unsigned i = 0; i < n; ++i) {
+    auto& pos = offsets[scalars[i * scalar_num_bytes]];
+    indexes[pos++] = i;
+  }
+
+  // the scatter shifted each offset to the start of the next digit's range
+  for (unsigned d = 256; d > 0; --d) {
+    offsets[d] = offsets[d - 1];
+  }
+  offsets[0] = 0;
+}
+} // namespace sxt::mtxbk
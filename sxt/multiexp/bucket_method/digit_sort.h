@@ -0,0 +1,36 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+
+#include "sxt/base/container/span.h"
+
+namespace sxt::mtxbk {
+//--------------------------------------------------------------------------------------------------
+// sort_by_digit
+//--------------------------------------------------------------------------------------------------
+/**
+ * Counting sort the scalar indexes 0, ..., n-1 by the byte digit at byte_index, where n is
+ * indexes.size() and scalars is laid out as n consecutive scalars of scalar_num_bytes each.
+ *
+ * On return, indexes[offsets[d]], ..., indexes[offsets[d+1]-1] are the indexes of the scalars with
+ * digit d in ascending order. offsets must have size 257.
+ */
+void sort_by_digit(basct::span<unsigned> offsets, basct::span<unsigned> indexes,
+                   const uint8_t* scalars, unsigned scalar_num_bytes, unsigned byte_index) noexcept;
+} // namespace sxt::mtxbk
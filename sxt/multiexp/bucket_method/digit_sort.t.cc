@@ -0,0 +1,74 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/bucket_method/digit_sort.h"
+
+#include <vector>
+
+#include "sxt/base/test/unit_test.h"
+
+using namespace sxt;
+using namespace sxt::mtxbk;
+
+TEST_CASE("we can sort scalar indexes by a byte digit") {
+  std::vector<unsigned> offsets(257);
+  std::vector<unsigned> indexes;
+
+  SECTION("we handle zero scalars") {
+    sort_by_digit(offsets, indexes, nullptr, 1, 0);
+    for (auto offset : offsets) {
+      REQUIRE(offset == 0);
+    }
+  }
+
+  SECTION("we can sort a single scalar") {
+    std::vector<uint8_t> scalars = {3};
+    indexes.resize(1);
+    sort_by_digit(offsets, indexes, scalars.data(), 1, 0);
+    REQUIRE(indexes[0] == 0);
+    REQUIRE(offsets[3] == 0);
+    REQUIRE(offsets[4] == 1);
+    REQUIRE(offsets[256] == 1);
+  }
+
+  SECTION("indexes with the same digit are kept in ascending order") {
+    std::vector<uint8_t> scalars = {5, 0, 5, 255, 0};
+    indexes.resize(5);
+    sort_by_digit(offsets, indexes, scalars.data(), 1, 0);
+    std::vector<unsigned> expected = {1, 4, 0, 2, 3};
+    REQUIRE(indexes == expected);
+    REQUIRE(offsets[0] == 0);
+    REQUIRE(offsets[1] == 2);
+    REQUIRE(offsets[5] == 2);
+    REQUIRE(offsets[6] == 4);
+    REQUIRE(offsets[255] == 4);
+    REQUIRE(offsets[256] == 5);
+  }
+
+  SECTION("we can sort by a byte other than the first") {
+    std::vector<uint8_t> scalars = {1, 7, 2, 3, 3, 1};
+    indexes.resize(3);
+    sort_by_digit(offsets, indexes, scalars.data(), 2, 1);
+    std::vector<unsigned> expected = {2, 1, 0};
+    REQUIRE(indexes == expected);
+    REQUIRE(offsets[1] == 0);
+    REQUIRE(offsets[2] == 1);
+    REQUIRE(offsets[3] == 1);
+    REQUIRE(offsets[4] == 2);
+    REQUIRE(offsets[7] == 2);
+    REQUIRE(offsets[8] == 3);
+  }
+}
@@ -0,0 +1,44 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/bucket_method/host_accumulation.h"
+
+#include <algorithm>
+
+#include "sxt/base/num/divide_up.h"
+
+namespace sxt::mtxbk {
+//--------------------------------------------------------------------------------------------------
+// make_tiled_accumulation_partition
+//--------------------------------------------------------------------------------------------------
+tiled_accumulation_partition make_tiled_accumulation_partition(size_t num_tasks, size_t n,
+                                                               size_t num_outputs,
+                                                               unsigned tile_size) noexcept {
+  constexpr size_t num_bucket_groups = 32;
+  if (num_tasks <= num_bucket_groups) {
+    return {.num_output_groups = 1, .num_generator_ranges = 1};
+  }
+  auto num_splits = basn::divide_up(num_tasks, num_bucket_groups);
+  auto num_tiles = std::max<size_t>(basn::divide_up(n, size_t{tile_size}), 1);
+  auto num_ranges = std::min(num_splits, num_tiles);
+  auto num_output_groups =
+      std::min(basn::divide_up(num_splits, num_ranges), std::max<size_t>(num_outputs, 1));
+  return {
+      .num_output_groups = static_cast<unsigned>(num_output_groups),
+      .num_generator_ranges = static_cast<unsigned>(num_ranges),
+  };
+}
+} // namespace sxt::mtxbk
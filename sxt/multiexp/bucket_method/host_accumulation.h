@@ -0,0 +1,282 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+#include "sxt/base/container/span.h"
+#include "sxt/base/curve/element.h"
+#include "sxt/base/error/assert.h"
+#include "sxt/base/iterator/index_range.h"
+#include "sxt/base/num/divide_up.h"
+#include "sxt/execution/thread/parallel_for.h"
+#include "sxt/memory/management/managed_array.h"
+#include "sxt/multiexp/bucket_method/digit_sort.h"
+
+namespace sxt::mtxbk {
+//--------------------------------------------------------------------------------------------------
+// accumulation_prefetch_distance_v
+//--------------------------------------------------------------------------------------------------
+/**
+ * How many points ahead of the current one to prefetch when summing a bucket.
+ */
+constexpr unsigned accumulation_prefetch_distance_v = 8;
+
+//--------------------------------------------------------------------------------------------------
+// accumulation_tile_size_v
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of generators in a tile for tiled accumulation, chosen so that a tile of curve elements
+ * fits comfortably in L2 cache.
+ */
+constexpr unsigned accumulation_tile_size_v = 1024;
+
+//--------------------------------------------------------------------------------------------------
+// add_to_bucket
+//--------------------------------------------------------------------------------------------------
+/**
+ * Add the generators with the given indexes to sum, prefetching generators that will be added
+ * soon.
+ */
+template <bascrv::element T>
+void add_to_bucket(T& sum, const T* generators, basct::cspan<unsigned> indexes) noexcept {
+  auto n = indexes.size();
+  for (size_t i = 0; i < std::min<size_t>(n, accumulation_prefetch_distance_v); ++i) {
+    __builtin_prefetch(generators + indexes[i]);
+  }
+  for (size_t i = 0; i < n; ++i) {
+    if (i + accumulation_prefetch_distance_v < n) {
+      __builtin_prefetch(generators + indexes[i + accumulation_prefetch_distance_v]);
+    }
+    add(sum, sum, generators[indexes[i]]);
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// sum_bucket
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sum the generators with the given indexes, prefetching generators that will be added soon.
+ */
+template <bascrv::element T>
+void sum_bucket(T& sum, const T* generators, basct::cspan<unsigned> indexes) noexcept {
+  if (indexes.empty()) {
+    sum = T::identity();
+    return;
+  }
+  __builtin_prefetch(generators + indexes[0]);
+  sum = generators[indexes[0]];
+  add_to_bucket(sum, generators, indexes.subspan(1));
+}
+
+//--------------------------------------------------------------------------------------------------
+// accumulate_buckets_host
+//--------------------------------------------------------------------------------------------------
+/**
+ * Host counterpart of accumulate_buckets that produces the same bucket layout.
+ *
+ * Rather than scattering each generator into a random bucket, the scalar indexes of a window are
+ * first counting sorted by digit so that each bucket is then summed sequentially with only the
+ * running sum live. Windows are accumulated in parallel.
+ */
+template <bascrv::element T>
+void accumulate_buckets_host(basct::span<T> bucket_sums, basct::cspan<T> generators,
+                             basct::cspan<const uint8_t*> exponents) noexcept {
+  constexpr unsigned bucket_group_size = 255;
+  constexpr unsigned num_bucket_groups = 32;
+  constexpr unsigned scalar_num_bytes = 32;
+  auto num_outputs = exponents.size();
+  auto n = static_cast<unsigned>(generators.size());
+  SXT_DEBUG_ASSERT(bucket_sums.size() == bucket_group_size * num_bucket_groups * num_outputs);
+  xent::parallel_for(
+      basit::index_range{0, num_bucket_groups * num_outputs}, [&](basit::index_range rng) noexcept {
+        memmg::managed_array<unsigned> offsets(257);
+        memmg::managed_array<unsigned> indexes(n);
+        for (auto task_index = rng.a(); task_index < rng.b(); ++task_index) {
+          auto bucket_group_index = static_cast<unsigned>(task_index % num_bucket_groups);
+          auto output_index = task_index / num_bucket_groups;
+          sort_by_digit(offsets, indexes, exponents[output_index], scalar_num_bytes,
+                        bucket_group_index);
+          auto sums = bucket_sums.subspan(bucket_group_size * task_index, bucket_group_size);
+          for (unsigned digit = 1; digit < 256u; ++digit) {
+            auto first = offsets[digit];
+            auto last = offsets[digit + 1];
+            sum_bucket(sums[digit - 1], generators.data(),
+                       basct::cspan<unsigned>{indexes.data() + first, last - first});
+          }
+        }
+      });
+}
+
+//--------------------------------------------------------------------------------------------------
+// tiled_accumulation_partition
+//--------------------------------------------------------------------------------------------------
+/**
+ * How the work of a tiled accumulation is split: each task accumulates one window for a group of
+ * outputs over one range of generators.
+ */
+struct tiled_accumulation_partition {
+  unsigned num_output_groups;
+  unsigned num_generator_ranges;
+};
+
+//--------------------------------------------------------------------------------------------------
+// make_tiled_accumulation_partition
+//--------------------------------------------------------------------------------------------------
+/**
+ * Split a tiled accumulation into at least num_tasks tasks where the problem allows.
+ *
+ * The 32 windows are split first. Generator ranges come next since every output of a range still
+ * shares its tiles; outputs are only split into groups when there aren't enough tiles.
+ */
+tiled_accumulation_partition make_tiled_accumulation_partition(size_t num_tasks, size_t n,
+                                                               size_t num_outputs,
+                                                               unsigned tile_size) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// accumulate_buckets_tiled_host
+//--------------------------------------------------------------------------------------------------
+/**
+ * Variant of accumulate_buckets_host for many outputs that share generators.
+ *
+ * The generators are processed in tiles of tile_size. Each tile is loaded into cache once and
+ * then added into the buckets of every output of a group before moving to the next tile, so
+ * generator memory traffic no longer scales with the number of outputs.
+ *
+ * Tiles are added directly into the bucket sums of their generator range, and the ranges are
+ * merged once at the end, so tiling costs no more group operations than the untiled
+ * accumulation. Work is split across windows, output groups and generator ranges as given by
+ * partition.
+ */
+template <bascrv::element T>
+void accumulate_buckets_tiled_host(basct::span<T> bucket_sums, basct::cspan<T> generators,
+                                   basct::cspan<const uint8_t*> exponents, unsigned tile_size,
+                                   tiled_accumulation_partition partition) noexcept {
+  constexpr unsigned bucket_group_size = 255;
+  constexpr unsigned num_bucket_groups = 32;
+  constexpr unsigned scalar_num_bytes = 32;
+  auto num_outputs = exponents.size();
+  auto n = static_cast<unsigned>(generators.size());
+  auto num_output_groups = partition.num_output_groups;
+  auto num_ranges = partition.num_generator_ranges;
+  SXT_DEBUG_ASSERT(
+      // clang-format off
+      bucket_sums.size() == bucket_group_size * num_bucket_groups * num_outputs &&
+      tile_size > 0 &&
+      num_output_groups > 0 &&
+      num_ranges > 0
+      // clang-format on
+  );
+  auto num_tiles = basn::divide_up(n, tile_size);
+  auto tiles_per_range = basn::divide_up(num_tiles, num_ranges);
+  auto outputs_per_group = basn::divide_up(num_outputs, size_t{num_output_groups});
+
+  // the first range accumulates into bucket_sums; the others into their own partial sums
+  memmg::managed_array<T> partial_sums((num_ranges - 1) * bucket_sums.size());
+  memmg::managed_array<uint8_t> is_set(num_ranges * bucket_sums.size());
+  std::fill(is_set.begin(), is_set.end(), 0);
+  auto range_sums = [&](size_t range_index) noexcept {
+    if (range_index == 0) {
+      return bucket_sums;
+    }
+    return basct::span<T>{partial_sums.data() + (range_index - 1) * bucket_sums.size(),
+                          bucket_sums.size()};
+  };
+
+  // accumulate
+  xent::parallel_for(
+      basit::index_range{0, size_t{num_bucket_groups} * num_output_groups * num_ranges},
+      [&](basit::index_range rng) noexcept {
+        memmg::managed_array<unsigned> offsets(257);
+        memmg::managed_array<unsigned> indexes(std::min(tile_size, n));
+        for (auto task_index = rng.a(); task_index < rng.b(); ++task_index) {
+          auto bucket_group_index = static_cast<unsigned>(task_index % num_bucket_groups);
+          auto output_group_index = task_index / num_bucket_groups % num_output_groups;
+          auto range_index = task_index / num_bucket_groups / num_output_groups;
+          auto output_first = std::min(num_outputs, output_group_index * outputs_per_group);
+          auto output_last = std::min(num_outputs, output_first + outputs_per_group);
+          auto tile_last = std::min<size_t>(num_tiles, (range_index + 1) * tiles_per_range);
+          auto sums = range_sums(range_index);
+          auto is_set_p = is_set.data() + range_index * bucket_sums.size();
+          for (size_t tile_index = range_index * tiles_per_range; tile_index < tile_last;
+               ++tile_index) {
+            auto tile_first = static_cast<unsigned>(tile_index * tile_size);
+            auto tile_n = std::min(tile_size, n - tile_first);
+            basct::span<unsigned> tile_indexes{indexes.data(), tile_n};
+            for (auto output_index = output_first; output_index < output_last; ++output_index) {
+              sort_by_digit(offsets, tile_indexes,
+                            exponents[output_index] + scalar_num_bytes * tile_first,
+                            scalar_num_bytes, bucket_group_index);
+              auto bucket_first =
+                  bucket_group_size * (bucket_group_index + num_bucket_groups * output_index);
+              for (unsigned digit = 1; digit < 256u; ++digit) {
+                auto first = offsets[digit];
+                auto last = offsets[digit + 1];
+                if (first == last) {
+                  continue;
+                }
+                auto bucket_index = bucket_first + digit - 1;
+                basct::cspan<unsigned> bucket_indexes{indexes.data() + first, last - first};
+                auto& sum = sums[bucket_index];
+                if (is_set_p[bucket_index] == 0) {
+                  sum_bucket(sum, generators.data() + tile_first, bucket_indexes);
+                  is_set_p[bucket_index] = 1;
+                } else {
+                  add_to_bucket(sum, generators.data() + tile_first, bucket_indexes);
+                }
+              }
+            }
+          }
+        }
+      });
+
+  // merge the generator ranges
+  xent::parallel_for(
+      basit::index_range{0, bucket_sums.size()}, [&](basit::index_range rng) noexcept {
+        for (auto bucket_index = rng.a(); bucket_index < rng.b(); ++bucket_index) {
+          auto& sum = bucket_sums[bucket_index];
+          bool sum_is_set = is_set[bucket_index] != 0;
+          for (size_t range_index = 1; range_index < num_ranges; ++range_index) {
+            if (is_set[range_index * bucket_sums.size() + bucket_index] == 0) {
+              continue;
+            }
+            auto& partial_sum = range_sums(range_index)[bucket_index];
+            if (sum_is_set) {
+              add_inplace(sum, partial_sum);
+            } else {
+              sum = partial_sum;
+              sum_is_set = true;
+            }
+          }
+          if (!sum_is_set) {
+            sum = T::identity();
+          }
+        }
+      });
+}
+
+template <bascrv::element T>
+void accumulate_buckets_tiled_host(basct::span<T> bucket_sums, basct::cspan<T> generators,
+                                   basct::cspan<const uint8_t*> exponents,
+                                   unsigned tile_size = accumulation_tile_size_v) noexcept {
+  auto partition = make_tiled_accumulation_partition(xent::get_num_threads(), generators.size(),
+                                                     exponents.size(), tile_size);
+  accumulate_buckets_tiled_host<T>(bucket_sums, generators, exponents, tile_size, partition);
+}
+} // namespace sxt::mtxbk
@@ -0,0 +1,191 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/bucket_method/host_accumulation.h"
+
+#include <random>
+#include <vector>
+
+#include "sxt/base/curve/example_element.h"
+#include "sxt/base/test/unit_test.h"
+
+using namespace sxt;
+using namespace sxt::mtxbk;
+
+TEST_CASE("we can sum the generators of a bucket") {
+  using E = bascrv::element97;
+  E generators[] = {7, 5, 11};
+  E sum;
+
+  SECTION("an empty bucket sums to the identity") {
+    sum_bucket<E>(sum, generators, {});
+    REQUIRE(sum == E::identity());
+  }
+
+  SECTION("we can sum a bucket with several points") {
+    std::vector<unsigned> indexes = {0, 2};
+    sum_bucket<E>(sum, generators, indexes);
+    REQUIRE(sum == 18);
+  }
+
+  SECTION("we can add points to a bucket that's already been summed") {
+    sum = 3;
+    std::vector<unsigned> indexes = {1, 2};
+    add_to_bucket<E>(sum, generators, indexes);
+    REQUIRE(sum == 19);
+  }
+}
+
+TEST_CASE("we can accumulate buckets on the host") {
+  using E = bascrv::element97;
+  std::vector<E> bucket_sums(255 * 32);
+
+  SECTION("we handle a case with a single zero element") {
+    uint8_t scalar[32] = {};
+    const uint8_t* scalars[] = {scalar};
+    E generators[] = {7};
+    accumulate_buckets_host<E>(bucket_sums, generators, scalars);
+    for (auto val : bucket_sums) {
+      REQUIRE(val == E::identity());
+    }
+  }
+
+  SECTION("we handle a case with a single element of 1") {
+    uint8_t scalar[32] = {};
+    scalar[0] = 1;
+    const uint8_t* scalars[] = {scalar};
+    E generators[] = {7};
+    accumulate_buckets_host<E>(bucket_sums, generators, scalars);
+    for (size_t i = 0; i < bucket_sums.size(); ++i) {
+      auto val = bucket_sums[i];
+      if (i == 0) {
+        REQUIRE(val == 7);
+      } else {
+        REQUIRE(val == E::identity());
+      }
+    }
+  }
+
+  SECTION("we handle scalars that share a bucket") {
+    uint8_t scalar_data[96] = {};
+    scalar_data[0] = 2;
+    scalar_data[32] = 2;
+    scalar_data[64] = 1;
+    scalar_data[64 + 31] = 255;
+    const uint8_t* scalars[] = {scalar_data};
+    E generators[] = {7, 5, 3};
+    accumulate_buckets_host<E>(bucket_sums, generators, scalars);
+    for (size_t i = 0; i < bucket_sums.size(); ++i) {
+      auto val = bucket_sums[i];
+      if (i == 0) {
+        REQUIRE(val == 3);
+      } else if (i == 1) {
+        REQUIRE(val == 12);
+      } else if (i == 31 * 255 + 254) {
+        REQUIRE(val == 3);
+      } else {
+        REQUIRE(val == E::identity());
+      }
+    }
+  }
+
+  SECTION("we handle multiple outputs") {
+    bucket_sums.resize(255 * 32 * 2);
+    uint8_t scalar_data1[32] = {};
+    scalar_data1[0] = 1;
+    uint8_t scalar_data2[32] = {};
+    scalar_data2[1] = 3;
+    const uint8_t* scalars[] = {scalar_data1, scalar_data2};
+    E generators[] = {7};
+    accumulate_buckets_host<E>(bucket_sums, generators, scalars);
+    for (size_t i = 0; i < bucket_sums.size(); ++i) {
+      auto val = bucket_sums[i];
+      if (i == 0) {
+        REQUIRE(val == 7);
+      } else if (i == 255 * 32 + 255 + 2) {
+        REQUIRE(val == 7);
+      } else {
+        REQUIRE(val == E::identity());
+      }
+    }
+  }
+}
+
+TEST_CASE("tiled accumulation matches untiled accumulation") {
+  using E = bascrv::element97;
+  std::mt19937 rng{0};
+  auto num_outputs = GENERATE(1u, 3u);
+  auto n = GENERATE(1u, 10u, 100u);
+  auto tile_size = GENERATE(1u, 3u, 1024u);
+  std::vector<E> generators(n);
+  for (auto& g : generators) {
+    g = rng();
+  }
+  std::vector<std::vector<uint8_t>> scalar_data(num_outputs);
+  std::vector<const uint8_t*> scalars(num_outputs);
+  for (unsigned output_index = 0; output_index < num_outputs; ++output_index) {
+    scalar_data[output_index].resize(32 * n);
+    for (auto& byte : scalar_data[output_index]) {
+      byte = static_cast<uint8_t>(rng() % 4);
+    }
+    scalars[output_index] = scalar_data[output_index].data();
+  }
+  std::vector<E> expected(255 * 32 * num_outputs);
+  accumulate_buckets_host<E>(expected, generators, scalars);
+  std::vector<E> bucket_sums(expected.size(), 13u);
+
+  SECTION("we can pick the partition from the number of threads") {
+    accumulate_buckets_tiled_host<E>(bucket_sums, generators, scalars, tile_size);
+    REQUIRE(bucket_sums == expected);
+  }
+
+  SECTION("we can split the work across output groups and generator ranges") {
+    auto num_output_groups = GENERATE(1u, 2u, 4u);
+    auto num_generator_ranges = GENERATE(1u, 2u, 7u);
+    accumulate_buckets_tiled_host<E>(bucket_sums, generators, scalars, tile_size,
+                                     {
+                                         .num_output_groups = num_output_groups,
+                                         .num_generator_ranges = num_generator_ranges,
+                                     });
+    REQUIRE(bucket_sums == expected);
+  }
+}
+
+TEST_CASE("we can partition a tiled accumulation") {
+  SECTION("windows alone are enough for few threads") {
+    auto partition = make_tiled_accumulation_partition(32, 1u << 20u, 8, 1024);
+    REQUIRE(partition.num_output_groups == 1);
+    REQUIRE(partition.num_generator_ranges == 1);
+  }
+
+  SECTION("we split generators into ranges before splitting outputs") {
+    auto partition = make_tiled_accumulation_partition(128, 1u << 20u, 8, 1024);
+    REQUIRE(partition.num_output_groups == 1);
+    REQUIRE(partition.num_generator_ranges == 4);
+  }
+
+  SECTION("we split outputs when there aren't enough tiles") {
+    auto partition = make_tiled_accumulation_partition(128, 2048, 8, 1024);
+    REQUIRE(partition.num_output_groups == 2);
+    REQUIRE(partition.num_generator_ranges == 2);
+  }
+
+  SECTION("we don't make more output groups than outputs") {
+    auto partition = make_tiled_accumulation_partition(1024, 10, 3, 1024);
+    REQUIRE(partition.num_output_groups == 3);
+    REQUIRE(partition.num_generator_ranges == 1);
+  }
+}
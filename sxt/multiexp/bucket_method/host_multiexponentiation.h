@@ -0,0 +1,124 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+#include "sxt/base/container/span.h"
+#include "sxt/base/curve/element.h"
+#include "sxt/base/error/assert.h"
+#include "sxt/base/iterator/index_range.h"
+#include "sxt/execution/thread/parallel_for.h"
+#include "sxt/memory/management/managed_array.h"
+#include "sxt/multiexp/base/exponent_sequence.h"
+#include "sxt/multiexp/bucket_method/combination.h"
+#include "sxt/multiexp/bucket_method/host_accumulation.h"
+
+namespace sxt::mtxbk {
+//--------------------------------------------------------------------------------------------------
+// tiled_accumulation_min_num_outputs_v
+//--------------------------------------------------------------------------------------------------
+/**
+ * Minimum number of outputs before the accumulation is tiled over generators.
+ */
+constexpr size_t tiled_accumulation_min_num_outputs_v = 4;
+
+//--------------------------------------------------------------------------------------------------
+// multiexponentiate_host
+//--------------------------------------------------------------------------------------------------
+/**
+ * Host version of multiexponentiate using the same bucket layout.
+ *
+ * When there are enough outputs, accumulation is tiled over the generators so that each
+ * generator is loaded once for all outputs.
+ */
+template <bascrv::element T>
+void multiexponentiate_host(basct::span<T> res, basct::cspan<T> generators,
+                            basct::cspan<const uint8_t*> exponents) noexcept {
+  constexpr unsigned bucket_group_size = 255;
+  constexpr unsigned num_bucket_groups = 32;
+  auto num_outputs = exponents.size();
+  SXT_DEBUG_ASSERT(res.size() == num_outputs);
+  if (res.empty()) {
+    return;
+  }
+
+  // accumulate
+  memmg::managed_array<T> bucket_sums(bucket_group_size * num_bucket_groups * num_outputs);
+  if (num_outputs >= tiled_accumulation_min_num_outputs_v) {
+    accumulate_buckets_tiled_host<T>(bucket_sums, generators, exponents);
+  } else {
+    accumulate_buckets_host<T>(bucket_sums, generators, exponents);
+  }
+
+  // reduce buckets
+  memmg::managed_array<T> reduced_buckets(bucket_group_size * num_outputs);
+  xent::parallel_for(basit::index_range{0, reduced_buckets.size()},
+                     [&](basit::index_range rng) noexcept {
+                       for (auto i = rng.a(); i < rng.b(); ++i) {
+                         auto bucket_index = i % bucket_group_size;
+                         auto output_index = i / bucket_group_size;
+                         combine_bucket_group<bucket_group_size, num_bucket_groups>(
+                             reduced_buckets[i],
+                             bucket_sums.data() + bucket_index +
+                                 bucket_group_size * num_bucket_groups * output_index);
+                       }
+                     });
+
+  // combine buckets
+  combine_buckets<T>(res, reduced_buckets);
+}
+
+//--------------------------------------------------------------------------------------------------
+// try_multiexponentiate_host
+//--------------------------------------------------------------------------------------------------
+/**
+ * Host version of try_multiexponentiate: if the exponents all have 32 bytes and the same length,
+ * compute the multi-exponentiation with the bucket method; otherwise, return an empty array.
+ */
+template <bascrv::element Element>
+memmg::managed_array<Element>
+try_multiexponentiate_host(basct::cspan<Element> generators,
+                           basct::cspan<mtxb::exponent_sequence> exponents) noexcept {
+  auto num_outputs = exponents.size();
+  memmg::managed_array<Element> res;
+  uint64_t min_n = std::numeric_limits<uint64_t>::max();
+  uint64_t max_n = 0;
+  for (auto& exponent : exponents) {
+    if (exponent.element_nbytes != 32) {
+      return res;
+    }
+    min_n = std::min(min_n, exponent.n);
+    max_n = std::max(max_n, exponent.n);
+  }
+  if (num_outputs == 0 || min_n != max_n) {
+    return res;
+  }
+  auto n = max_n;
+  SXT_DEBUG_ASSERT(generators.size() >= n);
+  generators = generators.subspan(0, n);
+  memmg::managed_array<const uint8_t*> exponents_p(num_outputs);
+  for (size_t output_index = 0; output_index < num_outputs; ++output_index) {
+    exponents_p[output_index] = exponents[output_index].data;
+  }
+  res.resize(num_outputs);
+  multiexponentiate_host<Element>(res, generators, exponents_p);
+  return res;
+}
+} // namespace sxt::mtxbk
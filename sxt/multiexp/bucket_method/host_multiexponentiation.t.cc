@@ -0,0 +1,169 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/bucket_method/host_multiexponentiation.h"
+
+#include <random>
+#include <vector>
+
+#include "sxt/base/curve/example_element.h"
+#include "sxt/base/test/unit_test.h"
+
+using namespace sxt;
+using namespace sxt::mtxbk;
+
+TEST_CASE("we can compute a multiexponentiation on the host") {
+  using E = bascrv::element97;
+  std::vector<E> res(1);
+  std::vector<E> generators;
+  std::vector<const uint8_t*> exponents;
+
+  SECTION("we can compute a multiexponentiation with no elements") {
+    res.clear();
+    multiexponentiate_host<E>(res, generators, exponents);
+  }
+
+  SECTION("we can compute a multiexponentiation with a single zero element") {
+    uint8_t scalar_data[32] = {};
+    exponents.push_back(scalar_data);
+    generators = {12u};
+    multiexponentiate_host<E>(res, generators, exponents);
+    REQUIRE(res[0] == 0u);
+  }
+
+  SECTION("we can compute a multiexponentiation with a single element of 256") {
+    uint8_t scalar_data[32] = {};
+    scalar_data[1] = 1;
+    exponents.push_back(scalar_data);
+    generators = {12u};
+    multiexponentiate_host<E>(res, generators, exponents);
+    REQUIRE(res[0] == 256u * 12u);
+  }
+
+  SECTION("we can compute a multiexponetiation with multiple outputs") {
+    res.resize(2);
+
+    uint8_t scalar_data1[64] = {};
+    scalar_data1[0] = 2;
+    scalar_data1[32] = 3;
+    exponents.push_back(scalar_data1);
+
+    uint8_t scalar_data2[64] = {};
+    scalar_data2[0] = 7;
+    scalar_data2[32] = 4;
+    exponents.push_back(scalar_data2);
+
+    generators = {12u, 34u};
+
+    multiexponentiate_host<E>(res, generators, exponents);
+    REQUIRE(res[0] == 2u * 12u + 3u * 34u);
+    REQUIRE(res[1] == 7u * 12u + 4u * 34u);
+  }
+
+  SECTION("we can compute a multiexponentiation with random scalars") {
+    std::mt19937 rng{0};
+    unsigned n = 100;
+    std::vector<uint8_t> scalar_data(32 * n);
+    for (auto& byte : scalar_data) {
+      byte = static_cast<uint8_t>(rng());
+    }
+    exponents.push_back(scalar_data.data());
+    generators.resize(n);
+    E expected = 0u;
+    for (unsigned i = 0; i < n; ++i) {
+      generators[i] = rng();
+      unsigned scalar = 0;
+      for (unsigned j = 32; j-- > 0;) {
+        scalar = (scalar * 256u + scalar_data[32 * i + j]) % 97u;
+      }
+      add(expected, expected, E{scalar * generators[i].value});
+    }
+    multiexponentiate_host<E>(res, generators, exponents);
+    REQUIRE(res[0] == expected);
+  }
+}
+
+TEST_CASE("we can compute a multiexponentiation with many outputs on the host") {
+  using E = bascrv::element97;
+  std::mt19937 rng{0};
+  unsigned n = 10;
+  unsigned num_outputs = tiled_accumulation_min_num_outputs_v + 1;
+  std::vector<E> generators(n);
+  for (auto& g : generators) {
+    g = rng();
+  }
+  std::vector<uint8_t> scalar_data(32 * n * num_outputs);
+  for (auto& byte : scalar_data) {
+    byte = static_cast<uint8_t>(rng());
+  }
+  std::vector<const uint8_t*> exponents(num_outputs);
+  std::vector<E> expected(num_outputs, 0u);
+  for (unsigned output_index = 0; output_index < num_outputs; ++output_index) {
+    auto scalars = scalar_data.data() + 32 * n * output_index;
+    exponents[output_index] = scalars;
+    for (unsigned i = 0; i < n; ++i) {
+      unsigned scalar = 0;
+      for (unsigned j = 32; j-- > 0;) {
+        scalar = (scalar * 256u + scalars[32 * i + j]) % 97u;
+      }
+      add(expected[output_index], expected[output_index], E{scalar * generators[i].value});
+    }
+  }
+  std::vector<E> res(num_outputs);
+  multiexponentiate_host<E>(res, generators, exponents);
+  REQUIRE(res == expected);
+}
+
+TEST_CASE("we can compute multiexponentiations with exponent sequences on the host") {
+  using E = bascrv::element97;
+  std::vector<mtxb::exponent_sequence> exponents;
+
+  SECTION("exponentiation fails if the exponent sequences are not 32 bytes") {
+    exponents.push_back({
+        .element_nbytes = 1,
+        .n = 1,
+    });
+    std::vector<E> generators = {2u};
+    REQUIRE(try_multiexponentiate_host<E>(generators, exponents).empty());
+  }
+
+  SECTION("exponentiation fails if the exponent sequences are different lengths") {
+    exponents.push_back({
+        .element_nbytes = 32,
+        .n = 1,
+    });
+    exponents.push_back({
+        .element_nbytes = 32,
+        .n = 2,
+    });
+    std::vector<E> generators = {2u, 5u};
+    REQUIRE(try_multiexponentiate_host<E>(generators, exponents).empty());
+  }
+
+  SECTION("exponentiation succeeds if preconditions are met") {
+    uint8_t scalar_data[32] = {};
+    scalar_data[0] = 12;
+    exponents.push_back({
+        .element_nbytes = 32,
+        .n = 1,
+        .data = scalar_data,
+    });
+    std::vector<E> generators = {2u};
+    auto res = try_multiexponentiate_host<E>(generators, exponents);
+    REQUIRE(res.size() == 1);
+    REQUIRE(res[0] == 2u * 12u);
+  }
+}
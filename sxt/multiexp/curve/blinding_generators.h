@@ -0,0 +1,46 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+
+#include "sxt/base/container/span.h"
+#include "sxt/base/curve/element.h"
+#include "sxt/base/error/assert.h"
+#include "sxt/multiexp/base/blinding.h"
+
+namespace sxt::mtxcrv {
+//--------------------------------------------------------------------------------------------------
+// make_blinding_generators
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute the generators 2^(8k) h, k = 0, ..., mtxb::num_blinding_digits_v - 1, that pair with
+ * the digits of mtxb::make_blinding_sequence.
+ */
+template <bascrv::element Element>
+void make_blinding_generators(basct::span<Element> generators, const Element& h) noexcept {
+  SXT_RELEASE_ASSERT(generators.size() == mtxb::num_blinding_digits_v);
+  generators[0] = h;
+  for (size_t k = 1; k < generators.size(); ++k) {
+    auto e = generators[k - 1];
+    for (int i = 0; i < 8; ++i) {
+      double_element(e, e);
+    }
+    generators[k] = e;
+  }
+}
+} // namespace sxt::mtxcrv
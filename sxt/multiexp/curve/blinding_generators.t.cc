@@ -0,0 +1,41 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/curve/blinding_generators.h"
+
+#include <array>
+
+#include "sxt/base/test/unit_test.h"
+#include "sxt/curve21/operation/add.h"
+#include "sxt/curve21/operation/double.h"
+#include "sxt/curve21/operation/neg.h"
+#include "sxt/curve21/operation/overload.h"
+#include "sxt/curve21/type/element_p3.h"
+#include "sxt/ristretto/type/literal.h"
+
+using namespace sxt;
+using namespace sxt::mtxcrv;
+using sxt::rstt::operator""_rs;
+
+TEST_CASE("we can compute the generators for a blinding term") {
+  std::array<c21t::element_p3, mtxb::num_blinding_digits_v> generators;
+  auto h = 0x123_rs;
+  make_blinding_generators<c21t::element_p3>(generators, h);
+  REQUIRE(generators[0] == h);
+  REQUIRE(generators[1] == 256 * h);
+  REQUIRE(generators[2] == 256 * generators[1]);
+  REQUIRE(generators[31] == 256 * generators[30]);
+}
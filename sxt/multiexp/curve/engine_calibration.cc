@@ -0,0 +1,195 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/curve/engine_calibration.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstdlib>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <string>
+
+#include "sxt/base/error/assert.h"
+#include "sxt/multiexp/base/exponent_sequence.h"
+
+namespace sxt::mtxcrv {
+//--------------------------------------------------------------------------------------------------
+// format_version_v
+//--------------------------------------------------------------------------------------------------
+static constexpr unsigned format_version_v = 2;
+
+//--------------------------------------------------------------------------------------------------
+// nearest_index
+//--------------------------------------------------------------------------------------------------
+/**
+ * Index of the grid value nearest to val on a log scale.
+ */
+template <class T, size_t N>
+static size_t nearest_index(const std::array<T, N>& grid, size_t val) noexcept {
+  auto log_val = std::bit_width(val);
+  size_t res = 0;
+  auto best_distance = std::numeric_limits<int>::max();
+  for (size_t i = 0; i < N; ++i) {
+    auto distance = std::abs(static_cast<int>(std::bit_width(static_cast<size_t>(grid[i]))) -
+                             static_cast<int>(log_val));
+    if (distance < best_distance) {
+      best_distance = distance;
+      res = i;
+    }
+  }
+  return res;
+}
+
+//--------------------------------------------------------------------------------------------------
+// make_shape_index
+//--------------------------------------------------------------------------------------------------
+static size_t make_shape_index(size_t n_index, size_t element_nbytes_index,
+                               size_t num_outputs_index) noexcept {
+  return (n_index * calibration_element_nbytes_v.size() + element_nbytes_index) *
+             calibration_num_outputs_v.size() +
+         num_outputs_index;
+}
+
+//--------------------------------------------------------------------------------------------------
+// is_candidate
+//--------------------------------------------------------------------------------------------------
+static bool is_candidate(engine_t engine, const calibration_shape& shape) noexcept {
+  switch (engine) {
+  case engine_t::automatic:
+    return false;
+  case engine_t::naive:
+    return shape.n <= naive_calibration_max_n_v;
+  case engine_t::pippenger:
+    return true;
+  case engine_t::bucket:
+    // the bucket method only supports 32-byte exponents
+    return shape.element_nbytes == 32;
+  }
+  return false;
+}
+
+//--------------------------------------------------------------------------------------------------
+// constructor
+//--------------------------------------------------------------------------------------------------
+engine_calibration::engine_calibration() noexcept { engines_.fill(engine_t::automatic); }
+
+//--------------------------------------------------------------------------------------------------
+// shape
+//--------------------------------------------------------------------------------------------------
+calibration_shape engine_calibration::shape(size_t shape_index) noexcept {
+  SXT_DEBUG_ASSERT(shape_index < num_shapes_v);
+  auto num_outputs_index = shape_index % calibration_num_outputs_v.size();
+  shape_index /= calibration_num_outputs_v.size();
+  auto element_nbytes_index = shape_index % calibration_element_nbytes_v.size();
+  auto n_index = shape_index / calibration_element_nbytes_v.size();
+  return {
+      .n = calibration_ns_v[n_index],
+      .element_nbytes = calibration_element_nbytes_v[element_nbytes_index],
+      .num_outputs = calibration_num_outputs_v[num_outputs_index],
+  };
+}
+
+//--------------------------------------------------------------------------------------------------
+// select_engine
+//--------------------------------------------------------------------------------------------------
+engine_t
+engine_calibration::select_engine(basct::cspan<mtxb::exponent_sequence> exponents) const noexcept {
+  size_t n = 0;
+  size_t element_nbytes = 0;
+  for (auto& exponent_sequence : exponents) {
+    n = std::max(n, static_cast<size_t>(exponent_sequence.n));
+    element_nbytes =
+        std::max(element_nbytes, static_cast<size_t>(exponent_sequence.element_nbytes));
+  }
+  auto shape_index = make_shape_index(nearest_index(calibration_ns_v, n),
+                                      nearest_index(calibration_element_nbytes_v, element_nbytes),
+                                      nearest_index(calibration_num_outputs_v, exponents.size()));
+  return engines_[shape_index];
+}
+
+//--------------------------------------------------------------------------------------------------
+// calibrate_engines
+//--------------------------------------------------------------------------------------------------
+void calibrate_engines(
+    engine_calibration& calibration,
+    basf::function_ref<double(engine_t, const calibration_shape&)> time_engine) noexcept {
+  for (size_t shape_index = 0; shape_index < engine_calibration::num_shapes_v; ++shape_index) {
+    auto shape = engine_calibration::shape(shape_index);
+    auto best_engine = engine_t::automatic;
+    auto best_time = std::numeric_limits<double>::max();
+    for (auto engine : {engine_t::naive, engine_t::pippenger, engine_t::bucket}) {
+      if (!is_candidate(engine, shape)) {
+        continue;
+      }
+      auto t = time_engine(engine, shape);
+      if (t < best_time) {
+        best_time = t;
+        best_engine = engine;
+      }
+    }
+    calibration.set_engine(shape_index, best_engine);
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// write_engine_calibration
+//--------------------------------------------------------------------------------------------------
+void write_engine_calibration(std::ostream& out, const engine_calibration& calibration,
+                              std::string_view label, size_t num_threads) noexcept {
+  out << "blitzar-engine-calibration " << format_version_v << " " << label << " " << num_threads
+      << "\n";
+  for (size_t shape_index = 0; shape_index < engine_calibration::num_shapes_v; ++shape_index) {
+    auto shape = engine_calibration::shape(shape_index);
+    out << shape.n << " " << shape.element_nbytes << " " << shape.num_outputs << " "
+        << static_cast<int>(calibration.engine(shape_index)) << "\n";
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// read_engine_calibration
+//--------------------------------------------------------------------------------------------------
+bool read_engine_calibration(engine_calibration& calibration, std::istream& in,
+                             std::string_view label, size_t num_threads) noexcept {
+  std::string magic, label_p;
+  unsigned version = 0;
+  size_t num_threads_p = 0;
+  if (!(in >> magic >> version >> label_p >> num_threads_p)) {
+    return false;
+  }
+  if (magic != "blitzar-engine-calibration" || version != format_version_v || label_p != label ||
+      num_threads_p != num_threads) {
+    return false;
+  }
+  engine_calibration res;
+  for (size_t shape_index = 0; shape_index < engine_calibration::num_shapes_v; ++shape_index) {
+    calibration_shape shape;
+    int engine = 0;
+    if (!(in >> shape.n >> shape.element_nbytes >> shape.num_outputs >> engine)) {
+      return false;
+    }
+    if (shape != engine_calibration::shape(shape_index) ||
+        engine < static_cast<int>(engine_t::automatic) ||
+        engine > static_cast<int>(engine_t::bucket)) {
+      return false;
+    }
+    res.set_engine(shape_index, static_cast<engine_t>(engine));
+  }
+  calibration = res;
+  return true;
+}
+} // namespace sxt::mtxcrv
@@ -0,0 +1,186 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <iosfwd>
+#include <optional>
+#include <string_view>
+
+#include "sxt/base/container/span.h"
+#include "sxt/base/functional/function_ref.h"
+#include "sxt/multiexp/curve/engine.h"
+
+namespace sxt::mtxb {
+struct exponent_sequence;
+}
+
+namespace sxt::mtxcrv {
+//--------------------------------------------------------------------------------------------------
+// calibration_shape
+//--------------------------------------------------------------------------------------------------
+/**
+ * The dimensions of a representative multiexponentiation that engines are timed on.
+ */
+struct calibration_shape {
+  size_t n;
+  unsigned element_nbytes;
+  size_t num_outputs;
+
+  bool operator==(const calibration_shape&) const noexcept = default;
+};
+
+//--------------------------------------------------------------------------------------------------
+// calibration grid
+//--------------------------------------------------------------------------------------------------
+constexpr std::array<size_t, 5> calibration_ns_v{1u << 4u, 1u << 7u, 1u << 10u, 1u << 13u,
+                                                  1u << 16u};
+constexpr std::array<unsigned, 2> calibration_element_nbytes_v{1, 32};
+constexpr std::array<size_t, 2> calibration_num_outputs_v{1, 8};
+
+//--------------------------------------------------------------------------------------------------
+// naive_calibration_max_n_v
+//--------------------------------------------------------------------------------------------------
+/**
+ * The naive engine shares no work between terms and is far slower on long sequences, so it's
+ * only timed on shapes up to this length.
+ */
+constexpr size_t naive_calibration_max_n_v = 1u << 10u;
+
+//--------------------------------------------------------------------------------------------------
+// engine_calibration
+//--------------------------------------------------------------------------------------------------
+/**
+ * The fastest engine measured for each shape of the calibration grid.
+ */
+class engine_calibration {
+public:
+  static constexpr size_t num_shapes_v = calibration_ns_v.size() *
+                                         calibration_element_nbytes_v.size() *
+                                         calibration_num_outputs_v.size();
+
+  engine_calibration() noexcept;
+
+  static calibration_shape shape(size_t shape_index) noexcept;
+
+  engine_t engine(size_t shape_index) const noexcept { return engines_[shape_index]; }
+
+  void set_engine(size_t shape_index, engine_t engine) noexcept { engines_[shape_index] = engine; }
+
+  /**
+   * Return the engine measured for the grid shape nearest to the given multiexponentiation.
+   */
+  engine_t select_engine(basct::cspan<mtxb::exponent_sequence> exponents) const noexcept;
+
+private:
+  std::array<engine_t, num_shapes_v> engines_;
+};
+
+//--------------------------------------------------------------------------------------------------
+// calibrate_engines
+//--------------------------------------------------------------------------------------------------
+/**
+ * For each shape of the grid, record the engine for which time_engine reports the smallest time.
+ */
+void calibrate_engines(
+    engine_calibration& calibration,
+    basf::function_ref<double(engine_t, const calibration_shape&)> time_engine) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// write_engine_calibration
+//--------------------------------------------------------------------------------------------------
+/**
+ * Serialize a calibration. label identifies the backend it was measured on and num_threads the
+ * host thread budget.
+ */
+void write_engine_calibration(std::ostream& out, const engine_calibration& calibration,
+                              std::string_view label, size_t num_threads) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// read_engine_calibration
+//--------------------------------------------------------------------------------------------------
+/**
+ * Deserialize a calibration. Returns false if the input is malformed or was measured with a
+ * different label or thread budget.
+ */
+bool read_engine_calibration(engine_calibration& calibration, std::istream& in,
+                             std::string_view label, size_t num_threads) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// engine_calibration_v
+//--------------------------------------------------------------------------------------------------
+/**
+ * The calibration installed for multiexponentiations over Element, if any.
+ *
+ * Each curve has its own calibration since how the engines rank depends on the relative cost of
+ * the curve's operations.
+ */
+template <class Element> inline std::optional<engine_calibration> engine_calibration_v{};
+
+//--------------------------------------------------------------------------------------------------
+// set_engine_calibration
+//--------------------------------------------------------------------------------------------------
+/**
+ * Install the calibration used to resolve engine_t::automatic for multiexponentiations over
+ * Element. This should be called during initialization, before any multiexponentiation is
+ * computed.
+ */
+template <class Element>
+void set_engine_calibration(const engine_calibration& calibration) noexcept {
+  engine_calibration_v<Element> = calibration;
+}
+
+//--------------------------------------------------------------------------------------------------
+// get_engine_calibration
+//--------------------------------------------------------------------------------------------------
+/**
+ * The calibration installed for Element or nullptr if none is installed.
+ */
+template <class Element> const engine_calibration* get_engine_calibration() noexcept {
+  if (!engine_calibration_v<Element>) {
+    return nullptr;
+  }
+  return &*engine_calibration_v<Element>;
+}
+
+//--------------------------------------------------------------------------------------------------
+// reset_engine_calibration_for_testing
+//--------------------------------------------------------------------------------------------------
+template <class Element> void reset_engine_calibration_for_testing() noexcept {
+  engine_calibration_v<Element>.reset();
+}
+
+//--------------------------------------------------------------------------------------------------
+// resolve_engine
+//--------------------------------------------------------------------------------------------------
+/**
+ * If engine is automatic and a calibration is installed for Element, return the calibrated
+ * engine for the exponents; otherwise, return engine unchanged.
+ */
+template <class Element>
+engine_t resolve_engine(engine_t engine, basct::cspan<mtxb::exponent_sequence> exponents) noexcept {
+  if (engine != engine_t::automatic) {
+    return engine;
+  }
+  auto calibration = get_engine_calibration<Element>();
+  if (calibration == nullptr) {
+    return engine;
+  }
+  return calibration->select_engine(exponents);
+}
+} // namespace sxt::mtxcrv
@@ -0,0 +1,119 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/curve/engine_calibration.h"
+
+#include <sstream>
+#include <vector>
+
+#include "sxt/base/test/unit_test.h"
+#include "sxt/multiexp/base/exponent_sequence.h"
+
+using namespace sxt;
+using namespace sxt::mtxcrv;
+
+namespace {
+struct curve1_element {};
+struct curve2_element {};
+} // namespace
+
+TEST_CASE("we can calibrate multiexponentiation engines") {
+  engine_calibration calibration;
+
+  // pretend the naive engine is fastest for short sequences and bucket for long ones
+  std::vector<calibration_shape> timed_shapes;
+  auto time_engine = [&](engine_t engine, const calibration_shape& shape) noexcept -> double {
+    if (engine == engine_t::naive) {
+      timed_shapes.push_back(shape);
+      return shape.n <= 64 ? 1.0 : 100.0;
+    }
+    if (engine == engine_t::bucket) {
+      return shape.n >= 16384 ? 1.0 : 100.0;
+    }
+    return 10.0;
+  };
+  calibrate_engines(calibration, time_engine);
+
+  SECTION("every shape is assigned an engine") {
+    for (size_t shape_index = 0; shape_index < engine_calibration::num_shapes_v; ++shape_index) {
+      REQUIRE(calibration.engine(shape_index) != engine_t::automatic);
+    }
+  }
+
+  SECTION("the naive engine isn't timed on long sequences") {
+    for (auto& shape : timed_shapes) {
+      REQUIRE(shape.n <= naive_calibration_max_n_v);
+    }
+  }
+
+  SECTION("we select the engine for the nearest shape") {
+    mtxb::exponent_sequence seq{.element_nbytes = 32, .n = 50, .data = nullptr, .is_signed = 0};
+    REQUIRE(calibration.select_engine({&seq, 1}) == engine_t::naive);
+
+    seq.n = 1000;
+    REQUIRE(calibration.select_engine({&seq, 1}) == engine_t::pippenger);
+
+    seq.n = 1u << 20u;
+    REQUIRE(calibration.select_engine({&seq, 1}) == engine_t::bucket);
+
+    // the bucket engine only handles 32-byte exponents
+    seq.element_nbytes = 1;
+    REQUIRE(calibration.select_engine({&seq, 1}) == engine_t::pippenger);
+  }
+
+  SECTION("we can round trip a calibration through its serialization") {
+    std::stringstream ss;
+    write_engine_calibration(ss, calibration, "cpu", 4);
+    engine_calibration calibration_p;
+    REQUIRE(read_engine_calibration(calibration_p, ss, "cpu", 4));
+    for (size_t shape_index = 0; shape_index < engine_calibration::num_shapes_v; ++shape_index) {
+      REQUIRE(calibration_p.engine(shape_index) == calibration.engine(shape_index));
+    }
+  }
+
+  SECTION("we reject a calibration measured on a different backend or thread budget") {
+    std::stringstream ss;
+    write_engine_calibration(ss, calibration, "cpu", 4);
+    engine_calibration calibration_p;
+    std::stringstream ss1{ss.str()};
+    REQUIRE(!read_engine_calibration(calibration_p, ss1, "gpu", 4));
+    std::stringstream ss2{ss.str()};
+    REQUIRE(!read_engine_calibration(calibration_p, ss2, "cpu", 8));
+  }
+
+  SECTION("we reject a malformed calibration") {
+    std::stringstream ss{"blitzar-engine-calibration 2 cpu 4\n64 1 1"};
+    engine_calibration calibration_p;
+    REQUIRE(!read_engine_calibration(calibration_p, ss, "cpu", 4));
+  }
+
+  SECTION("automatic engines are resolved with the calibration installed for the curve") {
+    mtxb::exponent_sequence seq{.element_nbytes = 32, .n = 50, .data = nullptr, .is_signed = 0};
+    REQUIRE(resolve_engine<curve1_element>(engine_t::automatic, {&seq, 1}) ==
+            engine_t::automatic);
+    set_engine_calibration<curve1_element>(calibration);
+    REQUIRE(resolve_engine<curve1_element>(engine_t::automatic, {&seq, 1}) == engine_t::naive);
+    REQUIRE(resolve_engine<curve1_element>(engine_t::bucket, {&seq, 1}) == engine_t::bucket);
+
+    // other curves are unaffected
+    REQUIRE(get_engine_calibration<curve2_element>() == nullptr);
+    REQUIRE(resolve_engine<curve2_element>(engine_t::automatic, {&seq, 1}) ==
+            engine_t::automatic);
+
+    reset_engine_calibration_for_testing<curve1_element>();
+    REQUIRE(get_engine_calibration<curve1_element>() == nullptr);
+  }
+}
@@ -27,6 +27,7 @@
 #include "sxt/base/device/event_utility.h"
 #include "sxt/base/device/memory_utility.h"
 #include "sxt/base/device/stream.h"
+#include "sxt/base/error/assert.h"
 #include "sxt/base/iterator/index_range.h"
 #include "sxt/base/num/divide_up.h"
 #include "sxt/execution/async/coroutine.h"
@@ -37,11 +38,18 @@
 #include "sxt/memory/resource/async_device_resource.h"
 #include "sxt/memory/resource/device_resource.h"
 #include "sxt/multiexp/base/exponent_sequence.h"
+#include "sxt/multiexp/base/packed_sequence.h"
+#include "sxt/multiexp/base/segmented_generators.h"
+#include "sxt/multiexp/bucket_method/host_multiexponentiation.h"
 #include "sxt/multiexp/bucket_method/multiexponentiation.h"
+#include "sxt/multiexp/curve/engine.h"
+#include "sxt/multiexp/curve/engine_calibration.h"
 #include "sxt/multiexp/curve/multiexponentiation_cpu_driver.h"
 #include "sxt/multiexp/curve/multiproduct.h"
 #include "sxt/multiexp/curve/multiproducts_combination.h"
+#include "sxt/multiexp/curve/naive_multiproduct_solver.h"
 #include "sxt/multiexp/curve/pippenger_multiproduct_solver.h"
+#include "sxt/multiexp/curve/pipelined_multiexponentiation.h"
 #include "sxt/multiexp/pippenger/multiexponentiation.h"
 #include "sxt/multiexp/pippenger/multiproduct_decomposition_gpu.h"
 
@@ -141,19 +149,165 @@ compute_multiexponentiation(basct::cspan<Element> generators,
 }
 
 //--------------------------------------------------------------------------------------------------
-// async_compute_multiexponentiation
+// is_small_multiexponentiation
 //--------------------------------------------------------------------------------------------------
+/**
+ * Return true if the multiexponentiation is small enough that the setup cost of Pippenger's
+ * algorithm or of a device computation would dominate.
+ *
+ * Note: The threshold is a ballpark estimate and hasn't been informed by much benchmarking.
+ */
+inline bool is_small_multiexponentiation(basct::cspan<mtxb::exponent_sequence> exponents) noexcept {
+  static constexpr size_t max_small_num_bytes = 1ull << 10u;
+  size_t num_bytes = 0;
+  for (auto& exponent_sequence : exponents) {
+    num_bytes += exponent_sequence.n * exponent_sequence.element_nbytes;
+  }
+  return num_bytes <= max_small_num_bytes;
+}
+
+//--------------------------------------------------------------------------------------------------
+// compute_multiexponentiation
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute a multiexponentiation on the host with the given engine.
+ *
+ * An automatic engine is resolved with the calibration installed for Element, if any. If the
+ * exponents don't fit the shape the bucket method supports, it's served by Pippenger's algorithm.
+ */
 template <bascrv::element Element>
-xena::future<memmg::managed_array<Element>>
-async_compute_multiexponentiation(basct::cspan<Element> generators,
-                                  basct::cspan<mtxb::exponent_sequence> exponents) noexcept {
-  // try bucket method first
-  auto res_maybe = co_await mtxbk::try_multiexponentiate(generators, exponents);
-  if (!res_maybe.empty()) {
-    co_return res_maybe;
+memmg::managed_array<Element>
+compute_multiexponentiation(basct::cspan<Element> generators,
+                            basct::cspan<mtxb::exponent_sequence> exponents,
+                            engine_t engine) noexcept {
+  engine = resolve_engine<Element>(engine, exponents);
+  if (engine == engine_t::automatic && is_small_multiexponentiation(exponents)) {
+    engine = engine_t::naive;
+  }
+  if (engine == engine_t::bucket) {
+    auto res = mtxbk::try_multiexponentiate_host<Element>(generators, exponents);
+    if (!res.empty()) {
+      return res;
+    }
+  }
+  if (engine != engine_t::naive) {
+    return compute_multiexponentiation<Element>(generators, exponents);
   }
+  naive_multiproduct_solver<Element> solver;
+  multiexponentiation_cpu_driver<Element> driver{&solver};
+  return mtxpi::compute_multiexponentiation(
+             driver,
+             {static_cast<const void*>(generators.data()), generators.size(), sizeof(Element)},
+             exponents)
+      .value()
+      .template as_array<Element>();
+}
 
-  // use more general method
+//--------------------------------------------------------------------------------------------------
+// compute_multiexponentiation
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute a multiexponentiation on the host over a segmented sequence of generators with the
+ * given engine.
+ *
+ * If the exponents only reach into the precomputed segment, this is the same as computing over
+ * that segment. Otherwise, if the engine resolves to Pippenger's algorithm and there's more than
+ * a chunk of terms, the multiexponentiation is pipelined over chunks of generators and the tail is
+ * computed chunk by chunk alongside the accumulation. Any other problem is computed with the
+ * engine in two parts whose results are added: the precomputed segment in place and the tail
+ * assembled in a buffer.
+ */
+template <bascrv::element Element>
+memmg::managed_array<Element>
+compute_multiexponentiation(const mtxb::segmented_generators<Element>& generators,
+                            basct::cspan<mtxb::exponent_sequence> exponents,
+                            engine_t engine) noexcept {
+  size_t n = 0;
+  for (auto& exponent_sequence : exponents) {
+    n = std::max(n, static_cast<size_t>(exponent_sequence.n));
+  }
+  SXT_DEBUG_ASSERT(generators.size() >= n);
+  if (n <= generators.precomputed().size()) {
+    return compute_multiexponentiation<Element>(generators.precomputed(), exponents, engine);
+  }
+  engine = resolve_engine<Element>(engine, exponents);
+  auto is_pippenger = engine == engine_t::pippenger ||
+                      (engine == engine_t::automatic && !is_small_multiexponentiation(exponents));
+  if (is_pippenger && n > pipelined_multiexponentiation_chunk_size_v) {
+    pippenger_multiproduct_solver<Element> solver;
+    return compute_multiexponentiation_pipelined<Element>(generators, exponents, solver);
+  }
+
+  // compute the precomputed segment in place and assemble only the tail
+  auto precomputed = generators.precomputed();
+  auto num_precomputed = precomputed.size();
+  memmg::managed_array<mtxb::exponent_sequence> tail_exponents(exponents.size());
+  slice_exponents(tail_exponents, exponents, num_precomputed, n - num_precomputed);
+  memmg::managed_array<Element> tail_data;
+  auto res = compute_multiexponentiation<Element>(
+      generators.get(tail_data, num_precomputed, n - num_precomputed), tail_exponents, engine);
+  if (num_precomputed == 0) {
+    return res;
+  }
+  memmg::managed_array<mtxb::exponent_sequence> precomputed_exponents(exponents.size());
+  slice_exponents(precomputed_exponents, exponents, 0, num_precomputed);
+  auto precomputed_res =
+      compute_multiexponentiation<Element>(precomputed, precomputed_exponents, engine);
+  for (size_t output_index = 0; output_index < res.size(); ++output_index) {
+    add_inplace(res[output_index], precomputed_res[output_index]);
+  }
+  return res;
+}
+
+/**
+ * Compute a multiexponentiation of bit-packed sequences on the host with the given engine.
+ *
+ * If the engine resolves to Pippenger's algorithm and there's more than a chunk of terms, the
+ * sequences are unpacked chunk by chunk as the pipeline decomposes them. Otherwise they're
+ * unpacked once and computed like any other sequences.
+ */
+template <bascrv::element Element>
+memmg::managed_array<Element>
+compute_multiexponentiation(const mtxb::segmented_generators<Element>& generators,
+                            basct::cspan<mtxb::packed_sequence> exponents,
+                            engine_t engine) noexcept {
+  size_t n = 0;
+  size_t num_bytes = 0;
+  memmg::managed_array<mtxb::exponent_sequence> unpacked(exponents.size());
+  for (size_t output_index = 0; output_index < exponents.size(); ++output_index) {
+    auto& exponent = exponents[output_index];
+    auto element_nbytes = mtxb::unpacked_element_nbytes(exponent.element_nbits);
+    n = std::max(n, static_cast<size_t>(exponent.n));
+    num_bytes += exponent.n * element_nbytes;
+    unpacked[output_index] = {
+        .element_nbytes = static_cast<uint8_t>(element_nbytes),
+        .n = exponent.n,
+    };
+  }
+  engine = resolve_engine<Element>(engine, unpacked);
+  auto is_pippenger = engine == engine_t::pippenger || engine == engine_t::automatic;
+  if (is_pippenger && n > pipelined_multiexponentiation_chunk_size_v) {
+    pippenger_multiproduct_solver<Element> solver;
+    return compute_multiexponentiation_pipelined<Element>(generators, exponents, solver);
+  }
+  memmg::managed_array<uint8_t> data(num_bytes);
+  auto out = data.data();
+  for (size_t output_index = 0; output_index < exponents.size(); ++output_index) {
+    auto& exponent = exponents[output_index];
+    auto n_p = static_cast<size_t>(exponent.n);
+    auto exponent_num_bytes = n_p * unpacked[output_index].element_nbytes;
+    unpacked[output_index] = mtxb::unpack_sequence({out, exponent_num_bytes}, exponent, 0, n_p);
+    out += exponent_num_bytes;
+  }
+  return compute_multiexponentiation<Element>(generators, unpacked, engine);
+}
+
+//--------------------------------------------------------------------------------------------------
+// async_compute_multiexponentiation_pippenger
+//--------------------------------------------------------------------------------------------------
+template <bascrv::element Element>
+static xena::future<memmg::managed_array<Element>> async_compute_multiexponentiation_pippenger(
+    basct::cspan<Element> generators, basct::cspan<mtxb::exponent_sequence> exponents) noexcept {
   auto num_outputs = exponents.size();
   std::vector<basct::blob_array> or_alls;
   or_alls.reserve(num_outputs);
@@ -190,6 +344,57 @@ async_compute_multiexponentiation(basct::cspan<Element> generators,
   co_return res;
 }
 
+//--------------------------------------------------------------------------------------------------
+// async_compute_multiexponentiation
+//--------------------------------------------------------------------------------------------------
+template <bascrv::element Element>
+xena::future<memmg::managed_array<Element>>
+async_compute_multiexponentiation(basct::cspan<Element> generators,
+                                  basct::cspan<mtxb::exponent_sequence> exponents) noexcept {
+  // try bucket method first
+  auto res_maybe = co_await mtxbk::try_multiexponentiate(generators, exponents);
+  if (!res_maybe.empty()) {
+    co_return res_maybe;
+  }
+
+  // use more general method
+  co_return co_await async_compute_multiexponentiation_pippenger(generators, exponents);
+}
+
+/**
+ * Compute a multiexponentiation with the given engine.
+ *
+ * An automatic engine is resolved with the calibration installed for Element, if any. Small
+ * problems and the naive engine are computed on the host. If the problem dimensions aren't
+ * supported by the bucket method, the bucket engine falls back to Pippenger's algorithm.
+ */
+template <bascrv::element Element>
+xena::future<memmg::managed_array<Element>>
+async_compute_multiexponentiation(basct::cspan<Element> generators,
+                                  basct::cspan<mtxb::exponent_sequence> exponents,
+                                  engine_t engine) noexcept {
+  engine = resolve_engine<Element>(engine, exponents);
+  switch (engine) {
+  case engine_t::automatic:
+    if (is_small_multiexponentiation(exponents)) {
+      co_return compute_multiexponentiation<Element>(generators, exponents, engine_t::naive);
+    }
+    co_return co_await async_compute_multiexponentiation<Element>(generators, exponents);
+  case engine_t::naive:
+    co_return compute_multiexponentiation<Element>(generators, exponents, engine_t::naive);
+  case engine_t::bucket: {
+    auto res_maybe = co_await mtxbk::try_multiexponentiate(generators, exponents, 1);
+    if (!res_maybe.empty()) {
+      co_return res_maybe;
+    }
+    break;
+  }
+  case engine_t::pippenger:
+    break;
+  }
+  co_return co_await async_compute_multiexponentiation_pippenger(generators, exponents);
+}
+
 template <bascrv::element Element>
 xena::future<Element>
 async_compute_multiexponentiation(basct::cspan<Element> generators,
@@ -17,7 +17,10 @@
 #include "sxt/multiexp/curve/multiexponentiation.h"
 
 #include <algorithm>
+#include <random>
+#include <vector>
 
+#include "sxt/base/num/divide_up.h"
 #include "sxt/base/test/unit_test.h"
 #include "sxt/curve21/operation/add.h"
 #include "sxt/curve21/operation/double.h"
@@ -26,7 +29,10 @@
 #include "sxt/execution/async/future.h"
 #include "sxt/execution/schedule/scheduler.h"
 #include "sxt/memory/management/managed_array.h"
+#include "sxt/multiexp/base/packed_sequence.h"
+#include "sxt/multiexp/base/segmented_generators.h"
 #include "sxt/multiexp/test/multiexponentiation.h"
+#include "sxt/ristretto/random/element.h"
 
 using namespace sxt;
 using namespace sxt::mtxcrv;
@@ -40,6 +46,131 @@ TEST_CASE("we can compute multiexponentiations") {
   mtxtst::exercise_multiexponentiation_fn(rng, f);
 }
 
+TEST_CASE("we can compute multiexponentiations with a given engine") {
+  std::mt19937 rng{97834978};
+  for (auto engine : {engine_t::automatic, engine_t::naive, engine_t::pippenger, engine_t::bucket}) {
+    auto f = [&](basct::cspan<c21t::element_p3> generators,
+                 basct::cspan<mtxb::exponent_sequence> exponents) noexcept {
+      return compute_multiexponentiation<c21t::element_p3>(generators, exponents, engine);
+    };
+    mtxtst::exercise_multiexponentiation_fn(rng, f);
+  }
+}
+
+TEST_CASE("we can compute multiexponentiations over segmented generators") {
+  std::mt19937 rng{97834978};
+  for (auto engine :
+       {engine_t::automatic, engine_t::naive, engine_t::pippenger, engine_t::bucket}) {
+    for (size_t num_precomputed : {0ul, 3ul, 1000000ul}) {
+      auto f = [&](basct::cspan<c21t::element_p3> generators,
+                   basct::cspan<mtxb::exponent_sequence> exponents) noexcept {
+        mtxb::segmented_generators<c21t::element_p3> segments{
+            generators.subspan(0, std::min(num_precomputed, generators.size())),
+            generators.size(), [&](basct::span<c21t::element_p3> tail, size_t first) noexcept {
+              std::copy_n(generators.begin() + first, tail.size(), tail.begin());
+            }};
+        return compute_multiexponentiation<c21t::element_p3>(segments, exponents, engine);
+      };
+      mtxtst::exercise_multiexponentiation_fn(rng, f);
+    }
+  }
+}
+
+TEST_CASE("only pippenger's algorithm pipelines segmented generators") {
+  std::mt19937 rng{97834978};
+  auto n = pipelined_multiexponentiation_chunk_size_v + 3;
+  std::vector<c21t::element_p3> generators(n, c21t::element_p3::identity());
+  c21t::element_p3 g;
+  rstrn::generate_random_element(g, rng);
+  generators[0] = g;
+  generators[n - 1] = g;
+  c21t::element_p3 twice_g;
+  c21o::add(twice_g, g, g);
+  std::vector<uint8_t> exponent_data(n, 1);
+  mtxb::exponent_sequence exponents{
+      .element_nbytes = 1,
+      .n = n,
+      .data = exponent_data.data(),
+      .is_signed = 0,
+  };
+  size_t num_tail_calls = 0;
+  size_t num_tail_generators = 0;
+  mtxb::segmented_generators<c21t::element_p3> segments{
+      basct::cspan<c21t::element_p3>{generators}.subspan(0, 3), n,
+      [&](basct::span<c21t::element_p3> tail, size_t first) noexcept {
+        REQUIRE(first >= 3);
+        std::copy_n(generators.begin() + first, tail.size(), tail.begin());
+        ++num_tail_calls;
+        num_tail_generators += tail.size();
+      }};
+
+  SECTION("the naive engine uses the precomputed segment in place and computes the tail at once") {
+    auto res = compute_multiexponentiation<c21t::element_p3>(segments, {&exponents, 1},
+                                                             engine_t::naive);
+    REQUIRE(res.size() == 1);
+    REQUIRE(res[0] == twice_g);
+    REQUIRE(num_tail_calls == 1);
+    REQUIRE(num_tail_generators == n - 3);
+  }
+
+  SECTION("pippenger's algorithm computes the tail a chunk at a time") {
+    auto res = compute_multiexponentiation<c21t::element_p3>(segments, {&exponents, 1},
+                                                             engine_t::pippenger);
+    REQUIRE(res.size() == 1);
+    REQUIRE(res[0] == twice_g);
+    REQUIRE(num_tail_calls == 2);
+    REQUIRE(num_tail_generators == n - 3);
+  }
+}
+
+TEST_CASE("we can compute multiexponentiations of bit-packed sequences") {
+  std::mt19937 rng{97834978};
+  auto n = pipelined_multiexponentiation_chunk_size_v + 3;
+  std::vector<c21t::element_p3> generators(n, c21t::element_p3::identity());
+  c21t::element_p3 g;
+  rstrn::generate_random_element(g, rng);
+  generators[0] = g;
+  generators[n - 1] = g;
+  c21t::element_p3 twice_g;
+  c21o::add(twice_g, g, g);
+  std::vector<uint8_t> packed_data(basn::divide_up(n, 8ul), 0xff);
+  size_t num_tail_calls = 0;
+  mtxb::segmented_generators<c21t::element_p3> segments{
+      basct::cspan<c21t::element_p3>{generators}.subspan(0, 3), n,
+      [&](basct::span<c21t::element_p3> tail, size_t first) noexcept {
+        std::copy_n(generators.begin() + first, tail.size(), tail.begin());
+        ++num_tail_calls;
+      }};
+
+  SECTION("small problems are unpacked and computed with any engine") {
+    for (auto engine :
+         {engine_t::automatic, engine_t::naive, engine_t::pippenger, engine_t::bucket}) {
+      mtxb::packed_sequence exponents{.element_nbits = 1, .n = 10, .data = packed_data.data()};
+      auto res = compute_multiexponentiation<c21t::element_p3>(segments, {&exponents, 1}, engine);
+      REQUIRE(res.size() == 1);
+      REQUIRE(res[0] == g);
+    }
+  }
+
+  SECTION("pippenger's algorithm unpacks large problems a chunk at a time") {
+    mtxb::packed_sequence exponents{.element_nbits = 1, .n = n, .data = packed_data.data()};
+    auto res = compute_multiexponentiation<c21t::element_p3>(segments, {&exponents, 1},
+                                                             engine_t::pippenger);
+    REQUIRE(res.size() == 1);
+    REQUIRE(res[0] == twice_g);
+    REQUIRE(num_tail_calls == 2);
+  }
+
+  SECTION("other engines compute large problems unpacked") {
+    mtxb::packed_sequence exponents{.element_nbits = 1, .n = n, .data = packed_data.data()};
+    auto res = compute_multiexponentiation<c21t::element_p3>(segments, {&exponents, 1},
+                                                             engine_t::naive);
+    REQUIRE(res.size() == 1);
+    REQUIRE(res[0] == twice_g);
+    REQUIRE(num_tail_calls == 1);
+  }
+}
+
 TEST_CASE("we can compute async multiexponentiations") {
   auto f = [](basct::cspan<c21t::element_p3> generators,
               basct::cspan<mtxb::exponent_sequence> exponents) noexcept {
@@ -50,3 +181,16 @@ TEST_CASE("we can compute async multiexponentiations") {
   std::mt19937 rng{893345};
   mtxtst::exercise_multiexponentiation_fn(rng, f);
 }
+
+TEST_CASE("we can compute async multiexponentiations with a given engine") {
+  std::mt19937 rng{893345};
+  for (auto engine : {engine_t::automatic, engine_t::naive, engine_t::pippenger, engine_t::bucket}) {
+    auto f = [&](basct::cspan<c21t::element_p3> generators,
+                 basct::cspan<mtxb::exponent_sequence> exponents) noexcept {
+      auto fut = async_compute_multiexponentiation<c21t::element_p3>(generators, exponents, engine);
+      xens::get_scheduler().run();
+      return memmg::managed_array<c21t::element_p3>{std::move(fut.value())};
+    };
+    mtxtst::exercise_multiexponentiation_fn(rng, f);
+  }
+}
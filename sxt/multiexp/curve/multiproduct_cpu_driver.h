@@ -22,6 +22,8 @@
 #include "sxt/base/container/span_void.h"
 #include "sxt/base/curve/element.h"
 #include "sxt/base/error/assert.h"
+#include "sxt/base/iterator/index_range.h"
+#include "sxt/execution/thread/parallel_for.h"
 #include "sxt/memory/management/managed_array.h"
 #include "sxt/multiexp/bitset_multiprod/multiproduct.h"
 #include "sxt/multiexp/bitset_multiprod/value_cache.h"
@@ -66,23 +68,42 @@ void multiproduct_cpu_driver<Element>::apply_partition_operation(
   basct::span<Element> inputs{static_cast<Element*>(inout.data()), num_inputs};
   memmg::managed_array<Element> inputs_p(num_inputs_p);
 
-  std::vector<Element> cache_data(mtxbmp::compute_cache_size(partition_size));
-  mtxbmp::value_cache<Element> cache;
-  multiproduct_bitset_operator<Element> op;
+  // group the markers into runs that share a partition
+  std::vector<size_t> run_firsts;
   uint64_t partition_index = static_cast<uint64_t>(-1);
   for (size_t marker_index = 0; marker_index < num_inputs_p; ++marker_index) {
-    auto marker = partition_markers[marker_index];
-    auto partition_index_p = marker >> partition_size;
-    size_t partition_first = partition_index_p * partition_size;
+    auto partition_index_p = partition_markers[marker_index] >> partition_size;
     if (partition_index_p != partition_index) {
       partition_index = partition_index_p;
-      cache = {cache_data.data(), std::min(partition_size, num_inputs - partition_first)};
-      mtxbmp::init_value_cache(
-          cache, op, basct::cspan<Element>{inputs.subspan(partition_first, cache.num_terms())});
+      run_firsts.push_back(marker_index);
     }
-    auto bitset = marker ^ (partition_index << partition_size);
-    mtxbmp::compute_multiproduct(inputs_p[marker_index], cache, op, bitset);
   }
+  run_firsts.push_back(num_inputs_p);
+
+  // the runs are independent, so each thread builds its own caches
+  auto num_runs = run_firsts.size() - 1;
+  xent::parallel_for(basit::index_range{0, num_runs}, [&](basit::index_range rng) noexcept {
+    std::vector<Element> cache_data(mtxbmp::compute_cache_size(partition_size));
+    multiproduct_bitset_operator<Element> op;
+    for (auto run_index = rng.a(); run_index < rng.b(); ++run_index) {
+      auto first = run_firsts[run_index];
+      auto last = run_firsts[run_index + 1];
+      auto run_partition_index = partition_markers[first] >> partition_size;
+      size_t partition_first = run_partition_index * partition_size;
+      mtxbmp::value_cache<Element> cache{
+          cache_data.data(), std::min(partition_size, num_inputs - partition_first)};
+      basct::cspan<Element> terms{inputs.subspan(partition_first, cache.num_terms())};
+      if (mtxbmp::prefer_filled_value_cache(cache.num_terms(), last - first)) {
+        mtxbmp::fill_value_cache(cache, op, terms);
+      } else {
+        mtxbmp::init_value_cache(cache, op, terms);
+      }
+      for (auto marker_index = first; marker_index < last; ++marker_index) {
+        auto bitset = partition_markers[marker_index] ^ (run_partition_index << partition_size);
+        mtxbmp::compute_multiproduct(inputs_p[marker_index], cache, op, bitset);
+      }
+    }
+  });
   std::copy_n(inputs_p.data(), inputs_p.size(), inputs.data());
 }
 
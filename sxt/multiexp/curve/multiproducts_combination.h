@@ -18,7 +18,6 @@
 
 #include <algorithm>
 #include <concepts>
-#include <tuple>
 
 #include "sxt/base/bit/span_op.h"
 #include "sxt/base/container/blob_array.h"
@@ -26,6 +25,8 @@
 #include "sxt/base/container/stack_array.h"
 #include "sxt/base/curve/element.h"
 #include "sxt/base/error/assert.h"
+#include "sxt/base/iterator/index_range.h"
+#include "sxt/execution/thread/parallel_for.h"
 #include "sxt/memory/management/managed_array.h"
 #include "sxt/memory/management/managed_array_fwd.h"
 #include "sxt/multiexp/base/exponent_sequence.h"
@@ -40,52 +41,6 @@ struct exponent_sequence;
 }
 
 namespace sxt::mtxcrv {
-//--------------------------------------------------------------------------------------------------
-// init_output_products
-//--------------------------------------------------------------------------------------------------
-template <bascrv::element Element>
-static std::tuple<basct::cspan<Element>, basct::cspan<uint8_t>>
-init_output_products(size_t& product_index, size_t& input_index, basct::span<Element> products,
-                     basct::blob_array& output_digit_or_all, bool is_signed) noexcept {
-  auto digit_or_all = output_digit_or_all[product_index++];
-  size_t digit_count_one = basbt::pop_count(digit_or_all);
-  if (!is_signed) {
-    auto output_products = products.subspan(input_index, digit_count_one);
-    input_index += digit_count_one;
-    return {output_products, digit_or_all};
-  }
-  SXT_STACK_ARRAY(pos_digit_or_all, digit_or_all.size(), uint8_t);
-  std::copy(digit_or_all.begin(), digit_or_all.end(), pos_digit_or_all.begin());
-  auto neg_digit_or_all = output_digit_or_all[product_index++];
-  basbt::or_equal(digit_or_all, neg_digit_or_all);
-  auto pos_digit_count_one = digit_count_one;
-  auto neg_digit_count_one = basbt::pop_count(neg_digit_or_all);
-  digit_count_one = basbt::pop_count(digit_or_all);
-  auto output_products = products.subspan(input_index, digit_count_one);
-  SXT_STACK_ARRAY(pos_products, pos_digit_count_one, Element);
-  std::copy_n(output_products.begin(), pos_digit_count_one, pos_products.begin());
-  auto neg_products = products.subspan(input_index + pos_digit_count_one, neg_digit_count_one);
-  for (auto& e : neg_products) {
-    neg(e, e);
-  }
-  size_t pos_index = 0;
-  size_t neg_index = 0;
-  size_t out_index = 0;
-  basbt::for_each_bit(digit_or_all, [&](size_t bit_index) noexcept {
-    auto is_pos_set = basbt::test_bit(pos_digit_or_all, bit_index);
-    auto is_neg_set = basbt::test_bit(neg_digit_or_all, bit_index);
-    if (is_pos_set && is_neg_set) {
-      add(output_products[out_index++], pos_products[pos_index++], neg_products[neg_index++]);
-    } else if (is_pos_set) {
-      output_products[out_index++] = pos_products[pos_index++];
-    } else {
-      output_products[out_index++] = neg_products[neg_index++];
-    }
-  });
-  input_index += pos_digit_count_one + neg_digit_count_one;
-  return {output_products, digit_or_all};
-}
-
 //--------------------------------------------------------------------------------------------------
 // fold_multiproducts
 //--------------------------------------------------------------------------------------------------
@@ -133,47 +88,38 @@ template <bascrv::element Element>
 void combine_multiproducts(basct::span<Element> outputs,
                            const basct::blob_array& output_digit_or_all,
                            basct::cspan<Element> products) noexcept {
+  auto num_outputs = output_digit_or_all.size();
+  memmg::managed_array<size_t> input_indexes(num_outputs);
   size_t input_index = 0;
-  for (size_t output_index = 0; output_index < output_digit_or_all.size(); ++output_index) {
-    auto digit_or_all = output_digit_or_all[output_index];
-    int digit_count_one = basbt::pop_count(digit_or_all);
-    if (digit_count_one == 0) {
-      outputs[output_index] = Element::identity();
-      continue;
-    }
-    Element output;
-    SXT_DEBUG_ASSERT(input_index + digit_count_one <= products.size());
-    doubling_reduce(
-        output, digit_or_all,
-        basct::cspan<Element>{&products[input_index], static_cast<size_t>(digit_count_one)});
-    input_index += digit_count_one;
-    outputs[output_index] = output;
+  for (size_t output_index = 0; output_index < num_outputs; ++output_index) {
+    input_indexes[output_index] = input_index;
+    input_index += basbt::pop_count(output_digit_or_all[output_index]);
   }
+  SXT_DEBUG_ASSERT(input_index <= products.size());
+  auto f = [&](basit::index_range rng) noexcept {
+    for (auto output_index = rng.a(); output_index < rng.b(); ++output_index) {
+      auto digit_or_all = output_digit_or_all[output_index];
+      size_t digit_count_one = basbt::pop_count(digit_or_all);
+      if (digit_count_one == 0) {
+        outputs[output_index] = Element::identity();
+        continue;
+      }
+      doubling_reduce(outputs[output_index], digit_or_all,
+                      products.subspan(input_indexes[output_index], digit_count_one));
+    }
+  };
+  xent::parallel_for(basit::index_range{0, num_outputs}, f);
 }
 
 template <bascrv::element Element>
 void combine_multiproducts(basct::span<Element> outputs, basct::blob_array& output_digit_or_all,
                            basct::span<Element> products,
                            basct::cspan<mtxb::exponent_sequence> exponents) noexcept {
-  auto num_sequences = exponents.size();
-  // clang-format off
-  SXT_DEBUG_ASSERT(
-      outputs.size() == num_sequences && 
-      exponents.size() == num_sequences
-  );
-  // clang-format on
-  size_t product_index = 0;
-  size_t input_index = 0;
-  for (size_t sequence_index = 0; sequence_index < exponents.size(); ++sequence_index) {
-    auto sequence = exponents[sequence_index];
-    auto [output_products, digit_or_all] =
-        init_output_products<Element>(product_index, input_index, products, output_digit_or_all,
-                                      static_cast<bool>(sequence.is_signed));
-    if (output_products.empty()) {
-      outputs[sequence_index] = Element::identity();
-      continue;
-    }
-    doubling_reduce(outputs[sequence_index], digit_or_all, output_products);
-  }
+  // signed sequences are decomposed by the magnitudes of their terms with negated inputs, so
+  // every sequence has a single set of multiproduct outputs
+  SXT_DEBUG_ASSERT(outputs.size() == exponents.size() &&
+                   output_digit_or_all.size() == exponents.size());
+  combine_multiproducts<Element>(outputs, output_digit_or_all,
+                                 basct::cspan<Element>{products.data(), products.size()});
 }
 } // namespace sxt::mtxcrv
@@ -22,6 +22,7 @@
 #include "sxt/multiexp/base/generator_utility.h"
 #include "sxt/multiexp/curve/multiproduct_solver.h"
 #include "sxt/multiexp/index/index_table.h"
+#include "sxt/multiexp/pippenger/negated_inputs.h"
 
 namespace sxt::mtxcrv {
 //--------------------------------------------------------------------------------------------------
@@ -35,13 +36,19 @@ public:
                                                     basct::cspan<Element> generators,
                                                     const basct::blob_array& masks,
                                                     size_t num_inputs) const noexcept override {
+    mtxpi::negated_inputs negated;
+    mtxpi::resolve_negated_inputs(negated, multiproduct_table.header(), num_inputs);
     memmg::managed_array<Element> inputs_data;
     basct::cspan<Element> inputs;
-    if (num_inputs == generators.size()) {
+    if (num_inputs == generators.size() && negated.empty()) {
       inputs = generators;
     } else {
-      inputs_data.resize(num_inputs);
-      mtxb::filter_generators<Element>(inputs_data, generators, masks);
+      inputs_data.resize(num_inputs + negated.copies.size());
+      mtxb::filter_generators<Element>(basct::span<Element>{inputs_data.data(), num_inputs},
+                                       generators, masks);
+      mtxpi::negate_inputs<Element>(
+          inputs_data, negated, num_inputs,
+          [](Element& r, const Element& x) noexcept { neg(r, x); });
       inputs = inputs_data;
     }
     memmg::managed_array<Element> res(multiproduct_table.num_rows());
@@ -0,0 +1,38 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/curve/pipelined_multiexponentiation.h"
+
+namespace sxt::mtxcrv {
+//--------------------------------------------------------------------------------------------------
+// slice_exponents
+//--------------------------------------------------------------------------------------------------
+void slice_exponents(basct::span<mtxb::exponent_sequence> res,
+                     basct::cspan<mtxb::exponent_sequence> exponents, size_t first,
+                     size_t size) noexcept {
+  SXT_DEBUG_ASSERT(res.size() == exponents.size());
+  for (size_t output_index = 0; output_index < exponents.size(); ++output_index) {
+    auto exponent = exponents[output_index];
+    if (first >= exponent.n) {
+      exponent.n = 0;
+    } else {
+      exponent.data += exponent.element_nbytes * first;
+      exponent.n = std::min(size, exponent.n - first);
+    }
+    res[output_index] = exponent;
+  }
+}
+} // namespace sxt::mtxcrv
@@ -0,0 +1,222 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "sxt/base/container/blob_array.h"
+#include "sxt/base/container/span.h"
+#include "sxt/base/curve/element.h"
+#include "sxt/base/error/assert.h"
+#include "sxt/execution/async/future.h"
+#include "sxt/execution/thread/bounded_queue.h"
+#include "sxt/memory/management/managed_array.h"
+#include "sxt/multiexp/base/exponent_sequence.h"
+#include "sxt/multiexp/base/packed_sequence.h"
+#include "sxt/multiexp/base/segmented_generators.h"
+#include "sxt/multiexp/curve/multiproduct_solver.h"
+#include "sxt/multiexp/curve/multiproducts_combination.h"
+#include "sxt/multiexp/pippenger/multiexponentiation.h"
+
+namespace sxt::mtxcrv {
+//--------------------------------------------------------------------------------------------------
+// pipelined_multiexponentiation_chunk_size_v
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of generators in a chunk of a pipelined multiexponentiation.
+ *
+ * Note: This is a ballpark value. Smaller chunks lower peak memory but give Pippenger's algorithm
+ * fewer terms to amortize over.
+ */
+constexpr size_t pipelined_multiexponentiation_chunk_size_v = 1ull << 16u;
+
+//--------------------------------------------------------------------------------------------------
+// slice_exponents
+//--------------------------------------------------------------------------------------------------
+/**
+ * Restrict each exponent sequence to the terms [first, first + size).
+ */
+void slice_exponents(basct::span<mtxb::exponent_sequence> res,
+                     basct::cspan<mtxb::exponent_sequence> exponents, size_t first,
+                     size_t size) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// compute_multiexponentiation_pipelined_impl
+//--------------------------------------------------------------------------------------------------
+/**
+ * Run the pipeline over n terms of num_outputs sequences. slice(res, first, size) writes the
+ * terms [first, first + size) of each sequence into res; the sliced sequences only need to stay
+ * valid until the decomposition thread has planned the chunk's multiproduct.
+ */
+template <bascrv::element Element, class F>
+memmg::managed_array<Element> compute_multiexponentiation_pipelined_impl(
+    const mtxb::segmented_generators<Element>& generators, size_t num_outputs, size_t n,
+    F slice, const multiproduct_solver<Element>& solver, size_t chunk_size) noexcept {
+  static constexpr size_t queue_capacity = 1;
+  SXT_DEBUG_ASSERT(generators.size() >= n && chunk_size > 0);
+  memmg::managed_array<Element> res(num_outputs);
+  std::fill(res.begin(), res.end(), Element::identity());
+  if (n == 0) {
+    return res;
+  }
+
+  struct decomposed_chunk {
+    std::vector<mtxb::exponent_sequence> exponents;
+    mtxpi::multiproduct_plan plan;
+    memmg::managed_array<Element> generators_data;
+    basct::cspan<Element> generators;
+  };
+  struct accumulated_chunk {
+    std::vector<mtxb::exponent_sequence> exponents;
+    basct::blob_array output_digit_or_all;
+    memmg::managed_array<Element> products;
+  };
+  xent::bounded_queue<decomposed_chunk> decomposed{queue_capacity};
+  xent::bounded_queue<accumulated_chunk> accumulated{queue_capacity};
+
+  // decompose
+  std::thread decomposition_thread{[&]() noexcept {
+    for (size_t first = 0; first < n; first += chunk_size) {
+      auto m = std::min(chunk_size, n - first);
+      decomposed_chunk chunk{
+          .exponents = std::vector<mtxb::exponent_sequence>(num_outputs),
+      };
+      slice(basct::span<mtxb::exponent_sequence>{chunk.exponents}, first, m);
+      mtxpi::plan_multiproduct(chunk.plan, chunk.exponents);
+      chunk.generators = generators.get(chunk.generators_data, first, m);
+      decomposed.push(std::move(chunk));
+    }
+    decomposed.close();
+  }};
+
+  // accumulate
+  std::thread accumulation_thread{[&]() noexcept {
+    while (auto chunk = decomposed.pop()) {
+      auto products = solver
+                          .solve(std::move(chunk->plan.table), chunk->generators,
+                                 chunk->plan.term_or_all, chunk->plan.num_inputs)
+                          .value();
+      accumulated.push(accumulated_chunk{
+          .exponents = std::move(chunk->exponents),
+          .output_digit_or_all = std::move(chunk->plan.output_digit_or_all),
+          .products = std::move(products),
+      });
+    }
+    accumulated.close();
+  }};
+
+  // combine
+  memmg::managed_array<Element> partial(num_outputs);
+  while (auto chunk = accumulated.pop()) {
+    combine_multiproducts<Element>(partial, chunk->output_digit_or_all, chunk->products,
+                                   chunk->exponents);
+    for (size_t output_index = 0; output_index < num_outputs; ++output_index) {
+      add_inplace(res[output_index], partial[output_index]);
+    }
+  }
+
+  decomposition_thread.join();
+  accumulation_thread.join();
+  return res;
+}
+
+//--------------------------------------------------------------------------------------------------
+// compute_multiexponentiation_pipelined
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute a multiexponentiation on the host as a pipeline over chunks of generators.
+ *
+ * A decomposition thread builds the multiproduct table of chunk k+1 while an accumulation thread
+ * solves the multiproduct of chunk k and the calling thread combines chunk k-1 into the outputs.
+ * The stages hand chunks over through bounded queues so at most a few chunks are in flight at
+ * once.
+ *
+ * Generators past the precomputed segment of a segmented sequence are computed by the
+ * decomposition thread, so computing the tail overlaps with accumulating earlier chunks and the
+ * precomputed generators are never copied.
+ *
+ * Note: The pipeline is opt-in. Its chunk size is a ballpark value and a single accumulation
+ * thread solves every chunk, so it hasn't been shown to beat the unchunked computation for
+ * generators that are already in memory. It's used where it bounds memory: for generators that
+ * are computed on demand and for bit-packed exponents.
+ */
+template <bascrv::element Element>
+memmg::managed_array<Element> compute_multiexponentiation_pipelined(
+    const mtxb::segmented_generators<Element>& generators,
+    basct::cspan<mtxb::exponent_sequence> exponents, const multiproduct_solver<Element>& solver,
+    size_t chunk_size = pipelined_multiexponentiation_chunk_size_v) noexcept {
+  size_t n = 0;
+  for (auto& exponent : exponents) {
+    n = std::max(n, static_cast<size_t>(exponent.n));
+  }
+  return compute_multiexponentiation_pipelined_impl<Element>(
+      generators, exponents.size(), n,
+      [&](basct::span<mtxb::exponent_sequence> res, size_t first, size_t size) noexcept {
+        slice_exponents(res, exponents, first, size);
+      },
+      solver, chunk_size);
+}
+
+/**
+ * Compute a multiexponentiation of bit-packed sequences.
+ *
+ * The decomposition thread unpacks each chunk's terms into a buffer it reuses right before
+ * building the chunk's multiproduct table, so the packed sequences are only read once at their
+ * packed width and no unpacked copy of them is ever materialized in full.
+ */
+template <bascrv::element Element>
+memmg::managed_array<Element> compute_multiexponentiation_pipelined(
+    const mtxb::segmented_generators<Element>& generators,
+    basct::cspan<mtxb::packed_sequence> exponents, const multiproduct_solver<Element>& solver,
+    size_t chunk_size = pipelined_multiexponentiation_chunk_size_v) noexcept {
+  size_t n = 0;
+  for (auto& exponent : exponents) {
+    n = std::max(n, static_cast<size_t>(exponent.n));
+  }
+  size_t chunk_num_bytes = 0;
+  for (auto& exponent : exponents) {
+    chunk_num_bytes +=
+        std::min(chunk_size, n) * mtxb::unpacked_element_nbytes(exponent.element_nbits);
+  }
+  memmg::managed_array<uint8_t> chunk_data(chunk_num_bytes);
+  return compute_multiexponentiation_pipelined_impl<Element>(
+      generators, exponents.size(), n,
+      [&](basct::span<mtxb::exponent_sequence> res, size_t first, size_t size) noexcept {
+        auto out = chunk_data.data();
+        for (size_t output_index = 0; output_index < exponents.size(); ++output_index) {
+          auto& exponent = exponents[output_index];
+          auto num_bytes = size * mtxb::unpacked_element_nbytes(exponent.element_nbits);
+          res[output_index] = mtxb::unpack_sequence({out, num_bytes}, exponent, first, size);
+          out += num_bytes;
+        }
+      },
+      solver, chunk_size);
+}
+
+template <bascrv::element Element>
+memmg::managed_array<Element> compute_multiexponentiation_pipelined(
+    basct::cspan<Element> generators, basct::cspan<mtxb::exponent_sequence> exponents,
+    const multiproduct_solver<Element>& solver,
+    size_t chunk_size = pipelined_multiexponentiation_chunk_size_v) noexcept {
+  return compute_multiexponentiation_pipelined<Element>(
+      mtxb::segmented_generators<Element>{generators}, exponents, solver, chunk_size);
+}
+} // namespace sxt::mtxcrv
@@ -0,0 +1,115 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/curve/pipelined_multiexponentiation.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "sxt/base/test/unit_test.h"
+#include "sxt/curve21/operation/add.h"
+#include "sxt/curve21/operation/double.h"
+#include "sxt/curve21/operation/neg.h"
+#include "sxt/curve21/type/element_p3.h"
+#include "sxt/memory/management/managed_array.h"
+#include "sxt/multiexp/base/packed_sequence.h"
+#include "sxt/multiexp/base/segmented_generators.h"
+#include "sxt/multiexp/curve/pippenger_multiproduct_solver.h"
+#include "sxt/multiexp/test/multiexponentiation.h"
+#include "sxt/ristretto/random/element.h"
+
+using namespace sxt;
+using namespace sxt::mtxcrv;
+
+TEST_CASE("we can slice exponent sequences") {
+  uint8_t data[6] = {};
+  std::vector<mtxb::exponent_sequence> exponents = {
+      {.element_nbytes = 2, .n = 3, .data = data},
+      {.element_nbytes = 1, .n = 1, .data = data},
+  };
+  std::vector<mtxb::exponent_sequence> res(2);
+  slice_exponents(res, exponents, 1, 10);
+  REQUIRE(res[0].n == 2);
+  REQUIRE(res[0].data == data + 2);
+  REQUIRE(res[0].element_nbytes == 2);
+  REQUIRE(res[1].n == 0);
+}
+
+TEST_CASE("we can compute multiexponentiations as a pipeline over chunks") {
+  pippenger_multiproduct_solver<c21t::element_p3> solver;
+  auto chunk_size = GENERATE(1u, 3u, 1024u);
+  auto f = [&](basct::cspan<c21t::element_p3> generators,
+               basct::cspan<mtxb::exponent_sequence> exponents) noexcept {
+    return compute_multiexponentiation_pipelined<c21t::element_p3>(generators, exponents, solver,
+                                                                   chunk_size);
+  };
+  std::mt19937 rng{9873324};
+  mtxtst::exercise_multiexponentiation_fn(rng, f);
+}
+
+TEST_CASE("we can compute pipelined multiexponentiations over segmented generators") {
+  pippenger_multiproduct_solver<c21t::element_p3> solver;
+  auto chunk_size = GENERATE(1u, 3u, 1024u);
+  auto f = [&](basct::cspan<c21t::element_p3> generators,
+               basct::cspan<mtxb::exponent_sequence> exponents) noexcept {
+    auto num_precomputed = generators.size() / 2;
+    mtxb::segmented_generators<c21t::element_p3> segments{
+        generators.subspan(0, num_precomputed), generators.size(),
+        [&](basct::span<c21t::element_p3> tail, size_t first) noexcept {
+          std::copy_n(generators.begin() + first, tail.size(), tail.begin());
+        }};
+    return compute_multiexponentiation_pipelined<c21t::element_p3>(segments, exponents, solver,
+                                                                   chunk_size);
+  };
+  std::mt19937 rng{9873324};
+  mtxtst::exercise_multiexponentiation_fn(rng, f);
+}
+
+TEST_CASE("we can compute pipelined multiexponentiations of bit-packed sequences") {
+  pippenger_multiproduct_solver<c21t::element_p3> solver;
+  std::mt19937 rng{9873324};
+  auto chunk_size = GENERATE(1u, 3u, 1024u);
+  std::vector<c21t::element_p3> generators(50);
+  rstrn::generate_random_elements(generators, rng);
+
+  std::vector<unsigned> element_nbits = {1, 7, 12, 20, 40, 129};
+  std::vector<std::vector<uint8_t>> packed_data;
+  std::vector<mtxb::packed_sequence> packed;
+  std::vector<std::vector<uint8_t>> unpacked_data;
+  std::vector<mtxb::exponent_sequence> unpacked;
+  for (size_t i = 0; i < element_nbits.size(); ++i) {
+    mtxb::packed_sequence seq{
+        .element_nbits = static_cast<uint16_t>(element_nbits[i]),
+        .n = generators.size() - i,
+    };
+    auto& data = packed_data.emplace_back(mtxb::packed_sequence_num_bytes(seq));
+    for (auto& byte : data) {
+      byte = static_cast<uint8_t>(rng());
+    }
+    seq.data = data.data();
+    packed.push_back(seq);
+    auto& buffer = unpacked_data.emplace_back(
+        seq.n * mtxb::unpacked_element_nbytes(seq.element_nbits));
+    unpacked.push_back(mtxb::unpack_sequence(buffer, seq, 0, seq.n));
+  }
+
+  auto res = compute_multiexponentiation_pipelined<c21t::element_p3>(
+      mtxb::segmented_generators<c21t::element_p3>{generators}, packed, solver, chunk_size);
+  auto expected =
+      compute_multiexponentiation_pipelined<c21t::element_p3>(generators, unpacked, solver);
+  REQUIRE(res == expected);
+}
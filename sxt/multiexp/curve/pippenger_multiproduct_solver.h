@@ -29,6 +29,7 @@
 #include "sxt/multiexp/curve/multiproduct_solver.h"
 #include "sxt/multiexp/index/index_table.h"
 #include "sxt/multiexp/index/reindex.h"
+#include "sxt/multiexp/pippenger/negated_inputs.h"
 #include "sxt/multiexp/pippenger_multiprod/active_offset.h"
 #include "sxt/multiexp/pippenger_multiprod/multiproduct.h"
 
@@ -49,12 +50,18 @@ public:
       SXT_DEBUG_ASSERT(row.size() > 2, "all outputs should have at least a single product");
       entry_count += row.size() - 2;
     }
-    SXT_DEBUG_ASSERT(entry_count >= num_inputs);
+    mtxpi::negated_inputs negated;
+    mtxpi::resolve_negated_inputs(negated, multiproduct_table.header(), num_inputs);
+    SXT_DEBUG_ASSERT(entry_count >= num_inputs + negated.copies.size());
     memmg::managed_array<Element> res(entry_count);
     mtxb::filter_generators<Element>(basct::span<Element>{res.data(), num_inputs}, generators,
                                      masks);
+    mtxpi::negate_inputs<Element>(
+        res, negated, num_inputs,
+        [](Element& r, const Element& x) noexcept { neg(r, x); });
     multiproduct_cpu_driver<Element> driver;
-    mtxpmp::compute_multiproduct(res, multiproduct_table.header(), driver, num_inputs);
+    mtxpmp::compute_multiproduct(res, multiproduct_table.header(), driver,
+                                 num_inputs + negated.copies.size());
     return xena::make_ready_future(std::move(res));
   };
 };
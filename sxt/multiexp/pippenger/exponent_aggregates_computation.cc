@@ -65,11 +65,7 @@ static void aggregate_signed_terms(exponent_aggregates& aggregates, size_t outpu
     std::memcpy(reinterpret_cast<uint8_t*>(&x), sequence.data + term_index * NumBytes, NumBytes);
     auto abs_x = basn::abs(x);
     basct::cspan<uint8_t> term{reinterpret_cast<uint8_t*>(&abs_x), NumBytes};
-    if (x == abs_x) {
-      aggegate_term(aggregates, term, output_index, term_index);
-    } else {
-      aggegate_term(aggregates, term, output_index + 1, term_index);
-    }
+    aggegate_term(aggregates, term, output_index, term_index);
   }
 }
 
@@ -80,18 +76,15 @@ void compute_exponent_aggregates(exponent_aggregates& aggregates,
                                  basct::cspan<mtxb::exponent_sequence> exponents) noexcept {
   size_t max_sequence_length = 0;
   uint8_t max_element_nbytes = 0;
-  size_t output_count = 0;
   for (auto& sequence : exponents) {
     max_sequence_length = std::max(max_sequence_length, sequence.n);
     max_element_nbytes = std::max(max_element_nbytes, sequence.element_nbytes);
-    output_count += 1 + sequence.is_signed;
   }
   aggregates.max_exponent.resize(max_element_nbytes);
   aggregates.term_or_all.resize(max_sequence_length, max_element_nbytes);
-  aggregates.output_or_all.resize(output_count, max_element_nbytes);
+  aggregates.output_or_all.resize(exponents.size(), max_element_nbytes);
   aggregates.pop_count = 0;
 
-  size_t output_index = 0;
   for (size_t sequence_index = 0; sequence_index < exponents.size(); ++sequence_index) {
     auto sequence = exponents[sequence_index];
     auto element_num_bytes = sequence.element_nbytes;
@@ -103,12 +96,11 @@ void compute_exponent_aggregates(exponent_aggregates& aggregates,
           basn::ceil_log2(element_num_bytes),
           [&]<unsigned NumBytesLg2>(std::integral_constant<unsigned, NumBytesLg2>) noexcept {
             static constexpr auto NumBytes = 1ull << NumBytesLg2;
-            aggregate_signed_terms<NumBytes>(aggregates, output_index, sequence);
+            aggregate_signed_terms<NumBytes>(aggregates, sequence_index, sequence);
           });
     } else {
-      aggregate_unsigned_terms(aggregates, output_index, sequence);
+      aggregate_unsigned_terms(aggregates, sequence_index, sequence);
     }
-    output_index += 1 + sequence.is_signed;
   }
 }
 } // namespace sxt::mtxpi
@@ -54,12 +54,10 @@ static void compute_output_digit_or_all(basct::blob_array& output_digit_or_all,
 }
 
 //--------------------------------------------------------------------------------------------------
-// compute_multiproduct
+// plan_multiproduct
 //--------------------------------------------------------------------------------------------------
-static xena::future<memmg::managed_array<void>>
-compute_multiproduct(basct::blob_array& output_digit_or_all, const driver& drv,
-                     basct::span_cvoid generators,
-                     basct::cspan<mtxb::exponent_sequence> exponents) noexcept {
+void plan_multiproduct(multiproduct_plan& plan,
+                       basct::cspan<mtxb::exponent_sequence> exponents) noexcept {
   exponent_aggregates aggregates;
   compute_exponent_aggregates(aggregates, exponents);
 
@@ -67,15 +65,26 @@ compute_multiproduct(basct::blob_array& output_digit_or_all, const driver& drv,
       aggregates.max_exponent.size() * 8 - basbt::count_leading_zeros(aggregates.max_exponent);
   radix_log2 = std::max(1lu, radix_log2);
 
-  compute_output_digit_or_all(output_digit_or_all, aggregates.output_or_all, radix_log2);
+  compute_output_digit_or_all(plan.output_digit_or_all, aggregates.output_or_all, radix_log2);
 
-  mtxi::index_table table;
-  auto num_multiproduct_inputs =
-      make_multiproduct_table(table, exponents, aggregates.pop_count, aggregates.term_or_all,
-                              output_digit_or_all, radix_log2);
+  plan.num_inputs =
+      make_multiproduct_table(plan.table, exponents, aggregates.pop_count, aggregates.term_or_all,
+                              plan.output_digit_or_all, radix_log2);
+  plan.term_or_all = std::move(aggregates.term_or_all);
+}
 
-  return drv.compute_multiproduct(std::move(table), generators, aggregates.term_or_all,
-                                  num_multiproduct_inputs);
+//--------------------------------------------------------------------------------------------------
+// compute_multiproduct
+//--------------------------------------------------------------------------------------------------
+static xena::future<memmg::managed_array<void>>
+compute_multiproduct(basct::blob_array& output_digit_or_all, const driver& drv,
+                     basct::span_cvoid generators,
+                     basct::cspan<mtxb::exponent_sequence> exponents) noexcept {
+  multiproduct_plan plan;
+  plan_multiproduct(plan, exponents);
+  output_digit_or_all = std::move(plan.output_digit_or_all);
+  return drv.compute_multiproduct(std::move(plan.table), generators, plan.term_or_all,
+                                  plan.num_inputs);
 }
 
 //--------------------------------------------------------------------------------------------------
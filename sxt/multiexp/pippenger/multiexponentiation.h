@@ -16,10 +16,14 @@
  */
 #pragma once
 
+#include <cstddef>
+
+#include "sxt/base/container/blob_array.h"
 #include "sxt/base/container/span.h"
 #include "sxt/base/container/span_void.h"
 #include "sxt/execution/async/future_fwd.h"
 #include "sxt/memory/management/managed_array_fwd.h"
+#include "sxt/multiexp/index/index_table.h"
 
 namespace sxt::mtxb {
 struct exponent_sequence;
@@ -28,6 +32,26 @@ struct exponent_sequence;
 namespace sxt::mtxpi {
 class driver;
 
+//--------------------------------------------------------------------------------------------------
+// multiproduct_plan
+//--------------------------------------------------------------------------------------------------
+/**
+ * The decomposition of a multiexponentiation into a multiproduct: the multiproduct table and the
+ * digits each output needs when the multiproduct's outputs are combined.
+ */
+struct multiproduct_plan {
+  mtxi::index_table table;
+  basct::blob_array term_or_all;
+  basct::blob_array output_digit_or_all;
+  size_t num_inputs = 0;
+};
+
+//--------------------------------------------------------------------------------------------------
+// plan_multiproduct
+//--------------------------------------------------------------------------------------------------
+void plan_multiproduct(multiproduct_plan& plan,
+                       basct::cspan<mtxb::exponent_sequence> exponents) noexcept;
+
 //--------------------------------------------------------------------------------------------------
 // compute_multiexponentiation
 //--------------------------------------------------------------------------------------------------
@@ -34,6 +34,7 @@
 #include "sxt/multiexp/base/digit_utility.h"
 #include "sxt/multiexp/base/exponent_sequence.h"
 #include "sxt/multiexp/index/index_table.h"
+#include "sxt/multiexp/pippenger/negated_inputs.h"
 
 namespace sxt::mtxpi {
 //--------------------------------------------------------------------------------------------------
@@ -105,20 +106,16 @@ static uint64_t* init_signed_multiproduct_output_rows(basct::span<basct::span<ui
                                                       size_t digit_num_bytes) noexcept {
   SXT_STACK_ARRAY(digit, digit_num_bytes, uint8_t);
   std::fill(row_counts.begin(), row_counts.end(), 0);
-  auto radix_log2 = row_counts.size() / 2u;
+  auto radix_log2 = row_counts.size();
   for (size_t term_index = 0; term_index < sequence.n; ++term_index) {
-    basct::cspan<uint8_t> e{sequence.data + term_index * sequence.element_nbytes,
-                            sequence.element_nbytes};
     bast::sized_int_t<NumBytes * 8> x;
-    std::copy(e.begin(), e.end(), reinterpret_cast<uint8_t*>(&x));
+    std::copy_n(sequence.data + term_index * NumBytes, NumBytes, reinterpret_cast<uint8_t*>(&x));
     auto abs_x = basn::abs(x);
-    e = {reinterpret_cast<uint8_t*>(&abs_x), NumBytes};
-    auto offset = static_cast<size_t>(abs_x != x) * radix_log2;
+    basct::cspan<uint8_t> e{reinterpret_cast<uint8_t*>(&abs_x), NumBytes};
     auto digit_last = mtxb::get_last_digit(e, radix_log2);
     for (size_t digit_index = 0; digit_index < digit_last; ++digit_index) {
       mtxb::extract_digit(digit, e, radix_log2, digit_index);
-      basbt::for_each_bit(digit,
-                          [&](size_t bit_index) noexcept { ++row_counts[offset + bit_index]; });
+      basbt::for_each_bit(digit, [&](size_t bit_index) noexcept { ++row_counts[bit_index]; });
     }
   }
   return init_multiproduct_output_rows_impl(rows, multiproduct_output_index, entry_data,
@@ -165,40 +162,41 @@ static size_t fill_from_sequence(uint64_t*& entry_data, basct::span<basct::span<
 //--------------------------------------------------------------------------------------------------
 // fill_from_signed_sequence
 //--------------------------------------------------------------------------------------------------
+/**
+ * Fill the rows of a signed sequence from the digits of the terms' magnitudes. Entries for
+ * negative terms are flagged with negated_input_bit_v.
+ */
 template <size_t NumBytes>
-static size_t fill_from_signed_sequence(
-    uint64_t*& entry_data, basct::span<basct::span<uint64_t>> rows,
-    size_t& multiproduct_output_index, const mtxb::exponent_sequence& sequence,
-    basct::cspan<uint8_t> pos_digit_or_all, basct::cspan<uint8_t> neg_digit_or_all,
-    const basct::blob_array& term_or_all, size_t radix_log2) noexcept {
+static size_t fill_from_signed_sequence(uint64_t*& entry_data,
+                                        basct::span<basct::span<uint64_t>> rows,
+                                        size_t& multiproduct_output_index,
+                                        const mtxb::exponent_sequence& sequence,
+                                        basct::cspan<uint8_t> digit_or_all,
+                                        const basct::blob_array& term_or_all,
+                                        size_t radix_log2) noexcept {
   auto digit_num_bytes = basn::divide_up(radix_log2, 8ul);
-  SXT_STACK_ARRAY(index_array, radix_log2 * 2u, size_t);
+  SXT_STACK_ARRAY(index_array, radix_log2, size_t);
   auto bit_index_first = multiproduct_output_index;
   entry_data = init_signed_multiproduct_output_rows<NumBytes>(
       rows, multiproduct_output_index, entry_data, index_array, sequence, digit_num_bytes);
-  auto pos_bit_index_last = make_digit_index_array(basct::subspan(index_array, 0, radix_log2),
-                                                   bit_index_first, pos_digit_or_all);
-  make_digit_index_array(basct::subspan(index_array, radix_log2), pos_bit_index_last,
-                         neg_digit_or_all);
+  make_digit_index_array(index_array, bit_index_first, digit_or_all);
   size_t input_first = 0;
   SXT_STACK_ARRAY(digit, digit_num_bytes, uint8_t);
   for (size_t term_index = 0; term_index < sequence.n; ++term_index) {
-    basct::cspan<uint8_t> e{sequence.data + term_index * sequence.element_nbytes,
-                            sequence.element_nbytes};
     bast::sized_int_t<NumBytes * 8> x;
-    std::copy(e.begin(), e.end(), reinterpret_cast<uint8_t*>(&x));
+    std::copy_n(sequence.data + term_index * NumBytes, NumBytes, reinterpret_cast<uint8_t*>(&x));
     auto abs_x = basn::abs(x);
-    e = {reinterpret_cast<uint8_t*>(&abs_x), NumBytes};
+    basct::cspan<uint8_t> e{reinterpret_cast<uint8_t*>(&abs_x), NumBytes};
     auto digit_last = mtxb::get_last_digit(e, radix_log2);
     size_t input_offset = 0;
-    auto bit_index_offset = static_cast<size_t>(x != abs_x) * radix_log2;
+    auto sign_flag = static_cast<uint64_t>(x != abs_x) * negated_input_bit_v;
     for (size_t digit_index = 0; digit_index < digit_last; ++digit_index) {
       mtxb::extract_digit(digit, e, radix_log2, digit_index);
       basbt::for_each_bit(digit, [&](size_t bit_index) noexcept {
-        auto& row = rows[index_array[bit_index + bit_index_offset]];
+        auto& row = rows[index_array[bit_index]];
         auto sz = row.size();
         row = {row.data(), row.size() + 1};
-        row[sz] = input_first + input_offset;
+        row[sz] = (input_first + input_offset) | sign_flag;
       });
       input_offset += static_cast<size_t>(
           !mtxb::is_digit_zero(term_or_all[term_index], radix_log2, digit_index));
@@ -232,7 +230,6 @@ size_t make_multiproduct_table(mtxi::index_table& table,
   size_t multiproduct_output_index = 0;
   size_t max_inputs = 0;
   size_t input_first;
-  size_t output_index = 0;
   for (size_t sequence_index = 0; sequence_index < exponents.size(); ++sequence_index) {
     auto sequence = exponents[sequence_index];
     auto element_num_bytes = sequence.element_nbytes;
@@ -246,14 +243,12 @@ size_t make_multiproduct_table(mtxi::index_table& table,
             static constexpr auto NumBytes = 1ull << NumBytesLg2;
             input_first = fill_from_signed_sequence<NumBytes>(
                 entry_data, rows, multiproduct_output_index, sequence,
-                output_digit_or_all[output_index], output_digit_or_all[output_index + 1],
-                term_or_all, radix_log2);
+                output_digit_or_all[sequence_index], term_or_all, radix_log2);
           });
-      output_index += 2;
     } else {
       input_first = fill_from_sequence(entry_data, rows, multiproduct_output_index, sequence,
-                                       output_digit_or_all[output_index], term_or_all, radix_log2);
-      ++output_index;
+                                       output_digit_or_all[sequence_index], term_or_all,
+                                       radix_log2);
     }
     max_inputs = std::max(input_first, max_inputs);
   }
@@ -23,6 +23,7 @@
 #include "sxt/multiexp/base/exponent_sequence.h"
 #include "sxt/multiexp/base/exponent_sequence_utility.h"
 #include "sxt/multiexp/index/index_table.h"
+#include "sxt/multiexp/pippenger/negated_inputs.h"
 
 using namespace sxt;
 using namespace sxt::mtxpi;
@@ -95,7 +96,7 @@ TEST_CASE("we can construct a table for the multiproduct computation") {
     std::vector<int8_t> exponents = {1};
     std::vector<mtxb::exponent_sequence> sequence = {mtxb::to_exponent_sequence(exponents)};
     term_or_all.resize(1, 8);
-    output_digit_or_all.resize(2, 8);
+    output_digit_or_all.resize(1, 8);
     term_or_all[0][0] = 1;
     output_digit_or_all[0][0] = 1;
     REQUIRE(1 ==
@@ -107,12 +108,12 @@ TEST_CASE("we can construct a table for the multiproduct computation") {
     std::vector<int8_t> exponents = {-1};
     std::vector<mtxb::exponent_sequence> sequence = {mtxb::to_exponent_sequence(exponents)};
     term_or_all.resize(1, 8);
-    output_digit_or_all.resize(2, 8);
+    output_digit_or_all.resize(1, 8);
     term_or_all[0][0] = 1;
-    output_digit_or_all[1][0] = 1;
+    output_digit_or_all[0][0] = 1;
     REQUIRE(1 ==
             make_multiproduct_table(table, sequence, 100, term_or_all, output_digit_or_all, 3));
-    REQUIRE(table == mtxi::index_table{{0, 0, 0}});
+    REQUIRE(table == mtxi::index_table{{0, 0, negated_input_bit_v}});
   }
 
   SECTION("we handle the case of two exponentiations of 1") {
@@ -134,12 +135,11 @@ TEST_CASE("we can construct a table for the multiproduct computation") {
     term_or_all.resize(2, 8);
     term_or_all[0][0] = 1;
     term_or_all[1][0] = 1;
-    output_digit_or_all.resize(2, 8);
+    output_digit_or_all.resize(1, 8);
     output_digit_or_all[0][0] = 1;
-    output_digit_or_all[1][0] = 1;
     REQUIRE(2 ==
             make_multiproduct_table(table, sequence, 100, term_or_all, output_digit_or_all, 3));
-    REQUIRE(table == mtxi::index_table{{0, 0, 0}, {1, 0, 1}});
+    REQUIRE(table == mtxi::index_table{{0, 0, 0, 1 | negated_input_bit_v}});
   }
 
   SECTION("we handle the case of a single exponentiation of 2") {
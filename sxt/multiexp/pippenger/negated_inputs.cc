@@ -0,0 +1,81 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/pippenger/negated_inputs.h"
+
+#include <algorithm>
+
+namespace sxt::mtxpi {
+//--------------------------------------------------------------------------------------------------
+// resolve_negated_inputs
+//--------------------------------------------------------------------------------------------------
+void resolve_negated_inputs(negated_inputs& negated, basct::span<basct::span<uint64_t>> rows,
+                            size_t num_inputs) noexcept {
+  negated.in_place.clear();
+  negated.copies.clear();
+  auto has_negated_entries = std::any_of(rows.begin(), rows.end(), [](auto row) noexcept {
+    return std::any_of(row.begin() + 2, row.end(), [](uint64_t entry) noexcept {
+      return (entry & negated_input_bit_v) != 0;
+    });
+  });
+  if (!has_negated_entries) {
+    return;
+  }
+
+  // record how each input is used: bit 0 if added as is, bit 1 if added negated
+  constexpr uint8_t positive_use = 1;
+  constexpr uint8_t negative_use = 2;
+  std::vector<uint8_t> uses(num_inputs);
+  for (auto row : rows) {
+    for (auto entry : row.subspan(2)) {
+      auto is_negated = (entry & negated_input_bit_v) != 0;
+      auto input_index = entry & ~negated_input_bit_v;
+      SXT_DEBUG_ASSERT(input_index < num_inputs);
+      uses[input_index] |= is_negated ? negative_use : positive_use;
+    }
+  }
+
+  // assign inputs for the negated values
+  std::vector<uint64_t> negated_indexes(num_inputs);
+  for (uint64_t input_index = 0; input_index < num_inputs; ++input_index) {
+    switch (uses[input_index]) {
+    case negative_use:
+      negated.in_place.push_back(input_index);
+      negated_indexes[input_index] = input_index;
+      break;
+    case positive_use | negative_use:
+      negated_indexes[input_index] = num_inputs + negated.copies.size();
+      negated.copies.push_back(input_index);
+      break;
+    }
+  }
+
+  // rewrite the entries, keeping each row's inputs sorted if a copy was referenced
+  for (auto row : rows) {
+    auto entries = row.subspan(2);
+    bool is_sorted = true;
+    for (auto& entry : entries) {
+      if ((entry & negated_input_bit_v) != 0) {
+        entry = negated_indexes[entry & ~negated_input_bit_v];
+        is_sorted = is_sorted && entry < num_inputs;
+      }
+    }
+    if (!is_sorted) {
+      std::sort(entries.begin(), entries.end());
+    }
+  }
+}
+} // namespace sxt::mtxpi
@@ -0,0 +1,86 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "sxt/base/container/span.h"
+#include "sxt/base/error/assert.h"
+
+namespace sxt::mtxpi {
+//--------------------------------------------------------------------------------------------------
+// negated_input_bit_v
+//--------------------------------------------------------------------------------------------------
+/**
+ * Flags a multiproduct table entry that adds the negation of its input.
+ *
+ * Signed sequences are decomposed into the digits of the terms' magnitudes, so a negative term
+ * contributes the same entries as a positive one with the flag set. This keeps a signed sequence
+ * at one set of multiproduct outputs instead of one for each sign.
+ */
+constexpr uint64_t negated_input_bit_v = 1ull << 63u;
+
+//--------------------------------------------------------------------------------------------------
+// negated_inputs
+//--------------------------------------------------------------------------------------------------
+/**
+ * The inputs a multiproduct needs negated.
+ *
+ * Inputs only ever added negated are negated in place. Inputs added with both signs keep their
+ * value, and a negated copy is appended after the inputs.
+ */
+struct negated_inputs {
+  std::vector<uint64_t> in_place;
+  std::vector<uint64_t> copies;
+
+  bool empty() const noexcept { return in_place.empty() && copies.empty(); }
+};
+
+//--------------------------------------------------------------------------------------------------
+// resolve_negated_inputs
+//--------------------------------------------------------------------------------------------------
+/**
+ * Rewrite the entries of a multiproduct table flagged with negated_input_bit_v to refer to
+ * inputs holding the negated values, and record which inputs need to be negated.
+ *
+ * The rows follow the multiproduct table layout: two header values followed by the entries in
+ * ascending order, which is preserved.
+ */
+void resolve_negated_inputs(negated_inputs& negated, basct::span<basct::span<uint64_t>> rows,
+                            size_t num_inputs) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// negate_inputs
+//--------------------------------------------------------------------------------------------------
+/**
+ * Apply the negations recorded by resolve_negated_inputs to the first num_inputs inputs. The
+ * negated copies are written to inputs[num_inputs, num_inputs + negated.copies.size()).
+ */
+template <class T, class F>
+void negate_inputs(basct::span<T> inputs, const negated_inputs& negated, size_t num_inputs,
+                   F negate) noexcept {
+  SXT_DEBUG_ASSERT(inputs.size() >= num_inputs + negated.copies.size());
+  for (auto input_index : negated.in_place) {
+    negate(inputs[input_index], inputs[input_index]);
+  }
+  for (size_t copy_index = 0; copy_index < negated.copies.size(); ++copy_index) {
+    negate(inputs[num_inputs + copy_index], inputs[negated.copies[copy_index]]);
+  }
+}
+} // namespace sxt::mtxpi
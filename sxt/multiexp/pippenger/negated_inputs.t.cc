@@ -0,0 +1,70 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/pippenger/negated_inputs.h"
+
+#include <vector>
+
+#include "sxt/base/test/unit_test.h"
+#include "sxt/multiexp/index/index_table.h"
+
+using namespace sxt;
+using namespace sxt::mtxpi;
+
+TEST_CASE("we can resolve negated multiproduct inputs") {
+  negated_inputs negated;
+  constexpr auto neg = negated_input_bit_v;
+
+  SECTION("we leave a table without negated entries unchanged") {
+    mtxi::index_table table{{0, 0, 0, 1}, {1, 0, 1}};
+    auto expected = table;
+    resolve_negated_inputs(negated, table.header(), 2);
+    REQUIRE(negated.empty());
+    REQUIRE(table == expected);
+  }
+
+  SECTION("we negate inputs in place if they're only added negated") {
+    mtxi::index_table table{{0, 0, 0, 1 | neg}, {1, 0, 1 | neg}};
+    resolve_negated_inputs(negated, table.header(), 2);
+    REQUIRE(negated.in_place == std::vector<uint64_t>{1});
+    REQUIRE(negated.copies.empty());
+    REQUIRE(table == mtxi::index_table{{0, 0, 0, 1}, {1, 0, 1}});
+  }
+
+  SECTION("we append negated copies of inputs added with both signs") {
+    mtxi::index_table table{{0, 0, 0, 1 | neg}, {1, 0, 1, 0 | neg}, {2, 0, 2}};
+    resolve_negated_inputs(negated, table.header(), 3);
+    REQUIRE(negated.in_place.empty());
+    REQUIRE(negated.copies == std::vector<uint64_t>{0, 1});
+    REQUIRE(table == mtxi::index_table{{0, 0, 0, 4}, {1, 0, 1, 3}, {2, 0, 2}});
+  }
+
+  SECTION("we keep the entries of a row sorted") {
+    mtxi::index_table table{{0, 0, 0 | neg, 1}, {1, 0, 0}};
+    resolve_negated_inputs(negated, table.header(), 2);
+    REQUIRE(negated.copies == std::vector<uint64_t>{0});
+    REQUIRE(table == mtxi::index_table{{0, 0, 1, 2}, {1, 0, 0}});
+  }
+
+  SECTION("we can apply the negations to inputs") {
+    negated.in_place = {2};
+    negated.copies = {0};
+    std::vector<int> inputs = {1, 2, 3, 0};
+    negate_inputs(basct::span<int>{inputs}, negated, 3,
+                  [](int& res, const int& x) noexcept { res = -x; });
+    REQUIRE(inputs == std::vector<int>{1, 2, -3, -1});
+  }
+}
@@ -26,6 +26,7 @@
 #include "sxt/multiexp/base/exponent_sequence.h"
 #include "sxt/multiexp/base/generator_utility.h"
 #include "sxt/multiexp/index/index_table.h"
+#include "sxt/multiexp/pippenger/negated_inputs.h"
 
 namespace sxt::mtxpi {
 //--------------------------------------------------------------------------------------------------
@@ -39,11 +40,16 @@ test_driver::compute_multiproduct(mtxi::index_table&& multiproduct_table,
   basct::cspan<uint64_t> inputs;
   auto generators_p =
       basct::cspan<uint64_t>{static_cast<const uint64_t*>(generators.data()), generators.size()};
-  if (num_inputs == generators.size()) {
+  negated_inputs negated;
+  resolve_negated_inputs(negated, multiproduct_table.header(), num_inputs);
+  if (num_inputs == generators.size() && negated.empty()) {
     inputs = generators_p;
   } else {
-    inputs_data.resize(num_inputs);
-    mtxb::filter_generators<uint64_t>(inputs_data, generators_p, masks);
+    inputs_data.resize(num_inputs + negated.copies.size());
+    mtxb::filter_generators<uint64_t>(basct::span<uint64_t>{inputs_data.data(), num_inputs},
+                                      generators_p, masks);
+    negate_inputs<uint64_t>(inputs_data, negated, num_inputs,
+                            [](uint64_t& r, uint64_t x) noexcept { r = -x; });
     inputs = inputs_data;
   }
   memmg::managed_array<uint64_t> outputs(multiproduct_table.num_rows());
@@ -73,22 +79,13 @@ xena::future<memmg::managed_array<void>> test_driver::combine_multiproduct_outpu
                                 multiproduct_array.size()};
   memmg::managed_array<uint64_t> outputs(exponents.size());
   size_t input_index = 0;
-  size_t multiproduct_index = 0;
   for (size_t sequence_index = 0; sequence_index < exponents.size(); ++sequence_index) {
-    auto& sequence = exponents[sequence_index];
     auto& output = outputs[sequence_index];
     output = 0;
-    basbt::for_each_bit(output_digit_or_all[multiproduct_index++], [&](size_t pos) noexcept {
+    basbt::for_each_bit(output_digit_or_all[sequence_index], [&](size_t pos) noexcept {
       SXT_DEBUG_ASSERT(input_index < inputs.size());
       output += (1ull << pos) * inputs[input_index++];
     });
-    if (!sequence.is_signed) {
-      continue;
-    }
-    basbt::for_each_bit(output_digit_or_all[multiproduct_index++], [&](size_t pos) noexcept {
-      SXT_DEBUG_ASSERT(input_index < inputs.size());
-      output -= (1ull << pos) * inputs[input_index++];
-    });
   }
   return xena::make_ready_future(std::move(static_cast<memmg::managed_array<void>&>(outputs)));
 }
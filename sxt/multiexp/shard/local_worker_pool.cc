@@ -0,0 +1,82 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/shard/local_worker_pool.h"
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+
+#include "sxt/base/error/assert.h"
+#include "sxt/base/error/panic.h"
+
+namespace sxt::mtxsh {
+//--------------------------------------------------------------------------------------------------
+// constructor
+//--------------------------------------------------------------------------------------------------
+local_worker_pool::local_worker_pool(size_t num_workers,
+                                     basf::function_ref<void(transport&)> serve) noexcept {
+  SXT_RELEASE_ASSERT(num_workers > 0);
+  transports_.reserve(num_workers);
+  pids_.reserve(num_workers);
+  for (size_t worker_index = 0; worker_index < num_workers; ++worker_index) {
+    auto [coordinator_end, worker_end] = make_socket_transport_pair();
+    auto pid = ::fork();
+    if (pid < 0) {
+      baser::panic("fork failed: {}", std::strerror(errno));
+    }
+    if (pid == 0) {
+      // the child only keeps its own end of the connection open so that the worker sees the
+      // coordinator go away
+      for (auto& t : transports_) {
+        t.close();
+      }
+      coordinator_end.close();
+      serve(worker_end);
+      worker_end.close();
+      ::_exit(0);
+    }
+    worker_end.close();
+    transports_.emplace_back(std::move(coordinator_end));
+    pids_.push_back(pid);
+  }
+  workers_.reserve(num_workers);
+  for (auto& t : transports_) {
+    workers_.push_back(&t);
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// destructor
+//--------------------------------------------------------------------------------------------------
+local_worker_pool::~local_worker_pool() noexcept {
+  // a worker treats the coordinator closing the connection as a shutdown
+  for (auto& t : transports_) {
+    t.close();
+  }
+  for (auto pid : pids_) {
+    int status;
+    while (::waitpid(pid, &status, 0) < 0) {
+      if (errno != EINTR) {
+        baser::panic("waitpid failed: {}", std::strerror(errno));
+      }
+    }
+    SXT_RELEASE_ASSERT(WIFEXITED(status) && WEXITSTATUS(status) == 0, "shard worker failed");
+  }
+}
+} // namespace sxt::mtxsh
@@ -0,0 +1,58 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <sys/types.h>
+#include <vector>
+
+#include "sxt/base/container/span.h"
+#include "sxt/base/functional/function_ref.h"
+#include "sxt/multiexp/shard/socket_transport.h"
+
+namespace sxt::mtxsh {
+class transport;
+
+//--------------------------------------------------------------------------------------------------
+// local_worker_pool
+//--------------------------------------------------------------------------------------------------
+/**
+ * Fork worker processes on this host, each connected to the coordinator with a unix domain
+ * socket.
+ *
+ * Every child runs serve on its end of the connection and exits when serve returns. Destroying
+ * the pool shuts down the workers and waits for them to exit.
+ */
+class local_worker_pool {
+public:
+  local_worker_pool(size_t num_workers, basf::function_ref<void(transport&)> serve) noexcept;
+
+  local_worker_pool(const local_worker_pool&) = delete;
+  local_worker_pool& operator=(const local_worker_pool&) = delete;
+
+  ~local_worker_pool() noexcept;
+
+  size_t size() const noexcept { return workers_.size(); }
+
+  basct::cspan<transport*> workers() const noexcept { return workers_; }
+
+private:
+  std::vector<socket_transport> transports_;
+  std::vector<transport*> workers_;
+  std::vector<pid_t> pids_;
+};
+} // namespace sxt::mtxsh
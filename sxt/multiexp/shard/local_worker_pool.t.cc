@@ -0,0 +1,58 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/shard/local_worker_pool.h"
+
+#include <vector>
+
+#include "sxt/base/test/unit_test.h"
+#include "sxt/multiexp/shard/transport.h"
+
+using namespace sxt;
+using namespace sxt::mtxsh;
+
+TEST_CASE("we can run workers in child processes") {
+  auto echo = [](transport& t) noexcept {
+    std::vector<uint8_t> data(1);
+    while (t.receive(data)) {
+      ++data[0];
+      t.send(data);
+    }
+  };
+
+  SECTION("we can communicate with a single worker") {
+    local_worker_pool pool{1, echo};
+    REQUIRE(pool.size() == 1);
+    std::vector<uint8_t> data = {3};
+    pool.workers()[0]->send(data);
+    REQUIRE(pool.workers()[0]->receive(data));
+    REQUIRE(data[0] == 4);
+  }
+
+  SECTION("every worker has its own connection") {
+    local_worker_pool pool{3, echo};
+    REQUIRE(pool.size() == 3);
+    for (uint8_t i = 0; i < 3; ++i) {
+      std::vector<uint8_t> data = {i};
+      pool.workers()[i]->send(data);
+    }
+    for (uint8_t i = 0; i < 3; ++i) {
+      std::vector<uint8_t> data(1);
+      REQUIRE(pool.workers()[i]->receive(data));
+      REQUIRE(data[0] == i + 1);
+    }
+  }
+}
@@ -0,0 +1,67 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#include "sxt/base/container/span.h"
+#include "sxt/base/curve/element.h"
+#include "sxt/base/error/assert.h"
+#include "sxt/memory/management/managed_array.h"
+#include "sxt/multiexp/base/exponent_sequence.h"
+#include "sxt/multiexp/shard/shard_plan.h"
+#include "sxt/multiexp/shard/shard_protocol.h"
+#include "sxt/multiexp/shard/transport.h"
+
+namespace sxt::mtxsh {
+//--------------------------------------------------------------------------------------------------
+// compute_multiexponentiation
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute a multiexponentiation by splitting the generators into one shard per worker.
+ *
+ * Jobs are sent to every worker before any result is read so that the workers compute their
+ * shards concurrently. Each worker returns an uncompressed partial product per output and the
+ * partials are summed here.
+ */
+template <bascrv::element Element>
+memmg::managed_array<Element>
+compute_multiexponentiation(basct::cspan<transport*> workers, basct::cspan<Element> generators,
+                            basct::cspan<mtxb::exponent_sequence> exponents,
+                            size_t min_shard_size = 1) noexcept {
+  static_assert(std::is_trivially_copyable_v<Element>);
+  SXT_RELEASE_ASSERT(!workers.empty());
+  auto num_outputs = exponents.size();
+  memmg::managed_array<Element> res(num_outputs);
+  for (auto& e : res) {
+    e = Element::identity();
+  }
+  auto shards = plan_shards(exponents, workers.size(), min_shard_size);
+  for (size_t shard_index = 0; shard_index < shards.size(); ++shard_index) {
+    send_shard_job(*workers[shard_index], generators, exponents, shards[shard_index]);
+  }
+  memmg::managed_array<Element> partials(num_outputs);
+  for (size_t shard_index = 0; shard_index < shards.size(); ++shard_index) {
+    receive_shard_result(basct::span<Element>{partials}, *workers[shard_index]);
+    for (size_t output_index = 0; output_index < num_outputs; ++output_index) {
+      add_inplace(res[output_index], partials[output_index]);
+    }
+  }
+  return res;
+}
+} // namespace sxt::mtxsh
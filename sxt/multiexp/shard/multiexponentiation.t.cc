@@ -0,0 +1,108 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/shard/multiexponentiation.h"
+
+#include <random>
+#include <vector>
+
+#include "sxt/base/test/unit_test.h"
+#include "sxt/curve21/operation/add.h"
+#include "sxt/curve21/operation/double.h"
+#include "sxt/curve21/operation/neg.h"
+#include "sxt/curve21/operation/overload.h"
+#include "sxt/curve21/type/element_p3.h"
+#include "sxt/curve21/type/literal.h"
+#include "sxt/execution/async/future.h"
+#include "sxt/multiexp/curve/multiexponentiation_cpu_driver.h"
+#include "sxt/multiexp/curve/pippenger_multiproduct_solver.h"
+#include "sxt/multiexp/pippenger/multiexponentiation.h"
+#include "sxt/multiexp/shard/local_worker_pool.h"
+#include "sxt/multiexp/shard/worker.h"
+#include "sxt/multiexp/test/multiexponentiation.h"
+#include "sxt/ristretto/random/element.h"
+
+using namespace sxt;
+using namespace sxt::mtxsh;
+using c21t::operator""_c21;
+
+TEST_CASE("we can compute multiexponentiations with sharded workers") {
+  auto cpu_multiexponentiate = [](basct::cspan<c21t::element_p3> generators,
+                                  basct::cspan<mtxb::exponent_sequence> exponents) noexcept {
+    mtxcrv::pippenger_multiproduct_solver<c21t::element_p3> solver;
+    mtxcrv::multiexponentiation_cpu_driver<c21t::element_p3> drv{&solver};
+    return mtxpi::compute_multiexponentiation(drv, generators, exponents)
+        .value()
+        .as_array<c21t::element_p3>();
+  };
+  auto serve = [&](transport& t) noexcept {
+    serve_shards<c21t::element_p3>(t, cpu_multiexponentiate);
+  };
+  std::mt19937 rng{9873324};
+
+  SECTION("we handle the basic test cases") {
+    local_worker_pool pool{3, serve};
+    auto f = [&](basct::cspan<c21t::element_p3> generators,
+                 basct::cspan<mtxb::exponent_sequence> exponents) noexcept {
+      return compute_multiexponentiation<c21t::element_p3>(pool.workers(), generators, exponents);
+    };
+    mtxtst::exercise_multiexponentiation_fn(rng, f);
+  }
+
+  SECTION("we get the same result as an unsharded computation") {
+    local_worker_pool pool{4, serve};
+    std::vector<c21t::element_p3> generators(100);
+    rstrn::generate_random_elements(generators, rng);
+    std::vector<uint8_t> exponents1(100);
+    std::vector<uint16_t> exponents2(37);
+    for (auto& x : exponents1) {
+      x = static_cast<uint8_t>(rng());
+    }
+    for (auto& x : exponents2) {
+      x = static_cast<uint16_t>(rng());
+    }
+    std::vector<mtxb::exponent_sequence> exponents = {
+        {.element_nbytes = 1, .n = exponents1.size(), .data = exponents1.data()},
+        {.element_nbytes = 2,
+         .n = exponents2.size(),
+         .data = reinterpret_cast<const uint8_t*>(exponents2.data())},
+    };
+    auto expected = cpu_multiexponentiate(generators, exponents);
+    auto res =
+        compute_multiexponentiation<c21t::element_p3>(pool.workers(), generators, exponents);
+    REQUIRE(res.size() == 2);
+    REQUIRE(res[0] == expected[0]);
+    REQUIRE(res[1] == expected[1]);
+
+    res = compute_multiexponentiation<c21t::element_p3>(pool.workers(), generators, exponents,
+                                                        64);
+    REQUIRE(res[0] == expected[0]);
+    REQUIRE(res[1] == expected[1]);
+  }
+
+  SECTION("we handle more workers than generators") {
+    local_worker_pool pool{4, serve};
+    std::vector<c21t::element_p3> generators = {0x123_c21};
+    std::vector<uint8_t> exponents1 = {2};
+    std::vector<mtxb::exponent_sequence> exponents = {
+        {.element_nbytes = 1, .n = 1, .data = exponents1.data()},
+    };
+    auto res =
+        compute_multiexponentiation<c21t::element_p3>(pool.workers(), generators, exponents);
+    REQUIRE(res.size() == 1);
+    REQUIRE(res[0] == 0x123_c21 + 0x123_c21);
+  }
+}
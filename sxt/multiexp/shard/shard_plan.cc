@@ -0,0 +1,50 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/shard/shard_plan.h"
+
+#include <algorithm>
+
+#include "sxt/base/error/assert.h"
+#include "sxt/base/iterator/index_range_iterator.h"
+#include "sxt/base/iterator/index_range_utility.h"
+#include "sxt/multiexp/base/exponent_sequence.h"
+
+namespace sxt::mtxsh {
+//--------------------------------------------------------------------------------------------------
+// plan_shards
+//--------------------------------------------------------------------------------------------------
+std::vector<basit::index_range> plan_shards(basct::cspan<mtxb::exponent_sequence> exponents,
+                                            size_t max_num_shards,
+                                            size_t min_shard_size) noexcept {
+  SXT_RELEASE_ASSERT(max_num_shards > 0 && min_shard_size > 0);
+  size_t n = 0;
+  for (auto& seq : exponents) {
+    n = std::max(n, seq.n);
+  }
+  std::vector<basit::index_range> res;
+  if (n == 0) {
+    return res;
+  }
+  auto [first, last] =
+      basit::split(basit::index_range{0, n}.min_chunk_size(min_shard_size), max_num_shards);
+  res.reserve(std::distance(first, last));
+  for (auto it = first; it != last; ++it) {
+    res.push_back(*it);
+  }
+  return res;
+}
+} // namespace sxt::mtxsh
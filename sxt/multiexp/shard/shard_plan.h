@@ -0,0 +1,43 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "sxt/base/container/span.h"
+#include "sxt/base/iterator/index_range.h"
+
+namespace sxt::mtxb {
+struct exponent_sequence;
+}
+
+namespace sxt::mtxsh {
+//--------------------------------------------------------------------------------------------------
+// plan_shards
+//--------------------------------------------------------------------------------------------------
+/**
+ * Split the generator range of a multiexponentiation into at most max_num_shards contiguous
+ * ranges of at least min_shard_size generators each.
+ *
+ * Every shard computes a partial multiexponentiation for all of the outputs over its range of
+ * generators; the partials for an output sum to the full result.
+ */
+std::vector<basit::index_range> plan_shards(basct::cspan<mtxb::exponent_sequence> exponents,
+                                            size_t max_num_shards,
+                                            size_t min_shard_size = 1) noexcept;
+} // namespace sxt::mtxsh
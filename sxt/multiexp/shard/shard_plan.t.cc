@@ -0,0 +1,55 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/shard/shard_plan.h"
+
+#include <vector>
+
+#include "sxt/base/test/unit_test.h"
+#include "sxt/multiexp/base/exponent_sequence.h"
+
+using namespace sxt;
+using namespace sxt::mtxsh;
+
+TEST_CASE("we can plan the shards of a multiexponentiation") {
+  std::vector<mtxb::exponent_sequence> exponents(2);
+
+  SECTION("we get no shards if there are no generators") {
+    REQUIRE(plan_shards(exponents, 4).empty());
+  }
+
+  SECTION("shards cover the longest sequence") {
+    exponents[0].n = 3;
+    exponents[1].n = 10;
+    auto shards = plan_shards(exponents, 3);
+    std::vector<basit::index_range> expected = {{0, 4}, {4, 8}, {8, 10}};
+    REQUIRE(shards == expected);
+  }
+
+  SECTION("we don't make more shards than there are generators") {
+    exponents[0].n = 2;
+    auto shards = plan_shards(exponents, 4);
+    std::vector<basit::index_range> expected = {{0, 1}, {1, 2}};
+    REQUIRE(shards == expected);
+  }
+
+  SECTION("we respect the minimum shard size") {
+    exponents[0].n = 10;
+    auto shards = plan_shards(exponents, 4, 6);
+    std::vector<basit::index_range> expected = {{0, 6}, {6, 10}};
+    REQUIRE(shards == expected);
+  }
+}
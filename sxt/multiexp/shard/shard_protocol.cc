@@ -0,0 +1,173 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/shard/shard_protocol.h"
+
+#include <algorithm>
+
+#include "sxt/base/error/assert.h"
+#include "sxt/base/error/panic.h"
+#include "sxt/base/iterator/index_range.h"
+#include "sxt/multiexp/shard/transport.h"
+
+namespace sxt::mtxsh {
+//--------------------------------------------------------------------------------------------------
+// shard_command
+//--------------------------------------------------------------------------------------------------
+namespace {
+enum class shard_command : uint64_t {
+  shutdown = 0,
+  compute = 1,
+};
+} // namespace
+
+//--------------------------------------------------------------------------------------------------
+// send_value
+//--------------------------------------------------------------------------------------------------
+static void send_value(transport& t, uint64_t x) noexcept {
+  t.send(basct::cspan<uint8_t>{reinterpret_cast<const uint8_t*>(&x), sizeof(x)});
+}
+
+//--------------------------------------------------------------------------------------------------
+// receive_value
+//--------------------------------------------------------------------------------------------------
+static uint64_t receive_value(transport& t) noexcept {
+  uint64_t res;
+  if (!t.receive(basct::span<uint8_t>{reinterpret_cast<uint8_t*>(&res), sizeof(res)})) {
+    baser::panic("channel closed in the middle of a shard job");
+  }
+  return res;
+}
+
+//--------------------------------------------------------------------------------------------------
+// receive_bytes
+//--------------------------------------------------------------------------------------------------
+static void receive_bytes(transport& t, basct::span<uint8_t> data) noexcept {
+  if (data.empty()) {
+    return;
+  }
+  if (!t.receive(data)) {
+    baser::panic("channel closed in the middle of a shard job");
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// send_shard_job
+//--------------------------------------------------------------------------------------------------
+void send_shard_job(transport& t, basct::span_cvoid generators,
+                    basct::cspan<mtxb::exponent_sequence> exponents,
+                    const basit::index_range& rng) noexcept {
+  SXT_RELEASE_ASSERT(rng.b() <= generators.size());
+  auto element_num_bytes = generators.element_size();
+  send_value(t, static_cast<uint64_t>(shard_command::compute));
+  send_value(t, element_num_bytes);
+  send_value(t, rng.size());
+  send_value(t, exponents.size());
+  for (auto& seq : exponents) {
+    auto n = std::min(seq.n, rng.b()) - std::min(seq.n, rng.a());
+    send_value(t, seq.element_nbytes);
+    send_value(t, n);
+    send_value(t, static_cast<uint64_t>(seq.is_signed));
+  }
+  t.send(basct::cspan<uint8_t>{
+      static_cast<const uint8_t*>(generators.data()) + element_num_bytes * rng.a(),
+      element_num_bytes * rng.size(),
+  });
+  for (auto& seq : exponents) {
+    auto a = std::min(seq.n, rng.a());
+    auto b = std::min(seq.n, rng.b());
+    t.send(basct::cspan<uint8_t>{
+        seq.data + a * seq.element_nbytes,
+        (b - a) * seq.element_nbytes,
+    });
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// send_shard_shutdown
+//--------------------------------------------------------------------------------------------------
+void send_shard_shutdown(transport& t) noexcept {
+  send_value(t, static_cast<uint64_t>(shard_command::shutdown));
+}
+
+//--------------------------------------------------------------------------------------------------
+// receive_shard_job
+//--------------------------------------------------------------------------------------------------
+bool receive_shard_job(shard_job& job, transport& t) noexcept {
+  uint64_t command;
+  if (!t.receive(basct::span<uint8_t>{reinterpret_cast<uint8_t*>(&command), sizeof(command)})) {
+    return false;
+  }
+  if (static_cast<shard_command>(command) == shard_command::shutdown) {
+    return false;
+  }
+  SXT_RELEASE_ASSERT(static_cast<shard_command>(command) == shard_command::compute);
+  job.element_num_bytes = receive_value(t);
+  auto num_generators = receive_value(t);
+  auto num_outputs = receive_value(t);
+
+  // header
+  job.exponents.resize(num_outputs);
+  size_t num_exponent_bytes = 0;
+  for (auto& seq : job.exponents) {
+    seq.element_nbytes = static_cast<uint8_t>(receive_value(t));
+    seq.n = receive_value(t);
+    seq.is_signed = static_cast<int>(receive_value(t));
+    SXT_RELEASE_ASSERT(seq.n <= num_generators);
+    num_exponent_bytes += seq.n * seq.element_nbytes;
+  }
+
+  // generators
+  job.generators.resize(job.element_num_bytes * num_generators);
+  receive_bytes(t, job.generators);
+
+  // exponents
+  job.exponent_data.resize(num_exponent_bytes);
+  receive_bytes(t, job.exponent_data);
+  auto data = job.exponent_data.data();
+  for (auto& seq : job.exponents) {
+    seq.data = data;
+    data += seq.n * seq.element_nbytes;
+  }
+  return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+// send_shard_result
+//--------------------------------------------------------------------------------------------------
+void send_shard_result(transport& t, basct::span_cvoid products) noexcept {
+  t.send(basct::cspan<uint8_t>{
+      static_cast<const uint8_t*>(products.data()),
+      products.size() * products.element_size(),
+  });
+}
+
+//--------------------------------------------------------------------------------------------------
+// receive_shard_result
+//--------------------------------------------------------------------------------------------------
+void receive_shard_result(basct::span_void products, transport& t) noexcept {
+  basct::span<uint8_t> data{
+      static_cast<uint8_t*>(products.data()),
+      products.size() * products.element_size(),
+  };
+  if (data.empty()) {
+    return;
+  }
+  if (!t.receive(data)) {
+    baser::panic("worker closed the channel before sending its result");
+  }
+}
+} // namespace sxt::mtxsh
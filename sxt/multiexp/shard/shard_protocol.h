@@ -0,0 +1,93 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "sxt/base/container/span.h"
+#include "sxt/base/container/span_void.h"
+#include "sxt/memory/management/managed_array.h"
+#include "sxt/multiexp/base/exponent_sequence.h"
+
+namespace sxt::basit {
+class index_range;
+}
+
+namespace sxt::mtxsh {
+class transport;
+
+//--------------------------------------------------------------------------------------------------
+// shard_job
+//--------------------------------------------------------------------------------------------------
+/**
+ * The work a worker receives for a single shard: a range of generators together with the
+ * matching slice of every exponent sequence.
+ */
+struct shard_job {
+  size_t element_num_bytes = 0;
+  memmg::managed_array<uint8_t> generators;
+  memmg::managed_array<uint8_t> exponent_data;
+  std::vector<mtxb::exponent_sequence> exponents;
+
+  size_t num_generators() const noexcept {
+    return element_num_bytes == 0 ? 0 : generators.size() / element_num_bytes;
+  }
+};
+
+//--------------------------------------------------------------------------------------------------
+// send_shard_job
+//--------------------------------------------------------------------------------------------------
+/**
+ * Send the shard of a multiexponentiation covering the generator range rng.
+ *
+ * Sequences are sliced to rng so that a sequence shorter than rng.b() contributes only the
+ * exponents it has.
+ */
+void send_shard_job(transport& t, basct::span_cvoid generators,
+                    basct::cspan<mtxb::exponent_sequence> exponents,
+                    const basit::index_range& rng) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// send_shard_shutdown
+//--------------------------------------------------------------------------------------------------
+void send_shard_shutdown(transport& t) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// receive_shard_job
+//--------------------------------------------------------------------------------------------------
+/**
+ * Receive the next job from a coordinator.
+ *
+ * Return false if the coordinator requested a shutdown or closed the channel.
+ */
+[[nodiscard]] bool receive_shard_job(shard_job& job, transport& t) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// send_shard_result
+//--------------------------------------------------------------------------------------------------
+/**
+ * Send the partial products of a shard, one uncompressed element per output.
+ */
+void send_shard_result(transport& t, basct::span_cvoid products) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// receive_shard_result
+//--------------------------------------------------------------------------------------------------
+void receive_shard_result(basct::span_void products, transport& t) noexcept;
+} // namespace sxt::mtxsh
@@ -0,0 +1,102 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/shard/shard_protocol.h"
+
+#include <vector>
+
+#include "sxt/base/iterator/index_range.h"
+#include "sxt/base/test/unit_test.h"
+#include "sxt/multiexp/shard/socket_transport.h"
+
+using namespace sxt;
+using namespace sxt::mtxsh;
+
+TEST_CASE("we can send shard jobs over a transport") {
+  auto [t1, t2] = make_socket_transport_pair();
+  shard_job job;
+
+  std::vector<uint64_t> generators = {10, 20, 30, 40};
+  std::vector<uint8_t> exponents1 = {1, 2, 3, 4};
+  std::vector<uint16_t> exponents2 = {5, 6};
+  std::vector<mtxb::exponent_sequence> exponents = {
+      {.element_nbytes = 1, .n = 4, .data = exponents1.data()},
+      {.element_nbytes = 2,
+       .n = 2,
+       .data = reinterpret_cast<const uint8_t*>(exponents2.data()),
+       .is_signed = 1},
+  };
+
+  SECTION("we can send a job covering every generator") {
+    send_shard_job(t1, basct::cspan<uint64_t>{generators}, exponents, {0, 4});
+    REQUIRE(receive_shard_job(job, t2));
+    REQUIRE(job.element_num_bytes == 8);
+    REQUIRE(job.num_generators() == 4);
+    REQUIRE(reinterpret_cast<const uint64_t*>(job.generators.data())[3] == 40);
+    REQUIRE(job.exponents.size() == 2);
+    REQUIRE(job.exponents[0].n == 4);
+    REQUIRE(job.exponents[0].data[2] == 3);
+    REQUIRE(job.exponents[1].element_nbytes == 2);
+    REQUIRE(job.exponents[1].is_signed == 1);
+    REQUIRE(reinterpret_cast<const uint16_t*>(job.exponents[1].data)[1] == 6);
+  }
+
+  SECTION("exponent sequences are sliced to the shard") {
+    send_shard_job(t1, basct::cspan<uint64_t>{generators}, exponents, {1, 3});
+    REQUIRE(receive_shard_job(job, t2));
+    REQUIRE(job.num_generators() == 2);
+    REQUIRE(reinterpret_cast<const uint64_t*>(job.generators.data())[0] == 20);
+    REQUIRE(job.exponents[0].n == 2);
+    REQUIRE(job.exponents[0].data[0] == 2);
+    REQUIRE(job.exponents[0].data[1] == 3);
+    REQUIRE(job.exponents[1].n == 1);
+    REQUIRE(reinterpret_cast<const uint16_t*>(job.exponents[1].data)[0] == 6);
+  }
+
+  SECTION("a shard can lie past the end of a sequence") {
+    send_shard_job(t1, basct::cspan<uint64_t>{generators}, exponents, {2, 4});
+    REQUIRE(receive_shard_job(job, t2));
+    REQUIRE(job.exponents[0].n == 2);
+    REQUIRE(job.exponents[1].n == 0);
+  }
+
+  SECTION("we can send multiple jobs") {
+    send_shard_job(t1, basct::cspan<uint64_t>{generators}, exponents, {0, 2});
+    send_shard_job(t1, basct::cspan<uint64_t>{generators}, exponents, {2, 4});
+    REQUIRE(receive_shard_job(job, t2));
+    REQUIRE(job.exponents[0].data[0] == 1);
+    REQUIRE(receive_shard_job(job, t2));
+    REQUIRE(job.exponents[0].data[0] == 3);
+  }
+
+  SECTION("receiving a job fails after a shutdown") {
+    send_shard_shutdown(t1);
+    REQUIRE(!receive_shard_job(job, t2));
+  }
+
+  SECTION("receiving a job fails if the channel is closed") {
+    t1.close();
+    REQUIRE(!receive_shard_job(job, t2));
+  }
+
+  SECTION("we can send results") {
+    std::vector<uint64_t> products = {1, 2};
+    send_shard_result(t2, basct::cspan<uint64_t>{products});
+    std::vector<uint64_t> res(2);
+    receive_shard_result(basct::span<uint64_t>{res}, t1);
+    REQUIRE(res == products);
+  }
+}
@@ -0,0 +1,116 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/shard/socket_transport.h"
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+
+#include "sxt/base/error/panic.h"
+
+namespace sxt::mtxsh {
+//--------------------------------------------------------------------------------------------------
+// constructor
+//--------------------------------------------------------------------------------------------------
+socket_transport::socket_transport(socket_transport&& other) noexcept
+    : fd_{std::exchange(other.fd_, -1)} {}
+
+//--------------------------------------------------------------------------------------------------
+// destructor
+//--------------------------------------------------------------------------------------------------
+socket_transport::~socket_transport() noexcept { this->close(); }
+
+//--------------------------------------------------------------------------------------------------
+// operator=
+//--------------------------------------------------------------------------------------------------
+socket_transport& socket_transport::operator=(socket_transport&& other) noexcept {
+  if (this != &other) {
+    this->close();
+    fd_ = std::exchange(other.fd_, -1);
+  }
+  return *this;
+}
+
+//--------------------------------------------------------------------------------------------------
+// close
+//--------------------------------------------------------------------------------------------------
+void socket_transport::close() noexcept {
+  if (fd_ < 0) {
+    return;
+  }
+  ::close(fd_);
+  fd_ = -1;
+}
+
+//--------------------------------------------------------------------------------------------------
+// send
+//--------------------------------------------------------------------------------------------------
+void socket_transport::send(basct::cspan<uint8_t> data) noexcept {
+  auto p = data.data();
+  auto n = data.size();
+  while (n > 0) {
+    auto rcode = ::send(fd_, p, n, MSG_NOSIGNAL);
+    if (rcode < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      baser::panic("send failed: {}", std::strerror(errno));
+    }
+    p += rcode;
+    n -= static_cast<size_t>(rcode);
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// receive
+//--------------------------------------------------------------------------------------------------
+bool socket_transport::receive(basct::span<uint8_t> data) noexcept {
+  auto p = data.data();
+  auto n = data.size();
+  while (n > 0) {
+    auto rcode = ::recv(fd_, p, n, 0);
+    if (rcode < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      baser::panic("recv failed: {}", std::strerror(errno));
+    }
+    if (rcode == 0) {
+      if (n == data.size()) {
+        return false;
+      }
+      baser::panic("connection closed in the middle of a message");
+    }
+    p += rcode;
+    n -= static_cast<size_t>(rcode);
+  }
+  return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+// make_socket_transport_pair
+//--------------------------------------------------------------------------------------------------
+std::pair<socket_transport, socket_transport> make_socket_transport_pair() noexcept {
+  int fds[2];
+  if (::socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds) != 0) {
+    baser::panic("socketpair failed: {}", std::strerror(errno));
+  }
+  return {socket_transport{fds[0]}, socket_transport{fds[1]}};
+}
+} // namespace sxt::mtxsh
@@ -0,0 +1,66 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+#include <utility>
+
+#include "sxt/base/container/span.h"
+#include "sxt/multiexp/shard/transport.h"
+
+namespace sxt::mtxsh {
+//--------------------------------------------------------------------------------------------------
+// socket_transport
+//--------------------------------------------------------------------------------------------------
+/**
+ * A transport over a connected stream socket. The transport owns the file descriptor.
+ */
+class socket_transport final : public transport {
+public:
+  socket_transport() noexcept = default;
+
+  explicit socket_transport(int fd) noexcept : fd_{fd} {}
+
+  socket_transport(const socket_transport&) = delete;
+  socket_transport(socket_transport&& other) noexcept;
+
+  ~socket_transport() noexcept override;
+
+  socket_transport& operator=(const socket_transport&) = delete;
+  socket_transport& operator=(socket_transport&& other) noexcept;
+
+  int fd() const noexcept { return fd_; }
+
+  void close() noexcept;
+
+  // transport
+  void send(basct::cspan<uint8_t> data) noexcept override;
+
+  [[nodiscard]] bool receive(basct::span<uint8_t> data) noexcept override;
+
+private:
+  int fd_ = -1;
+};
+
+//--------------------------------------------------------------------------------------------------
+// make_socket_transport_pair
+//--------------------------------------------------------------------------------------------------
+/**
+ * Create two transports connected to each other with a unix domain socket pair.
+ */
+std::pair<socket_transport, socket_transport> make_socket_transport_pair() noexcept;
+} // namespace sxt::mtxsh
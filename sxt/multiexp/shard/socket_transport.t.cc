@@ -0,0 +1,76 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/shard/socket_transport.h"
+
+#include <vector>
+
+#include "sxt/base/test/unit_test.h"
+
+using namespace sxt;
+using namespace sxt::mtxsh;
+
+TEST_CASE("we can send bytes over a socket transport") {
+  auto [t1, t2] = make_socket_transport_pair();
+
+  SECTION("we can send and receive a message") {
+    std::vector<uint8_t> data = {1, 2, 3};
+    t1.send(data);
+    std::vector<uint8_t> res(3);
+    REQUIRE(t2.receive(res));
+    REQUIRE(res == data);
+  }
+
+  SECTION("we can send messages in both directions") {
+    std::vector<uint8_t> data1 = {1, 2, 3};
+    std::vector<uint8_t> data2 = {4, 5};
+    t1.send(data1);
+    t2.send(data2);
+    std::vector<uint8_t> res(3);
+    REQUIRE(t2.receive(res));
+    REQUIRE(res == data1);
+    res.resize(2);
+    REQUIRE(t1.receive(res));
+    REQUIRE(res == data2);
+  }
+
+  SECTION("a message can be received in pieces") {
+    std::vector<uint8_t> data = {1, 2, 3};
+    t1.send(data);
+    std::vector<uint8_t> res(2);
+    REQUIRE(t2.receive(res));
+    REQUIRE(res == std::vector<uint8_t>{1, 2});
+    res.resize(1);
+    REQUIRE(t2.receive(res));
+    REQUIRE(res == std::vector<uint8_t>{3});
+  }
+
+  SECTION("receive returns false when the peer closes the connection") {
+    t1.close();
+    std::vector<uint8_t> res(1);
+    REQUIRE(!t2.receive(res));
+  }
+
+  SECTION("transports can be moved") {
+    auto t3 = std::move(t1);
+    REQUIRE(t1.fd() == -1);
+    std::vector<uint8_t> data = {7};
+    t3.send(data);
+    std::vector<uint8_t> res(1);
+    REQUIRE(t2.receive(res));
+    REQUIRE(res == data);
+  }
+}
@@ -0,0 +1,43 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+
+#include "sxt/base/container/span.h"
+
+namespace sxt::mtxsh {
+//--------------------------------------------------------------------------------------------------
+// transport
+//--------------------------------------------------------------------------------------------------
+/**
+ * A reliable, ordered byte channel between a shard coordinator and a worker.
+ */
+class transport {
+public:
+  virtual ~transport() noexcept = default;
+
+  virtual void send(basct::cspan<uint8_t> data) noexcept = 0;
+
+  /**
+   * Fill data with the next data.size() bytes from the channel.
+   *
+   * Return false if the peer closed the channel before any byte was read.
+   */
+  [[nodiscard]] virtual bool receive(basct::span<uint8_t> data) noexcept = 0;
+};
+} // namespace sxt::mtxsh
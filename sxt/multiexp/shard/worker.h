@@ -0,0 +1,57 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <type_traits>
+
+#include "sxt/base/container/span.h"
+#include "sxt/base/curve/element.h"
+#include "sxt/base/error/assert.h"
+#include "sxt/base/functional/function_ref.h"
+#include "sxt/memory/management/managed_array.h"
+#include "sxt/multiexp/base/exponent_sequence.h"
+#include "sxt/multiexp/shard/shard_protocol.h"
+#include "sxt/multiexp/shard/transport.h"
+
+namespace sxt::mtxsh {
+//--------------------------------------------------------------------------------------------------
+// multiexponentiation_fn
+//--------------------------------------------------------------------------------------------------
+template <class Element>
+using multiexponentiation_fn = basf::function_ref<memmg::managed_array<Element>(
+    basct::cspan<Element>, basct::cspan<mtxb::exponent_sequence>)>;
+
+//--------------------------------------------------------------------------------------------------
+// serve_shards
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute shard jobs received over t with f until the coordinator shuts the worker down.
+ */
+template <bascrv::element Element>
+void serve_shards(transport& t, multiexponentiation_fn<Element> f) noexcept {
+  static_assert(std::is_trivially_copyable_v<Element>);
+  shard_job job;
+  while (receive_shard_job(job, t)) {
+    SXT_RELEASE_ASSERT(job.element_num_bytes == sizeof(Element));
+    basct::cspan<Element> generators{reinterpret_cast<const Element*>(job.generators.data()),
+                                     job.num_generators()};
+    auto products = f(generators, job.exponents);
+    SXT_RELEASE_ASSERT(products.size() == job.exponents.size());
+    send_shard_result(t, basct::cspan<Element>{products});
+  }
+}
+} // namespace sxt::mtxsh
@@ -25,8 +25,10 @@
 #include "sxt/curve21/type/element_p3.h"
 #include "sxt/execution/async/coroutine.h"
 #include "sxt/execution/async/future.h"
+#include "sxt/memory/management/managed_array.h"
 #include "sxt/proof/inner_product/driver.h"
 #include "sxt/proof/inner_product/proof_descriptor.h"
+#include "sxt/proof/inner_product/streaming_fold.h"
 #include "sxt/proof/inner_product/workspace.h"
 #include "sxt/proof/transcript/transcript_utility.h"
 #include "sxt/ristretto/operation/compression.h"
@@ -54,6 +56,34 @@ static void compute_round_challenge(s25t::element& x, prft::transcript& transcri
   prft::challenge_value(x, transcript, "x");
 }
 
+//--------------------------------------------------------------------------------------------------
+// prove_rounds
+//--------------------------------------------------------------------------------------------------
+static xena::future<void> prove_rounds(basct::span<rstt::compressed_element> l_vector,
+                                       basct::span<rstt::compressed_element> r_vector,
+                                       s25t::element& ap_value, prft::transcript& transcript,
+                                       const driver& drv, const proof_descriptor& descriptor,
+                                       basct::cspan<s25t::element> a_vector) noexcept {
+  auto np = descriptor.g_vector.size();
+  auto workspace = drv.make_workspace(descriptor, a_vector);
+  size_t round_index = 0;
+  while (np > 1) {
+    auto& l_value = l_vector[round_index];
+    auto& r_value = r_vector[round_index];
+    co_await drv.commit_to_fold(l_value, r_value, *workspace);
+
+    s25t::element x;
+    compute_round_challenge(x, transcript, l_value, r_value);
+
+    co_await drv.fold(*workspace, x);
+
+    np /= 2;
+    ++round_index;
+  }
+
+  ap_value = workspace->a_vector[0];
+}
+
 //--------------------------------------------------------------------------------------------------
 // prove_inner_product
 //--------------------------------------------------------------------------------------------------
@@ -83,23 +113,85 @@ xena::future<void> prove_inner_product(basct::span<rstt::compressed_element> l_v
     co_return;
   }
 
-  auto workspace = drv.make_workspace(descriptor, a_vector);
-  size_t round_index = 0;
-  while (np > 1) {
-    auto& l_value = l_vector[round_index];
-    auto& r_value = r_vector[round_index];
-    co_await drv.commit_to_fold(l_value, r_value, *workspace);
+  co_await prove_rounds(l_vector, r_vector, ap_value, transcript, drv, descriptor, a_vector);
+}
 
-    s25t::element x;
-    compute_round_challenge(x, transcript, l_value, r_value);
+//--------------------------------------------------------------------------------------------------
+// prove_inner_product_streaming
+//--------------------------------------------------------------------------------------------------
+xena::future<void> prove_inner_product_streaming(basct::span<rstt::compressed_element> l_vector,
+                                                 basct::span<rstt::compressed_element> r_vector,
+                                                 s25t::element& ap_value,
+                                                 prft::transcript& transcript, const driver& drv,
+                                                 const streaming_proof_descriptor& descriptor,
+                                                 const streaming_fold_storage& storage,
+                                                 size_t max_resident_size,
+                                                 size_t chunk_size) noexcept {
+  auto n = descriptor.n;
+  auto n_lg2 = static_cast<size_t>(basn::ceil_log2(n));
+  auto num_rounds = n_lg2;
+  // clang-format off
+  SXT_DEBUG_ASSERT(
+    n > 0 &&
+    max_resident_size > 0 &&
+    l_vector.size() == num_rounds &&
+    r_vector.size() == num_rounds
+  );
+  // clang-format on
 
-    co_await drv.fold(*workspace, x);
+  init_transcript(transcript, n);
 
-    np /= 2;
+  if (n == 1) {
+    descriptor.read_a_vector({&ap_value, 1}, 0);
+    co_return;
+  }
+
+  // stream the rounds whose folded vectors don't fit in memory through storage
+  auto mid = (1ull << n_lg2) / 2u;
+  streaming_proof_descriptor round_descriptor = descriptor;
+  streaming_proof_descriptor stored_descriptor{
+      .n = 0,
+      .read_a_vector = storage.read_a_vector,
+      .read_b_vector = storage.read_b_vector,
+      .read_g_vector = storage.read_g_vector,
+      .q_value = descriptor.q_value,
+  };
+  size_t round_index = 0;
+  s25t::element x;
+  while (true) {
+    c21t::element_p3 l_value, r_value;
+    commit_to_streaming_fold(l_value, r_value, round_descriptor, chunk_size);
+    rsto::compress(l_vector[round_index], l_value);
+    rsto::compress(r_vector[round_index], r_value);
+    compute_round_challenge(x, transcript, l_vector[round_index], r_vector[round_index]);
     ++round_index;
+    if (mid <= max_resident_size) {
+      break;
+    }
+    streaming_fold(storage, round_descriptor, x, chunk_size);
+    stored_descriptor.n = mid;
+    round_descriptor = stored_descriptor;
+    mid /= 2u;
   }
 
-  ap_value = workspace->a_vector[0];
+  memmg::managed_array<s25t::element> ap_vector(mid);
+  memmg::managed_array<s25t::element> bp_vector(mid);
+  memmg::managed_array<c21t::element_p3> gp_vector(mid);
+  streaming_fold(ap_vector, bp_vector, gp_vector, round_descriptor, x, chunk_size);
+
+  if (mid == 1) {
+    ap_value = ap_vector[0];
+    co_return;
+  }
+
+  // the folded problem is resident, so the remaining rounds are proven in memory
+  proof_descriptor descriptor_p{
+      .b_vector = bp_vector,
+      .g_vector = gp_vector,
+      .q_value = descriptor.q_value,
+  };
+  co_await prove_rounds(l_vector.subspan(round_index), r_vector.subspan(round_index), ap_value,
+                        transcript, drv, descriptor_p, ap_vector);
 }
 
 //--------------------------------------------------------------------------------------------------
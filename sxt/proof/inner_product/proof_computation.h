@@ -35,6 +35,8 @@ class transcript;
 namespace sxt::prfip {
 class driver;
 struct proof_descriptor;
+struct streaming_fold_storage;
+struct streaming_proof_descriptor;
 
 //--------------------------------------------------------------------------------------------------
 // prove_inner_product
@@ -45,6 +47,27 @@ xena::future<void> prove_inner_product(basct::span<rstt::compressed_element> l_v
                                        const driver& drv, const proof_descriptor& descriptor,
                                        basct::cspan<s25t::element> a_vector) noexcept;
 
+//--------------------------------------------------------------------------------------------------
+// prove_inner_product_streaming
+//--------------------------------------------------------------------------------------------------
+/**
+ * Prove an inner product whose vectors needn't fit in memory.
+ *
+ * Each streamed round reads its vectors a chunk at a time to compute L and R and then again to
+ * fold them. While the folded vectors have more than max_resident_size elements, they're written
+ * through storage and the next round is streamed from it; once they fit, they're folded into
+ * memory and the remaining rounds are proven with drv. The first round is always streamed. The
+ * proof is identical to that of prove_inner_product.
+ */
+xena::future<void> prove_inner_product_streaming(basct::span<rstt::compressed_element> l_vector,
+                                                 basct::span<rstt::compressed_element> r_vector,
+                                                 s25t::element& ap_value,
+                                                 prft::transcript& transcript, const driver& drv,
+                                                 const streaming_proof_descriptor& descriptor,
+                                                 const streaming_fold_storage& storage,
+                                                 size_t max_resident_size,
+                                                 size_t chunk_size) noexcept;
+
 //--------------------------------------------------------------------------------------------------
 // verify_inner_product
 //--------------------------------------------------------------------------------------------------
@@ -16,9 +16,11 @@
  */
 #include "sxt/proof/inner_product/proof_computation.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <iostream>
 #include <memory_resource>
+#include <vector>
 
 #include "sxt/base/error/panic.h"
 #include "sxt/base/num/ceil_log2.h"
@@ -31,6 +33,7 @@
 #include "sxt/proof/inner_product/gpu_driver.h"
 #include "sxt/proof/inner_product/proof_descriptor.h"
 #include "sxt/proof/inner_product/random_product_generation.h"
+#include "sxt/proof/inner_product/streaming_fold.h"
 #include "sxt/proof/transcript/transcript.h"
 #include "sxt/ristretto/operation/compression.h"
 #include "sxt/ristretto/type/compressed_element.h"
@@ -133,6 +136,105 @@ TEST_CASE("we can prove and verify an inner product") {
   }
 }
 
+TEST_CASE("we can prove an inner product streaming rounds that don't fit in memory") {
+  std::pmr::monotonic_buffer_resource alloc;
+  cpu_driver drv;
+  proof_descriptor descriptor;
+  basct::cspan<s25t::element> a_vector;
+  basn::fast_random_number_generator rng{1, 2};
+
+  for (size_t n : {1, 2, 3, 4, 5, 8, 9, 123}) {
+    generate_random_product(descriptor, a_vector, rng, &alloc, n);
+    auto num_rounds = basn::ceil_log2(n);
+
+    // prove in memory
+    std::vector<rstt::compressed_element> l_vector(num_rounds), r_vector(num_rounds);
+    s25t::element ap_value;
+    prft::transcript transcript{"abc"};
+    auto fut =
+        prove_inner_product(l_vector, r_vector, ap_value, transcript, drv, descriptor, a_vector);
+    REQUIRE(fut.ready());
+
+    // prove reading the vectors a chunk at a time
+    auto read_a_vector = [&](basct::span<s25t::element> chunk, size_t first) noexcept {
+      std::copy_n(a_vector.begin() + first, chunk.size(), chunk.begin());
+    };
+    auto read_b_vector = [&](basct::span<s25t::element> chunk, size_t first) noexcept {
+      std::copy_n(descriptor.b_vector.begin() + first, chunk.size(), chunk.begin());
+    };
+    auto read_g_vector = [&](basct::span<c21t::element_p3> chunk, size_t first) noexcept {
+      std::copy_n(descriptor.g_vector.begin() + first, chunk.size(), chunk.begin());
+    };
+    streaming_proof_descriptor streaming_descriptor{
+        .n = n,
+        .read_a_vector = read_a_vector,
+        .read_b_vector = read_b_vector,
+        .read_g_vector = read_g_vector,
+        .q_value = descriptor.q_value,
+    };
+
+    // store the intermediate folds in a buffer whose size we track
+    std::vector<s25t::element> a_storage, b_storage;
+    std::vector<c21t::element_p3> g_storage;
+    size_t num_writes = 0;
+    auto read_a_storage = [&](basct::span<s25t::element> chunk, size_t first) noexcept {
+      std::copy_n(a_storage.begin() + first, chunk.size(), chunk.begin());
+    };
+    auto read_b_storage = [&](basct::span<s25t::element> chunk, size_t first) noexcept {
+      std::copy_n(b_storage.begin() + first, chunk.size(), chunk.begin());
+    };
+    auto read_g_storage = [&](basct::span<c21t::element_p3> chunk, size_t first) noexcept {
+      std::copy_n(g_storage.begin() + first, chunk.size(), chunk.begin());
+    };
+    auto write_a_storage = [&](basct::cspan<s25t::element> chunk, size_t first) noexcept {
+      a_storage.resize(std::max(a_storage.size(), first + chunk.size()));
+      std::copy(chunk.begin(), chunk.end(), a_storage.begin() + first);
+      ++num_writes;
+    };
+    auto write_b_storage = [&](basct::cspan<s25t::element> chunk, size_t first) noexcept {
+      b_storage.resize(std::max(b_storage.size(), first + chunk.size()));
+      std::copy(chunk.begin(), chunk.end(), b_storage.begin() + first);
+    };
+    auto write_g_storage = [&](basct::cspan<c21t::element_p3> chunk, size_t first) noexcept {
+      g_storage.resize(std::max(g_storage.size(), first + chunk.size()));
+      std::copy(chunk.begin(), chunk.end(), g_storage.begin() + first);
+    };
+    streaming_fold_storage storage{
+        .read_a_vector = read_a_storage,
+        .read_b_vector = read_b_storage,
+        .read_g_vector = read_g_storage,
+        .write_a_vector = write_a_storage,
+        .write_b_vector = write_b_storage,
+        .write_g_vector = write_g_storage,
+    };
+    for (size_t max_resident_size : {1, 2, 16, 1024}) {
+      for (size_t chunk_size : {1, 3, 64}) {
+        a_storage.clear();
+        b_storage.clear();
+        g_storage.clear();
+        num_writes = 0;
+        std::vector<rstt::compressed_element> l_vector_p(num_rounds), r_vector_p(num_rounds);
+        s25t::element ap_value_p;
+        prft::transcript transcript_p{"abc"};
+        fut = prove_inner_product_streaming(l_vector_p, r_vector_p, ap_value_p, transcript_p, drv,
+                                            streaming_descriptor, storage, max_resident_size,
+                                            chunk_size);
+        REQUIRE(fut.ready());
+        REQUIRE(l_vector_p == l_vector);
+        REQUIRE(r_vector_p == r_vector);
+        REQUIRE(ap_value_p == ap_value);
+
+        // only folds that exceed the budget are written to storage
+        auto np = 1ull << num_rounds;
+        REQUIRE(a_storage.size() == (np / 2 > max_resident_size ? np / 2 : 0));
+        REQUIRE(b_storage.size() == a_storage.size());
+        REQUIRE(g_storage.size() == a_storage.size());
+        REQUIRE((num_writes > 0) == (np / 2 > max_resident_size));
+      }
+    }
+  }
+}
+
 static void exercise_prove_verify(const driver& drv, const proof_descriptor& descriptor,
                                   basct::cspan<s25t::element> a_vector) noexcept {
   auto n = a_vector.size();
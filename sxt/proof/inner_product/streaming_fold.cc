@@ -0,0 +1,228 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/proof/inner_product/streaming_fold.h"
+
+#include <algorithm>
+
+#include "sxt/base/error/assert.h"
+#include "sxt/base/num/ceil_log2.h"
+#include "sxt/curve21/operation/add.h"
+#include "sxt/curve21/operation/double.h"
+#include "sxt/curve21/operation/neg.h"
+#include "sxt/curve21/operation/scalar_multiply.h"
+#include "sxt/curve21/type/element_p3.h"
+#include "sxt/memory/management/managed_array.h"
+#include "sxt/multiexp/base/exponent_sequence.h"
+#include "sxt/multiexp/curve/multiexponentiation.h"
+#include "sxt/proof/inner_product/generator_fold.h"
+#include "sxt/scalar25/constant/max_bits.h"
+#include "sxt/scalar25/operation/add.h"
+#include "sxt/scalar25/operation/batch_arithmetic.h"
+#include "sxt/scalar25/operation/inner_product.h"
+#include "sxt/scalar25/operation/inv.h"
+#include "sxt/scalar25/type/element.h"
+
+namespace sxt::prfip {
+//--------------------------------------------------------------------------------------------------
+// chunk_buffers
+//--------------------------------------------------------------------------------------------------
+namespace {
+struct chunk_buffers {
+  explicit chunk_buffers(size_t chunk_size) noexcept
+      : a_low(chunk_size), a_high(chunk_size), b_low(chunk_size), b_high(chunk_size),
+        g_low(chunk_size), g_high(chunk_size) {}
+
+  memmg::managed_array<s25t::element> a_low;
+  memmg::managed_array<s25t::element> a_high;
+  memmg::managed_array<s25t::element> b_low;
+  memmg::managed_array<s25t::element> b_high;
+  memmg::managed_array<c21t::element_p3> g_low;
+  memmg::managed_array<c21t::element_p3> g_high;
+};
+} // namespace
+
+//--------------------------------------------------------------------------------------------------
+// fold_size
+//--------------------------------------------------------------------------------------------------
+static size_t fold_size(uint64_t n) noexcept {
+  SXT_DEBUG_ASSERT(n > 1);
+  return (1ull << basn::ceil_log2(n)) / 2u;
+}
+
+//--------------------------------------------------------------------------------------------------
+// read_chunk
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read the elements first, ..., first + m - 1 of the low half and the elements that exist of
+ * first + mid, ..., first + mid + m - 1 of the high half. Return the number of high elements
+ * read; a and b are zero past the end.
+ */
+static size_t read_chunk(chunk_buffers& buffers, const streaming_proof_descriptor& descriptor,
+                         size_t mid, size_t first, size_t m) noexcept {
+  auto n = descriptor.n;
+  auto num_high = first + mid < n ? std::min(m, n - first - mid) : 0;
+  descriptor.read_a_vector({buffers.a_low.data(), m}, first);
+  descriptor.read_b_vector({buffers.b_low.data(), m}, first);
+  if (num_high > 0) {
+    descriptor.read_a_vector({buffers.a_high.data(), num_high}, first + mid);
+    descriptor.read_b_vector({buffers.b_high.data(), num_high}, first + mid);
+  }
+  descriptor.read_g_vector({buffers.g_low.data(), m}, first);
+  descriptor.read_g_vector({buffers.g_high.data(), m}, first + mid);
+  return num_high;
+}
+
+//--------------------------------------------------------------------------------------------------
+// multiexponentiate
+//--------------------------------------------------------------------------------------------------
+static void multiexponentiate(c21t::element_p3& res, basct::cspan<c21t::element_p3> g_vector,
+                              basct::cspan<s25t::element> x_vector) noexcept {
+  if (x_vector.empty()) {
+    return;
+  }
+  mtxb::exponent_sequence exponents{
+      .element_nbytes = 32,
+      .n = x_vector.size(),
+      .data = reinterpret_cast<const uint8_t*>(x_vector.data()),
+      .is_signed = 0,
+  };
+  auto values = mtxcrv::compute_multiexponentiation<c21t::element_p3>(
+      g_vector.subspan(0, x_vector.size()), basct::cspan<mtxb::exponent_sequence>{&exponents, 1});
+  c21o::add(res, res, values[0]);
+}
+
+//--------------------------------------------------------------------------------------------------
+// commit_to_streaming_fold
+//--------------------------------------------------------------------------------------------------
+void commit_to_streaming_fold(c21t::element_p3& l_value, c21t::element_p3& r_value,
+                              const streaming_proof_descriptor& descriptor,
+                              size_t chunk_size) noexcept {
+  auto mid = fold_size(descriptor.n);
+  chunk_size = std::min(chunk_size, mid);
+  SXT_DEBUG_ASSERT(chunk_size > 0 && descriptor.q_value != nullptr);
+  chunk_buffers buffers{chunk_size};
+
+  s25t::element c_values[2] = {s25t::element::identity(), s25t::element::identity()};
+  l_value = c21t::element_p3::identity();
+  r_value = c21t::element_p3::identity();
+  for (size_t first = 0; first < mid; first += chunk_size) {
+    auto m = std::min(chunk_size, mid - first);
+    auto num_high = read_chunk(buffers, descriptor, mid, first, m);
+    basct::cspan<s25t::element> a_low{buffers.a_low.data(), m};
+    basct::cspan<s25t::element> a_high{buffers.a_high.data(), num_high};
+    basct::cspan<s25t::element> b_low{buffers.b_low.data(), m};
+    basct::cspan<s25t::element> b_high{buffers.b_high.data(), num_high};
+
+    // c_values
+    s25t::element c_value;
+    s25o::inner_product(c_value, a_low, b_high);
+    s25o::add(c_values[0], c_values[0], c_value);
+    s25o::inner_product(c_value, a_high, b_low);
+    s25o::add(c_values[1], c_values[1], c_value);
+
+    // l_value and r_value
+    multiexponentiate(l_value, {buffers.g_high.data(), m}, a_low);
+    multiexponentiate(r_value, {buffers.g_low.data(), m}, a_high);
+  }
+
+  c21t::element_p3 c_commit;
+  c21o::scalar_multiply(c_commit, c_values[0], *descriptor.q_value);
+  c21o::add(l_value, l_value, c_commit);
+  c21o::scalar_multiply(c_commit, c_values[1], *descriptor.q_value);
+  c21o::add(r_value, r_value, c_commit);
+}
+
+//--------------------------------------------------------------------------------------------------
+// fold_chunk
+//--------------------------------------------------------------------------------------------------
+static void fold_chunk(basct::span<s25t::element> ap_chunk, basct::span<s25t::element> bp_chunk,
+                       basct::span<c21t::element_p3> gp_chunk, const chunk_buffers& buffers,
+                       size_t num_high, basct::cspan<unsigned> decomposition,
+                       const s25t::element& x, const s25t::element& x_inv) noexcept {
+  auto m = ap_chunk.size();
+  s25o::batch_fold(ap_chunk, x, x_inv, {buffers.a_low.data(), m},
+                   {buffers.a_high.data(), num_high});
+  s25o::batch_fold(bp_chunk, x_inv, x, {buffers.b_low.data(), m},
+                   {buffers.b_high.data(), num_high});
+  for (size_t i = 0; i < m; ++i) {
+    fold_generators(gp_chunk[i], decomposition, buffers.g_low[i], buffers.g_high[i]);
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// streaming_fold
+//--------------------------------------------------------------------------------------------------
+void streaming_fold(basct::span<s25t::element> ap_vector, basct::span<s25t::element> bp_vector,
+                    basct::span<c21t::element_p3> gp_vector,
+                    const streaming_proof_descriptor& descriptor, const s25t::element& x,
+                    size_t chunk_size) noexcept {
+  auto mid = fold_size(descriptor.n);
+  chunk_size = std::min(chunk_size, mid);
+  // clang-format off
+  SXT_DEBUG_ASSERT(
+      chunk_size > 0 &&
+      ap_vector.size() == mid &&
+      bp_vector.size() == mid &&
+      gp_vector.size() == mid
+  );
+  // clang-format on
+  chunk_buffers buffers{chunk_size};
+
+  s25t::element x_inv;
+  s25o::inv(x_inv, x);
+
+  unsigned data[s25cn::max_bits_v];
+  basct::span<unsigned> decomposition{data};
+  decompose_generator_fold(decomposition, x_inv, x);
+
+  for (size_t first = 0; first < mid; first += chunk_size) {
+    auto m = std::min(chunk_size, mid - first);
+    auto num_high = read_chunk(buffers, descriptor, mid, first, m);
+    fold_chunk(ap_vector.subspan(first, m), bp_vector.subspan(first, m),
+               gp_vector.subspan(first, m), buffers, num_high, decomposition, x, x_inv);
+  }
+}
+
+void streaming_fold(const streaming_fold_storage& storage,
+                    const streaming_proof_descriptor& descriptor, const s25t::element& x,
+                    size_t chunk_size) noexcept {
+  auto mid = fold_size(descriptor.n);
+  chunk_size = std::min(chunk_size, mid);
+  SXT_DEBUG_ASSERT(chunk_size > 0);
+  chunk_buffers buffers{chunk_size};
+  memmg::managed_array<s25t::element> ap_chunk(chunk_size);
+  memmg::managed_array<s25t::element> bp_chunk(chunk_size);
+  memmg::managed_array<c21t::element_p3> gp_chunk(chunk_size);
+
+  s25t::element x_inv;
+  s25o::inv(x_inv, x);
+
+  unsigned data[s25cn::max_bits_v];
+  basct::span<unsigned> decomposition{data};
+  decompose_generator_fold(decomposition, x_inv, x);
+
+  for (size_t first = 0; first < mid; first += chunk_size) {
+    auto m = std::min(chunk_size, mid - first);
+    auto num_high = read_chunk(buffers, descriptor, mid, first, m);
+    fold_chunk({ap_chunk.data(), m}, {bp_chunk.data(), m}, {gp_chunk.data(), m}, buffers,
+               num_high, decomposition, x, x_inv);
+    storage.write_a_vector({ap_chunk.data(), m}, first);
+    storage.write_b_vector({bp_chunk.data(), m}, first);
+    storage.write_g_vector({gp_chunk.data(), m}, first);
+  }
+}
+} // namespace sxt::prfip
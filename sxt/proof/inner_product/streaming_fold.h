@@ -0,0 +1,105 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "sxt/base/container/span.h"
+#include "sxt/base/functional/function_ref.h"
+
+namespace sxt::c21t {
+struct element_p3;
+}
+namespace sxt::s25t {
+class element;
+}
+
+namespace sxt::prfip {
+//--------------------------------------------------------------------------------------------------
+// streaming_chunk_size_v
+//--------------------------------------------------------------------------------------------------
+constexpr size_t streaming_chunk_size_v = 1u << 16u;
+
+//--------------------------------------------------------------------------------------------------
+// streaming_proof_descriptor
+//--------------------------------------------------------------------------------------------------
+/**
+ * Description of the inputs of an inner product proof whose vectors are read a chunk at a time
+ * instead of being resident in memory. See proof_descriptor.
+ *
+ * Each reader fills its chunk argument with the elements starting at the given index. a_vector
+ * and b_vector have n elements and g_vector has n rounded up to a power of two.
+ */
+struct streaming_proof_descriptor {
+  uint64_t n = 0;
+  basf::function_ref<void(basct::span<s25t::element>, size_t)> read_a_vector;
+  basf::function_ref<void(basct::span<s25t::element>, size_t)> read_b_vector;
+  basf::function_ref<void(basct::span<c21t::element_p3>, size_t)> read_g_vector;
+  const c21t::element_p3* q_value = nullptr;
+};
+
+//--------------------------------------------------------------------------------------------------
+// streaming_fold_storage
+//--------------------------------------------------------------------------------------------------
+/**
+ * Caller-provided storage for the folded vectors of rounds that are too large to keep in memory.
+ *
+ * Each writer stores its chunk argument as the elements starting at the given index and each
+ * reader fills its chunk argument with elements previously written. A round reads the chunk of
+ * indexes it's about to overwrite before writing it, so a single buffer per vector suffices.
+ */
+struct streaming_fold_storage {
+  basf::function_ref<void(basct::span<s25t::element>, size_t)> read_a_vector;
+  basf::function_ref<void(basct::span<s25t::element>, size_t)> read_b_vector;
+  basf::function_ref<void(basct::span<c21t::element_p3>, size_t)> read_g_vector;
+  basf::function_ref<void(basct::cspan<s25t::element>, size_t)> write_a_vector;
+  basf::function_ref<void(basct::cspan<s25t::element>, size_t)> write_b_vector;
+  basf::function_ref<void(basct::cspan<c21t::element_p3>, size_t)> write_g_vector;
+};
+
+//--------------------------------------------------------------------------------------------------
+// commit_to_streaming_fold
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute the L and R commitments of a round of an inner product proof, reading the vectors a
+ * chunk at a time.
+ */
+void commit_to_streaming_fold(c21t::element_p3& l_value, c21t::element_p3& r_value,
+                              const streaming_proof_descriptor& descriptor,
+                              size_t chunk_size = streaming_chunk_size_v) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// streaming_fold
+//--------------------------------------------------------------------------------------------------
+/**
+ * Using the challenge x, fold the vectors of a round of an inner product proof into in-memory
+ * vectors of half the padded size, reading the inputs a chunk at a time.
+ */
+void streaming_fold(basct::span<s25t::element> ap_vector, basct::span<s25t::element> bp_vector,
+                    basct::span<c21t::element_p3> gp_vector,
+                    const streaming_proof_descriptor& descriptor, const s25t::element& x,
+                    size_t chunk_size = streaming_chunk_size_v) noexcept;
+
+/**
+ * Using the challenge x, fold the vectors of a round of an inner product proof a chunk at a time
+ * and write the folded vectors of half the padded size through storage.
+ */
+void streaming_fold(const streaming_fold_storage& storage,
+                    const streaming_proof_descriptor& descriptor, const s25t::element& x,
+                    size_t chunk_size = streaming_chunk_size_v) noexcept;
+} // namespace sxt::prfip
@@ -0,0 +1,136 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/proof/inner_product/streaming_fold.h"
+
+#include <algorithm>
+#include <memory_resource>
+#include <vector>
+
+#include "sxt/base/num/fast_random_number_generator.h"
+#include "sxt/base/test/unit_test.h"
+#include "sxt/curve21/operation/overload.h"
+#include "sxt/curve21/type/element_p3.h"
+#include "sxt/proof/inner_product/proof_descriptor.h"
+#include "sxt/proof/inner_product/random_product_generation.h"
+#include "sxt/scalar25/operation/inv.h"
+#include "sxt/scalar25/operation/overload.h"
+#include "sxt/scalar25/type/element.h"
+#include "sxt/scalar25/type/literal.h"
+
+using namespace sxt;
+using namespace sxt::prfip;
+using sxt::s25t::operator""_s25;
+
+TEST_CASE("we can fold an inner product a chunk at a time") {
+  std::pmr::monotonic_buffer_resource alloc;
+  proof_descriptor descriptor;
+  basct::cspan<s25t::element> a_vector;
+  basn::fast_random_number_generator rng{1, 2};
+  auto x = 0x123_s25;
+  s25t::element x_inv;
+  s25o::inv(x_inv, x);
+
+  for (size_t n : {2, 3, 4, 5, 9, 33}) {
+    generate_random_product(descriptor, a_vector, rng, &alloc, n);
+    auto mid = descriptor.g_vector.size() / 2;
+
+    auto read_a_vector = [&](basct::span<s25t::element> chunk, size_t first) noexcept {
+      std::copy_n(a_vector.begin() + first, chunk.size(), chunk.begin());
+    };
+    auto read_b_vector = [&](basct::span<s25t::element> chunk, size_t first) noexcept {
+      std::copy_n(descriptor.b_vector.begin() + first, chunk.size(), chunk.begin());
+    };
+    auto read_g_vector = [&](basct::span<c21t::element_p3> chunk, size_t first) noexcept {
+      std::copy_n(descriptor.g_vector.begin() + first, chunk.size(), chunk.begin());
+    };
+    streaming_proof_descriptor streaming_descriptor{
+        .n = n,
+        .read_a_vector = read_a_vector,
+        .read_b_vector = read_b_vector,
+        .read_g_vector = read_g_vector,
+        .q_value = descriptor.q_value,
+    };
+
+    // expected values
+    auto a = [&](size_t i) noexcept { return i < n ? a_vector[i] : 0x0_s25; };
+    auto b = [&](size_t i) noexcept { return i < n ? descriptor.b_vector[i] : 0x0_s25; };
+    auto& g = descriptor.g_vector;
+    auto c_l = 0x0_s25, c_r = 0x0_s25;
+    auto expected_l = c21t::element_p3::identity();
+    auto expected_r = c21t::element_p3::identity();
+    std::vector<s25t::element> expected_ap(mid), expected_bp(mid);
+    std::vector<c21t::element_p3> expected_gp(mid);
+    for (size_t i = 0; i < mid; ++i) {
+      c_l = c_l + a(i) * b(i + mid);
+      c_r = c_r + a(i + mid) * b(i);
+      expected_l = expected_l + a(i) * g[i + mid];
+      expected_r = expected_r + a(i + mid) * g[i];
+      expected_ap[i] = x * a(i) + x_inv * a(i + mid);
+      expected_bp[i] = x_inv * b(i) + x * b(i + mid);
+      expected_gp[i] = x_inv * g[i] + x * g[i + mid];
+    }
+    expected_l = expected_l + c_l * *descriptor.q_value;
+    expected_r = expected_r + c_r * *descriptor.q_value;
+
+    for (size_t chunk_size : {1, 2, 3, 64}) {
+      // commit
+      c21t::element_p3 l_value, r_value;
+      commit_to_streaming_fold(l_value, r_value, streaming_descriptor, chunk_size);
+      REQUIRE(l_value == expected_l);
+      REQUIRE(r_value == expected_r);
+
+      // fold into memory
+      {
+        std::vector<s25t::element> ap_vector(mid), bp_vector(mid);
+        std::vector<c21t::element_p3> gp_vector(mid);
+        streaming_fold(ap_vector, bp_vector, gp_vector, streaming_descriptor, x, chunk_size);
+        REQUIRE(ap_vector == expected_ap);
+        REQUIRE(bp_vector == expected_bp);
+        REQUIRE(gp_vector == expected_gp);
+      }
+
+      // fold through storage a chunk at a time
+      {
+        std::vector<s25t::element> ap_vector(mid), bp_vector(mid);
+        std::vector<c21t::element_p3> gp_vector(mid);
+        std::vector<size_t> write_sizes;
+        auto write_a_vector = [&](basct::cspan<s25t::element> chunk, size_t first) noexcept {
+          REQUIRE(chunk.size() <= chunk_size);
+          std::copy(chunk.begin(), chunk.end(), ap_vector.begin() + first);
+          write_sizes.push_back(chunk.size());
+        };
+        auto write_b_vector = [&](basct::cspan<s25t::element> chunk, size_t first) noexcept {
+          std::copy(chunk.begin(), chunk.end(), bp_vector.begin() + first);
+        };
+        auto write_g_vector = [&](basct::cspan<c21t::element_p3> chunk, size_t first) noexcept {
+          std::copy(chunk.begin(), chunk.end(), gp_vector.begin() + first);
+        };
+        streaming_fold_storage storage{
+            .write_a_vector = write_a_vector,
+            .write_b_vector = write_b_vector,
+            .write_g_vector = write_g_vector,
+        };
+        streaming_fold(storage, streaming_descriptor, x, chunk_size);
+        REQUIRE(ap_vector == expected_ap);
+        REQUIRE(bp_vector == expected_bp);
+        REQUIRE(gp_vector == expected_gp);
+        auto m = std::min(chunk_size, mid);
+        REQUIRE(write_sizes.size() == (mid + m - 1) / m);
+      }
+    }
+  }
+}
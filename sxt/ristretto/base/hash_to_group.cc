@@ -0,0 +1,51 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/ristretto/base/hash_to_group.h"
+
+#include "sxt/base/error/assert.h"
+#include "sxt/base/iterator/index_range.h"
+#include "sxt/curve21/type/element_p3.h"
+#include "sxt/execution/thread/parallel_for.h"
+#include "sxt/field51/base/byte_conversion.h"
+#include "sxt/field51/type/element.h"
+#include "sxt/ristretto/base/point_formation.h"
+
+namespace sxt::rstb {
+//--------------------------------------------------------------------------------------------------
+// hash_to_group
+//--------------------------------------------------------------------------------------------------
+CUDA_CALLABLE
+void hash_to_group(c21t::element_p3& p, const uint8_t bytes[64]) noexcept {
+  f51t::element r0, r1;
+  f51b::from_bytes(r0.data(), bytes);
+  f51b::from_bytes(r1.data(), bytes + 32);
+  form_ristretto_point(p, r0, r1);
+}
+
+//--------------------------------------------------------------------------------------------------
+// batch_hash_to_group
+//--------------------------------------------------------------------------------------------------
+void batch_hash_to_group(basct::span<c21t::element_p3> px, basct::cspan<uint8_t> bytes) noexcept {
+  SXT_DEBUG_ASSERT(bytes.size() == px.size() * hash_to_group_num_bytes_v);
+  xent::parallel_for(basit::index_range{0, px.size()}.min_chunk_size(64),
+                     [&](basit::index_range rng) noexcept {
+                       for (auto i = rng.a(); i < rng.b(); ++i) {
+                         hash_to_group(px[i], bytes.data() + i * hash_to_group_num_bytes_v);
+                       }
+                     });
+}
+} // namespace sxt::rstb
@@ -0,0 +1,54 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "sxt/base/container/span.h"
+#include "sxt/base/macro/cuda_callable.h"
+
+namespace sxt::c21t {
+struct element_p3;
+}
+
+namespace sxt::rstb {
+//--------------------------------------------------------------------------------------------------
+// hash_to_group_num_bytes_v
+//--------------------------------------------------------------------------------------------------
+constexpr size_t hash_to_group_num_bytes_v = 64;
+
+//--------------------------------------------------------------------------------------------------
+// hash_to_group
+//--------------------------------------------------------------------------------------------------
+/**
+ * Map 64 uniformly random bytes to a ristretto point as described in RFC 9496 (section 4.3.4):
+ * each half is read as a field element with its top bit masked, mapped with elligator, and the
+ * two points are added.
+ */
+CUDA_CALLABLE
+void hash_to_group(c21t::element_p3& p, const uint8_t bytes[64]) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// batch_hash_to_group
+//--------------------------------------------------------------------------------------------------
+/**
+ * Apply hash_to_group to consecutive 64-byte blocks of bytes, splitting the work across the host
+ * threads.
+ */
+void batch_hash_to_group(basct::span<c21t::element_p3> px, basct::cspan<uint8_t> bytes) noexcept;
+} // namespace sxt::rstb
@@ -0,0 +1,97 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/ristretto/base/hash_to_group.h"
+
+#include <array>
+#include <string_view>
+#include <vector>
+
+#include "sxt/base/test/unit_test.h"
+#include "sxt/curve21/type/element_p3.h"
+#include "sxt/ristretto/base/byte_conversion.h"
+
+using namespace sxt;
+using namespace sxt::rstb;
+
+template <size_t N> static std::array<uint8_t, N> from_hex(std::string_view s) noexcept {
+  std::array<uint8_t, N> res;
+  auto digit = [](char c) noexcept { return c <= '9' ? c - '0' : c - 'a' + 10; };
+  for (size_t i = 0; i < N; ++i) {
+    res[i] = static_cast<uint8_t>(digit(s[2 * i]) * 16 + digit(s[2 * i + 1]));
+  }
+  return res;
+}
+
+// hash-to-group test vectors from RFC 9496 (appendix A.3)
+static constexpr std::string_view inputs[] = {
+    "5d1be09e3d0c82fc538112490e35701979d99e06ca3e2b5b54bffe8b4dc772c1"
+    "4d98b696a1bbfb5ca32c436cc61c16563790306c79eaca7705668b47dffe5bb6",
+    "f116b34b8f17ceb56e8732a60d913dd10cce47a6d53bee9204be8b44f6678b27"
+    "0102a56902e2488c46120e9276cfe54638286b9e4b3cdb470b542d46c2068d38",
+    "8422e1bbdaab52938b81fd602effb6f89110e1e57208ad12d9ad767e2e25510c"
+    "27140775f9337088b982d83d7fcf0b2fa1edffe51952cbe7365e95c86eaf325c",
+    "ac22415129b61427bf464e17baee8db65940c233b98afce8d17c57beeb7876c2"
+    "150d15af1cb1fb824bbd14955f2b57d08d388aab431a391cfc33d5bafb5dbbaf",
+    "165d697a1ef3d5cf3c38565beefcf88c0f282b8e7dbd28544c483432f1cec767"
+    "5debea8ebb4e5fe7d6f6e5db15f15587ac4d4d4a1de7191e0c1ca6664abcc413",
+    "a836e6c9a9ca9f1e8d486273ad56a78c70cf18f0ce10abb1c7172ddd605d7fd2"
+    "979854f47ae1ccf204a33102095b4200e5befc0465accc263175485f0e17ea5c",
+    "2cdc11eaeb95daf01189417cdddbf95952993aa9cb9c640eb5058d09702c7462"
+    "2c9965a697a3b345ec24ee56335b556e677b30e6f90ac77d781064f866a3c982",
+};
+
+static constexpr std::string_view outputs[] = {
+    "3066f82a1a747d45120d1740f14358531a8f04bbffe6a819f86dfe50f44a0a46",
+    "f26e5b6f7d362d2d2a94c5d0e7602cb4773c95a2e5c31a64f133189fa76ed61b",
+    "006ccd2a9e6867e6a2c5cea83d3302cc9de128dd2a9a57dd8ee7b9d7ffe02826",
+    "f8f0c87cf237953c5890aec3998169005dae3eca1fbb04548c635953c817f92a",
+    "ae81e7dedf20a497e10c304a765c1767a42d6e06029758d2d7e8ef7cc4c41179",
+    "e2705652ff9f5e44d3e841bf1c251cf7dddb77d140870d1ab2ed64f1a9ce8628",
+    "80bd07262511cdde4863f8a7434cef696750681cb9510eea557088f76d9e5065",
+};
+
+TEST_CASE("we can hash uniform bytes to ristretto points") {
+  constexpr size_t n = std::size(inputs);
+
+  SECTION("we match the RFC 9496 test vectors") {
+    for (size_t i = 0; i < n; ++i) {
+      c21t::element_p3 p;
+      hash_to_group(p, from_hex<64>(inputs[i]).data());
+      std::array<uint8_t, 32> s;
+      to_bytes(s.data(), p);
+      REQUIRE(s == from_hex<32>(outputs[i]));
+    }
+  }
+
+  SECTION("batch hashing matches hashing one element at a time") {
+    std::vector<uint8_t> bytes;
+    for (size_t k = 0; k < 20; ++k) {
+      auto input = from_hex<64>(inputs[k % n]);
+      input[k % 64] ^= static_cast<uint8_t>(k);
+      bytes.insert(bytes.end(), input.begin(), input.end());
+    }
+    std::vector<c21t::element_p3> px(bytes.size() / hash_to_group_num_bytes_v);
+    batch_hash_to_group(px, bytes);
+    for (size_t i = 0; i < px.size(); ++i) {
+      c21t::element_p3 expected;
+      hash_to_group(expected, bytes.data() + i * hash_to_group_num_bytes_v);
+      REQUIRE(px[i] == expected);
+    }
+  }
+
+  SECTION("we handle an empty batch") { batch_hash_to_group({}, {}); }
+}
@@ -16,8 +16,12 @@
  */
 #include "sxt/ristretto/operation/compression.h"
 
+#include <atomic>
+
 #include "sxt/base/error/assert.h"
+#include "sxt/base/iterator/index_range.h"
 #include "sxt/curve21/type/element_p3.h"
+#include "sxt/execution/thread/parallel_for.h"
 #include "sxt/ristretto/base/byte_conversion.h"
 #include "sxt/ristretto/type/compressed_element.h"
 
@@ -36,14 +40,48 @@ void decompress(c21t::element_p3& e_p, const rstt::compressed_element& e) noexce
   rstb::from_bytes(e_p, e.data());
 }
 
+//--------------------------------------------------------------------------------------------------
+// batch_min_chunk_size_v
+//--------------------------------------------------------------------------------------------------
+/**
+ * Each element costs an inverse square root, so fairly small chunks are enough to amortize the
+ * cost of a thread.
+ */
+static constexpr size_t batch_min_chunk_size_v = 64;
+
 //--------------------------------------------------------------------------------------------------
 // batch_compress
 //--------------------------------------------------------------------------------------------------
 void batch_compress(basct::span<rstt::compressed_element> ex_p,
                     basct::cspan<c21t::element_p3> ex) noexcept {
   SXT_DEBUG_ASSERT(ex_p.size() == ex.size());
-  for (size_t i = 0; i < ex.size(); ++i) {
-    compress(ex_p[i], ex[i]);
-  }
+  xent::parallel_for(basit::index_range{0, ex.size()}.min_chunk_size(batch_min_chunk_size_v),
+                     [&](basit::index_range rng) noexcept {
+                       for (size_t i = rng.a(); i < rng.b(); ++i) {
+                         compress(ex_p[i], ex[i]);
+                       }
+                     });
+}
+
+//--------------------------------------------------------------------------------------------------
+// batch_decompress
+//--------------------------------------------------------------------------------------------------
+int batch_decompress(basct::span<c21t::element_p3> ex_p,
+                     basct::cspan<rstt::compressed_element> ex) noexcept {
+  SXT_DEBUG_ASSERT(ex_p.size() == ex.size());
+  std::atomic<int> res = 0;
+  xent::parallel_for(basit::index_range{0, ex.size()}.min_chunk_size(batch_min_chunk_size_v),
+                     [&](basit::index_range rng) noexcept {
+                       int chunk_res = 0;
+                       for (size_t i = rng.a(); i < rng.b(); ++i) {
+                         if (rstb::from_bytes(ex_p[i], ex[i].data()) != 0) {
+                           chunk_res = -1;
+                         }
+                       }
+                       if (chunk_res != 0) {
+                         res.store(chunk_res);
+                       }
+                     });
+  return res;
 }
 } // namespace sxt::rsto
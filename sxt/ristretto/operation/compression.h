@@ -41,4 +41,13 @@ void decompress(c21t::element_p3& e_p, const rstt::compressed_element& e) noexce
 //--------------------------------------------------------------------------------------------------
 void batch_compress(basct::span<rstt::compressed_element> ex_p,
                     basct::cspan<c21t::element_p3> ex) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// batch_decompress
+//--------------------------------------------------------------------------------------------------
+/**
+ * Returns 0 if every element encodes a valid ristretto point; otherwise, returns -1.
+ */
+int batch_decompress(basct::span<c21t::element_p3> ex_p,
+                     basct::cspan<rstt::compressed_element> ex) noexcept;
 } // namespace sxt::rsto
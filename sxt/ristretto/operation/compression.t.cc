@@ -0,0 +1,78 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/ristretto/operation/compression.h"
+
+#include <random>
+#include <vector>
+
+#include "sxt/base/test/unit_test.h"
+#include "sxt/curve21/type/element_p3.h"
+#include "sxt/ristretto/random/element.h"
+#include "sxt/ristretto/type/compressed_element.h"
+
+using namespace sxt;
+using namespace sxt::rsto;
+
+TEST_CASE("we can compress and decompress ristretto elements") {
+  std::mt19937 rng;
+  std::vector<c21t::element_p3> elements(3);
+  rstrn::generate_random_elements(elements, rng);
+  elements[1] = c21t::element_p3::identity();
+
+  SECTION("we can round trip a single element") {
+    rstt::compressed_element ce;
+    compress(ce, elements[0]);
+    c21t::element_p3 e;
+    decompress(e, ce);
+    REQUIRE(e == elements[0]);
+  }
+
+  SECTION("we can round trip a batch of elements") {
+    std::vector<rstt::compressed_element> compressed(3);
+    batch_compress(compressed, elements);
+    std::vector<c21t::element_p3> res(3);
+    REQUIRE(batch_decompress(res, compressed) == 0);
+    REQUIRE(res == elements);
+  }
+
+  SECTION("batch decompression fails if any element is invalid") {
+    std::vector<rstt::compressed_element> compressed(3);
+    batch_compress(compressed, elements);
+    compressed[2].data()[31] = 0xff;
+    std::vector<c21t::element_p3> res(3);
+    REQUIRE(batch_decompress(res, compressed) != 0);
+  }
+
+  SECTION("we can compress and decompress batches split across threads") {
+    elements.resize(300);
+    rstrn::generate_random_elements(elements, rng);
+    std::vector<rstt::compressed_element> compressed(elements.size());
+    batch_compress(compressed, elements);
+    for (size_t i = 0; i < elements.size(); ++i) {
+      rstt::compressed_element expected;
+      compress(expected, elements[i]);
+      REQUIRE(compressed[i] == expected);
+    }
+    std::vector<c21t::element_p3> res(elements.size());
+    REQUIRE(batch_decompress(res, compressed) == 0);
+    std::vector<rstt::compressed_element> recompressed(elements.size());
+    batch_compress(recompressed, res);
+    REQUIRE(recompressed == compressed);
+    compressed[250].data()[31] = 0xff;
+    REQUIRE(batch_decompress(res, compressed) != 0);
+  }
+}
@@ -0,0 +1,96 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/scalar25/operation/batch_arithmetic.h"
+
+#include <algorithm>
+
+#include "sxt/base/error/assert.h"
+#include "sxt/base/iterator/index_range.h"
+#include "sxt/execution/thread/parallel_for.h"
+#include "sxt/scalar25/operation/add.h"
+#include "sxt/scalar25/operation/mul.h"
+#include "sxt/scalar25/operation/muladd.h"
+#include "sxt/scalar25/operation/sub.h"
+#include "sxt/scalar25/type/element.h"
+
+namespace sxt::s25o {
+//--------------------------------------------------------------------------------------------------
+// for_each_index
+//--------------------------------------------------------------------------------------------------
+template <class F> static void for_each_index(size_t n, F f) noexcept {
+  xent::parallel_for(basit::index_range{0, n}.min_chunk_size(batch_arithmetic_min_chunk_size_v),
+                     [&](basit::index_range rng) noexcept {
+                       for (auto i = rng.a(); i < rng.b(); ++i) {
+                         f(i);
+                       }
+                     });
+}
+
+//--------------------------------------------------------------------------------------------------
+// batch_add
+//--------------------------------------------------------------------------------------------------
+void batch_add(basct::span<s25t::element> res, basct::cspan<s25t::element> lhs,
+               basct::cspan<s25t::element> rhs) noexcept {
+  SXT_DEBUG_ASSERT(res.size() == lhs.size() && res.size() == rhs.size());
+  for_each_index(res.size(), [&](size_t i) noexcept { add(res[i], lhs[i], rhs[i]); });
+}
+
+//--------------------------------------------------------------------------------------------------
+// batch_sub
+//--------------------------------------------------------------------------------------------------
+void batch_sub(basct::span<s25t::element> res, basct::cspan<s25t::element> lhs,
+               basct::cspan<s25t::element> rhs) noexcept {
+  SXT_DEBUG_ASSERT(res.size() == lhs.size() && res.size() == rhs.size());
+  for_each_index(res.size(), [&](size_t i) noexcept { sub(res[i], lhs[i], rhs[i]); });
+}
+
+//--------------------------------------------------------------------------------------------------
+// batch_mul
+//--------------------------------------------------------------------------------------------------
+void batch_mul(basct::span<s25t::element> res, basct::cspan<s25t::element> lhs,
+               basct::cspan<s25t::element> rhs) noexcept {
+  SXT_DEBUG_ASSERT(res.size() == lhs.size() && res.size() == rhs.size());
+  for_each_index(res.size(), [&](size_t i) noexcept { mul(res[i], lhs[i], rhs[i]); });
+}
+
+//--------------------------------------------------------------------------------------------------
+// batch_muladd
+//--------------------------------------------------------------------------------------------------
+void batch_muladd(basct::span<s25t::element> res, const s25t::element& a,
+                  basct::cspan<s25t::element> x, basct::cspan<s25t::element> y) noexcept {
+  SXT_DEBUG_ASSERT(res.size() == x.size() && res.size() == y.size());
+  for_each_index(res.size(), [&](size_t i) noexcept { muladd(res[i], a, x[i], y[i]); });
+}
+
+//--------------------------------------------------------------------------------------------------
+// batch_fold
+//--------------------------------------------------------------------------------------------------
+void batch_fold(basct::span<s25t::element> res, const s25t::element& m_low,
+                const s25t::element& m_high, basct::cspan<s25t::element> low,
+                basct::cspan<s25t::element> high) noexcept {
+  SXT_DEBUG_ASSERT(res.size() == low.size() && high.size() <= low.size());
+  auto num_high = high.size();
+  for_each_index(res.size(), [&](size_t i) noexcept {
+    s25t::element t;
+    mul(t, m_low, low[i]);
+    if (i < num_high) {
+      muladd(t, m_high, high[i], t);
+    }
+    res[i] = t;
+  });
+}
+} // namespace sxt::s25o
@@ -0,0 +1,84 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+
+#include "sxt/base/container/span.h"
+
+namespace sxt::s25t {
+class element;
+}
+
+namespace sxt::s25o {
+//--------------------------------------------------------------------------------------------------
+// batch_arithmetic_min_chunk_size_v
+//--------------------------------------------------------------------------------------------------
+/**
+ * Minimum number of elements a thread processes in the batch operations so that thread startup
+ * is amortized.
+ */
+constexpr size_t batch_arithmetic_min_chunk_size_v = 1024;
+
+//--------------------------------------------------------------------------------------------------
+// batch_add
+//--------------------------------------------------------------------------------------------------
+/**
+ * res[i] = lhs[i] + rhs[i]
+ */
+void batch_add(basct::span<s25t::element> res, basct::cspan<s25t::element> lhs,
+               basct::cspan<s25t::element> rhs) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// batch_sub
+//--------------------------------------------------------------------------------------------------
+/**
+ * res[i] = lhs[i] - rhs[i]
+ */
+void batch_sub(basct::span<s25t::element> res, basct::cspan<s25t::element> lhs,
+               basct::cspan<s25t::element> rhs) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// batch_mul
+//--------------------------------------------------------------------------------------------------
+/**
+ * res[i] = lhs[i] * rhs[i]
+ */
+void batch_mul(basct::span<s25t::element> res, basct::cspan<s25t::element> lhs,
+               basct::cspan<s25t::element> rhs) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// batch_muladd
+//--------------------------------------------------------------------------------------------------
+/**
+ * res[i] = a * x[i] + y[i]
+ */
+void batch_muladd(basct::span<s25t::element> res, const s25t::element& a,
+                  basct::cspan<s25t::element> x, basct::cspan<s25t::element> y) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// batch_fold
+//--------------------------------------------------------------------------------------------------
+/**
+ * res[i] = m_low * low[i] + m_high * high[i]
+ *
+ * high may be shorter than low, in which case it's treated as if padded with zeros.
+ */
+void batch_fold(basct::span<s25t::element> res, const s25t::element& m_low,
+                const s25t::element& m_high, basct::cspan<s25t::element> low,
+                basct::cspan<s25t::element> high) noexcept;
+} // namespace sxt::s25o
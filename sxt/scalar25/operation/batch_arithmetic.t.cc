@@ -0,0 +1,101 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2023-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/scalar25/operation/batch_arithmetic.h"
+
+#include <vector>
+
+#include "sxt/base/num/fast_random_number_generator.h"
+#include "sxt/base/test/unit_test.h"
+#include "sxt/scalar25/operation/overload.h"
+#include "sxt/scalar25/random/element.h"
+#include "sxt/scalar25/type/element.h"
+#include "sxt/scalar25/type/literal.h"
+
+using namespace sxt;
+using namespace sxt::s25o;
+using s25t::operator""_s25;
+
+TEST_CASE("we can perform arithmetic on batches of scalars") {
+  basn::fast_random_number_generator rng{1, 2};
+  std::vector<s25t::element> x(2 * batch_arithmetic_min_chunk_size_v + 3);
+  std::vector<s25t::element> y(x.size());
+  s25rn::generate_random_elements(x, rng);
+  s25rn::generate_random_elements(y, rng);
+  std::vector<s25t::element> res(x.size());
+  auto a = 0x123_s25;
+  auto b = 0x456_s25;
+
+  SECTION("we can add") {
+    batch_add(res, x, y);
+    for (size_t i = 0; i < x.size(); ++i) {
+      REQUIRE(res[i] == x[i] + y[i]);
+    }
+  }
+
+  SECTION("we can subtract") {
+    batch_sub(res, x, y);
+    for (size_t i = 0; i < x.size(); ++i) {
+      REQUIRE(res[i] == x[i] - y[i]);
+    }
+  }
+
+  SECTION("we can multiply") {
+    batch_mul(res, x, y);
+    for (size_t i = 0; i < x.size(); ++i) {
+      REQUIRE(res[i] == x[i] * y[i]);
+    }
+  }
+
+  SECTION("we can multiply-add by a scalar") {
+    batch_muladd(res, a, x, y);
+    for (size_t i = 0; i < x.size(); ++i) {
+      REQUIRE(res[i] == a * x[i] + y[i]);
+    }
+  }
+
+  SECTION("we can operate in place") {
+    auto expected = x;
+    batch_add(x, x, y);
+    for (size_t i = 0; i < x.size(); ++i) {
+      REQUIRE(x[i] == expected[i] + y[i]);
+    }
+  }
+
+  SECTION("we can fold") {
+    batch_fold(res, a, b, x, y);
+    for (size_t i = 0; i < x.size(); ++i) {
+      REQUIRE(res[i] == a * x[i] + b * y[i]);
+    }
+  }
+
+  SECTION("we can fold with a short high half") {
+    basct::cspan<s25t::element> high{y.data(), 5};
+    batch_fold(res, a, b, x, high);
+    for (size_t i = 0; i < x.size(); ++i) {
+      if (i < high.size()) {
+        REQUIRE(res[i] == a * x[i] + b * y[i]);
+      } else {
+        REQUIRE(res[i] == a * x[i]);
+      }
+    }
+  }
+
+  SECTION("we handle empty batches") {
+    batch_add({}, {}, {});
+    batch_fold({}, a, b, {}, {});
+  }
+}
@@ -18,6 +18,7 @@
 
 #include <algorithm>
 
+#include "sxt/algorithm/reduction/host_reduction.h"
 #include "sxt/algorithm/reduction/reduction.h"
 #include "sxt/base/device/memory_utility.h"
 #include "sxt/base/device/property.h"
@@ -63,10 +64,9 @@ void inner_product(s25t::element& res, basct::cspan<s25t::element> lhs,
                    basct::cspan<s25t::element> rhs) noexcept {
   auto n = std::min(lhs.size(), rhs.size());
   SXT_DEBUG_ASSERT(n > 0);
-  s25o::mul(res, lhs[0], rhs[0]);
-  for (size_t i = 1; i < n; ++i) {
-    s25o::muladd(res, lhs[i], rhs[i], res);
-  }
+  res = algr::host_reduce<accumulator>(product_mapper{lhs.data(), rhs.data()},
+                                       static_cast<unsigned int>(n))
+            .value();
 }
 
 //--------------------------------------------------------------------------------------------------
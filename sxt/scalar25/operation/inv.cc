@@ -26,6 +26,10 @@
 
 #include <cassert>
 
+#include "sxt/base/error/assert.h"
+#include "sxt/base/iterator/index_range.h"
+#include "sxt/execution/thread/parallel_for.h"
+#include "sxt/memory/management/managed_array.h"
 #include "sxt/scalar25/operation/mul.h"
 #include "sxt/scalar25/operation/sq.h"
 #include "sxt/scalar25/operation/sqmul.h"
@@ -86,16 +90,48 @@ void inv(s25t::element& s_inv, const s25t::element& s) noexcept {
   sqmul(s_inv, 8, _11101011);
 }
 
+//--------------------------------------------------------------------------------------------------
+// batch_inv_chunk
+//--------------------------------------------------------------------------------------------------
+/**
+ * Montgomery's trick: invert the product of the elements once and recover each inverse from the
+ * prefix products with two multiplications.
+ */
+static void batch_inv_chunk(basct::span<s25t::element> sx_inv,
+                            basct::cspan<s25t::element> sx) noexcept {
+  auto n = sx.size();
+  memmg::managed_array<s25t::element> prefixes(n);
+  s25t::element acc{1};
+  for (size_t i = 0; i < n; ++i) {
+    prefixes[i] = acc;
+    if (!s25p::is_zero(sx[i])) {
+      mul(acc, acc, sx[i]);
+    }
+  }
+  s25t::element acc_inv;
+  inv(acc_inv, acc);
+  for (size_t i = n; i-- > 0;) {
+    if (s25p::is_zero(sx[i])) {
+      sx_inv[i] = s25t::element::identity();
+      continue;
+    }
+    s25t::element t;
+    mul(t, acc_inv, prefixes[i]);
+    mul(acc_inv, acc_inv, sx[i]);
+    sx_inv[i] = t;
+  }
+}
+
 //--------------------------------------------------------------------------------------------------
 // batch_inv
 //--------------------------------------------------------------------------------------------------
 void batch_inv(basct::span<s25t::element> sx_inv, basct::cspan<s25t::element> sx) noexcept {
-  // Note: there are more efficient ways to do inversion in bulk; but we're starting
-  // with the simplest approach for now.
   SXT_DEBUG_ASSERT(sx_inv.size() == sx.size());
   auto n = sx_inv.size();
-  for (size_t i = 0; i < n; ++i) {
-    inv(sx_inv[i], sx[i]);
-  }
+  xent::parallel_for(basit::index_range{0, n}.min_chunk_size(batch_inv_min_chunk_size_v),
+                     [&](basit::index_range rng) noexcept {
+                       batch_inv_chunk(sx_inv.subspan(rng.a(), rng.size()),
+                                       sx.subspan(rng.a(), rng.size()));
+                     });
 }
 } // namespace sxt::s25o
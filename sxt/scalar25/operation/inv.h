@@ -16,6 +16,8 @@
  */
 #pragma once
 
+#include <cstddef>
+
 #include "sxt/base/container/span.h"
 #include "sxt/base/macro/cuda_callable.h"
 
@@ -38,8 +40,21 @@ namespace sxt::s25o {
 CUDA_CALLABLE
 void inv(s25t::element& s_inv, const s25t::element& s) noexcept;
 
+//--------------------------------------------------------------------------------------------------
+// batch_inv_min_chunk_size_v
+//--------------------------------------------------------------------------------------------------
+/**
+ * Minimum number of elements a thread inverts in batch_inv so that the single inversion per
+ * chunk stays amortized.
+ */
+constexpr size_t batch_inv_min_chunk_size_v = 1024;
+
 //--------------------------------------------------------------------------------------------------
 // batch_inv
 //--------------------------------------------------------------------------------------------------
+/**
+ * Invert each element of sx using one field inversion per thread chunk. Zero elements have no
+ * inverse and are mapped to zero. sx_inv may alias sx.
+ */
 void batch_inv(basct::span<s25t::element> sx_inv, basct::cspan<s25t::element> sx) noexcept;
 } // namespace sxt::s25o
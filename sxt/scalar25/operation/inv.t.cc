@@ -16,7 +16,11 @@
  */
 #include "sxt/scalar25/operation/inv.h"
 
+#include <vector>
+
+#include "sxt/base/num/fast_random_number_generator.h"
 #include "sxt/base/test/unit_test.h"
+#include "sxt/scalar25/random/element.h"
 #include "sxt/scalar25/type/element.h"
 #include "sxt/scalar25/type/literal.h"
 
@@ -67,3 +71,45 @@ TEST_CASE("we can do bulk inversion") {
   inv(expected, sx[1]);
   REQUIRE(sx_inv[1] == expected);
 }
+
+TEST_CASE("bulk inversion uses a single inversion per chunk") {
+  sxt::basn::fast_random_number_generator rng{1, 2};
+
+  SECTION("we handle an empty batch") {
+    batch_inv({}, {});
+  }
+
+  SECTION("we can invert batches spanning several chunks") {
+    std::vector<element> sx(3 * batch_inv_min_chunk_size_v + 7);
+    sxt::s25rn::generate_random_elements(sx, rng);
+    std::vector<element> sx_inv(sx.size());
+    batch_inv(sx_inv, sx);
+    element expected;
+    for (size_t i = 0; i < sx.size(); ++i) {
+      inv(expected, sx[i]);
+      REQUIRE(sx_inv[i] == expected);
+    }
+  }
+
+  SECTION("zeros are mapped to zero") {
+    std::vector<element> sx = {0x123_s25, 0x0_s25, 0x456_s25};
+    std::vector<element> sx_inv(sx.size());
+    batch_inv(sx_inv, sx);
+    element expected;
+    inv(expected, sx[0]);
+    REQUIRE(sx_inv[0] == expected);
+    REQUIRE(sx_inv[1] == 0x0_s25);
+    inv(expected, sx[2]);
+    REQUIRE(sx_inv[2] == expected);
+  }
+
+  SECTION("we can invert in place") {
+    std::vector<element> sx = {0x123_s25, 0x456_s25};
+    batch_inv(sx, sx);
+    element expected;
+    inv(expected, 0x123_s25);
+    REQUIRE(sx[0] == expected);
+    inv(expected, 0x456_s25);
+    REQUIRE(sx[1] == expected);
+  }
+}
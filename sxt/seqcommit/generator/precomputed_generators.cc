@@ -16,7 +16,15 @@
  */
 #include "sxt/seqcommit/generator/precomputed_generators.h"
 
+#include <algorithm>
+
+#include "sxt/base/iterator/index_range.h"
 #include "sxt/curve21/type/element_p3.h"
+#include "sxt/execution/thread/numa_topology.h"
+#include "sxt/execution/thread/parallel_for.h"
+#include "sxt/memory/management/managed_array.h"
+#include "sxt/ristretto/operation/compression.h"
+#include "sxt/ristretto/type/compressed_element.h"
 #include "sxt/seqcommit/generator/cpu_generator.h"
 #include "sxt/seqcommit/generator/gpu_generator.h"
 
@@ -26,22 +34,115 @@ namespace sxt::sqcgn {
 //--------------------------------------------------------------------------------------------------
 static basct::cspan<c21t::element_p3> precomputed_generators_v{};
 
+//--------------------------------------------------------------------------------------------------
+// precomputed_compressed_generators_v
+//--------------------------------------------------------------------------------------------------
+static basct::cspan<rstt::compressed_element> precomputed_compressed_generators_v{};
+
+//--------------------------------------------------------------------------------------------------
+// compute_generators
+//--------------------------------------------------------------------------------------------------
+static void compute_generators(basct::span<c21t::element_p3> generators, uint64_t offset,
+                               bool use_gpu) noexcept {
+  if (use_gpu) {
+    sqcgn::gpu_get_generators(generators, offset);
+  } else {
+    sqcgn::cpu_get_generators(generators, offset);
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// init_compressed_generators
+//--------------------------------------------------------------------------------------------------
+static void init_compressed_generators(size_t n, bool use_gpu) noexcept {
+  // see https://isocpp.org/wiki/faq/ctors#static-init-order-on-first-use
+  auto data = new rstt::compressed_element[n];
+  xent::interleave_first_touch({reinterpret_cast<std::byte*>(data), sizeof(*data) * n});
+
+  // compute the generators a chunk at a time so that the expanded form is never held in full
+  constexpr size_t chunk_size = 1u << 16;
+  memmg::managed_array<c21t::element_p3> chunk(std::min(n, chunk_size));
+  for (size_t first = 0; first < n; first += chunk_size) {
+    auto m = std::min(chunk_size, n - first);
+    basct::span<c21t::element_p3> generators{chunk.data(), m};
+    compute_generators(generators, first, use_gpu);
+    rsto::batch_compress({data + first, m}, generators);
+  }
+
+  precomputed_compressed_generators_v = {data, n};
+}
+
+//--------------------------------------------------------------------------------------------------
+// decompress_precomputed_generators
+//--------------------------------------------------------------------------------------------------
+/**
+ * Chunks are already spread across threads, so each chunk decompresses serially rather than
+ * through rsto::batch_decompress, which would spawn threads of its own.
+ */
+static void decompress_precomputed_generators(basct::span<c21t::element_p3> generators,
+                                              size_t offset) noexcept {
+  auto compressed = precomputed_compressed_generators_v.subspan(offset, generators.size());
+  xent::parallel_for(basit::index_range{0, generators.size()}
+                         .min_chunk_size(generator_decompression_chunk_size_v)
+                         .max_chunk_size(generator_decompression_chunk_size_v),
+                     [&](basit::index_range rng) noexcept {
+                       for (size_t i = rng.a(); i < rng.b(); ++i) {
+                         rsto::decompress(generators[i], compressed[i]);
+                       }
+                     });
+}
+
+//--------------------------------------------------------------------------------------------------
+// num_precomputed_generators
+//--------------------------------------------------------------------------------------------------
+static size_t num_precomputed_generators() noexcept {
+  return std::max(precomputed_generators_v.size(), precomputed_compressed_generators_v.size());
+}
+
+//--------------------------------------------------------------------------------------------------
+// fill_generators
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write the generators offset...(offset + generators.size()), taking the ones that are
+ * precomputed from the table and computing the rest.
+ */
+static void fill_generators(basct::span<c21t::element_p3> generators, size_t offset,
+                            bool use_gpu) noexcept {
+  auto num_precomputed = num_precomputed_generators();
+  size_t num_copied = 0;
+  if (num_precomputed > offset) {
+    num_copied = std::min(num_precomputed - offset, generators.size());
+    if (precomputed_compressed_generators_v.empty()) {
+      std::copy_n(precomputed_generators_v.begin() + offset, num_copied, generators.begin());
+    } else {
+      decompress_precomputed_generators(generators.subspan(0, num_copied), offset);
+    }
+  }
+  if (num_copied < generators.size()) {
+    compute_generators(generators.subspan(num_copied), offset + num_copied, use_gpu);
+  }
+}
+
 //--------------------------------------------------------------------------------------------------
 // init_precomputed_generators
 //--------------------------------------------------------------------------------------------------
-void init_precomputed_generators(size_t n, bool use_gpu) noexcept {
-  if (!precomputed_generators_v.empty() || n == 0) {
+void init_precomputed_generators(size_t n, bool use_gpu, bool compressed) noexcept {
+  if (num_precomputed_generators() > 0 || n == 0) {
+    return;
+  }
+
+  if (compressed) {
+    init_compressed_generators(n, use_gpu);
     return;
   }
 
   // see https://isocpp.org/wiki/faq/ctors#static-init-order-on-first-use
   auto data = new c21t::element_p3[n];
 
-  if (use_gpu) {
-    sqcgn::gpu_get_generators({data, n}, 0);
-  } else {
-    sqcgn::cpu_get_generators({data, n}, 0);
-  }
+  // every node reads the table, so balance its pages across the nodes before it's written
+  xent::interleave_first_touch({reinterpret_cast<std::byte*>(data), sizeof(*data) * n});
+
+  compute_generators({data, n}, 0, use_gpu);
 
   precomputed_generators_v = {data, n};
 }
@@ -61,32 +162,36 @@ get_precomputed_generators(std::vector<c21t::element_p3>& generators_data, size_
   }
 
   generators_data.resize(length_generators);
+  fill_generators(generators_data, offset, use_gpu);
+  return generators_data;
+}
 
-  size_t gen_span_offset = 0;
-  basct::span<c21t::element_p3> gen_span;
-
-  if (precomputed_generators_v.size() > offset) {
-    std::copy(precomputed_generators_v.begin() + offset, precomputed_generators_v.end(),
-              generators_data.begin());
-
-    // compute generators from `gen_span_offset...(gen_span.size() + gen_span_offset)`
-    gen_span_offset = precomputed_generators_v.size();
-
-    gen_span = {generators_data.data() + (precomputed_generators_v.size() - offset),
-                (length_generators + offset) - precomputed_generators_v.size()};
-  } else {
-    // compute generators from `offset...(offset + length_generators)`
-    gen_span_offset = offset;
-
-    gen_span = {generators_data.data(), length_generators};
+//--------------------------------------------------------------------------------------------------
+// get_precomputed_generator_segments
+//--------------------------------------------------------------------------------------------------
+mtxb::segmented_generators<c21t::element_p3>
+get_precomputed_generator_segments(size_t length_generators, size_t offset,
+                                   bool use_gpu) noexcept {
+  auto precomputed = get_precomputed_generators();
+  if (precomputed.size() >= length_generators + offset) {
+    return {precomputed.subspan(offset, length_generators)};
   }
-
-  if (use_gpu) {
-    sqcgn::gpu_get_generators(gen_span, gen_span_offset);
+  if (precomputed.size() > offset) {
+    precomputed = precomputed.subspan(offset);
   } else {
-    sqcgn::cpu_get_generators(gen_span, gen_span_offset);
+    precomputed = {};
   }
+  return {precomputed, length_generators,
+          [offset, use_gpu](basct::span<c21t::element_p3> generators, size_t first) noexcept {
+            fill_generators(generators, offset + first, use_gpu);
+          }};
+}
 
-  return generators_data;
+//--------------------------------------------------------------------------------------------------
+// reset_precomputed_generators_for_testing
+//--------------------------------------------------------------------------------------------------
+void reset_precomputed_generators_for_testing() noexcept {
+  precomputed_generators_v = {};
+  precomputed_compressed_generators_v = {};
 }
 } // namespace sxt::sqcgn
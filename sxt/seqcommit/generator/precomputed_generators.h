@@ -20,23 +20,78 @@
 #include <vector>
 
 #include "sxt/base/container/span.h"
+#include "sxt/multiexp/base/segmented_generators.h"
 
 namespace sxt::c21t {
 struct element_p3;
 }
 
 namespace sxt::sqcgn {
+//--------------------------------------------------------------------------------------------------
+// generator_decompression_chunk_size_v
+//--------------------------------------------------------------------------------------------------
+/**
+ * When the precomputed generators are stored compressed, they are decompressed in chunks of this
+ * many elements so that each worker's output stays in cache.
+ */
+constexpr size_t generator_decompression_chunk_size_v = 1024;
+
 //--------------------------------------------------------------------------------------------------
 // init_precomputed_generators
 //--------------------------------------------------------------------------------------------------
-void init_precomputed_generators(size_t n, bool use_gpu) noexcept;
+/**
+ * Precompute the first n generators.
+ *
+ * If compressed is true, the generators are kept as 32-byte ristretto encodings instead of
+ * 160-byte element_p3 values and are decompressed into the caller's buffer on access. This trades
+ * the cost of a decompression per generator use for a fifth of the memory. Decompressed
+ * generators are equal to the computed ones as ristretto points but may be a different
+ * representative.
+ *
+ * On a multi-node machine the table's pages are interleaved across the NUMA nodes.
+ */
+void init_precomputed_generators(size_t n, bool use_gpu, bool compressed = false) noexcept;
 
 //--------------------------------------------------------------------------------------------------
 // get_precomputed_generators
 //--------------------------------------------------------------------------------------------------
+/**
+ * The precomputed generators.
+ *
+ * If the generators are stored compressed, the span is empty; use the overload below, which
+ * decompresses the requested range.
+ *
+ * Note: The overload below returns the range contiguously, so with compressed storage the whole
+ * range is decompressed into generators_data and held for as long as the caller uses it. Compressed
+ * storage therefore only bounds memory for callers that go through
+ * get_precomputed_generator_segments, which decompresses a chunk at a time; for the others it
+ * saves memory only while the table is idle.
+ */
 basct::cspan<c21t::element_p3> get_precomputed_generators() noexcept;
 
 basct::cspan<c21t::element_p3>
 get_precomputed_generators(std::vector<c21t::element_p3>& generators_data,
                            size_t length_longest_sequence, size_t offset, bool use_gpu) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// get_precomputed_generator_segments
+//--------------------------------------------------------------------------------------------------
+/**
+ * The generators offset...(offset + length_generators) as a precomputed segment followed by a
+ * tail that is computed on access.
+ *
+ * Unlike the overload of get_precomputed_generators that takes a buffer, the precomputed
+ * generators aren't copied. If the generators are stored compressed, the precomputed segment is
+ * empty and the tail decompresses them.
+ */
+mtxb::segmented_generators<c21t::element_p3>
+get_precomputed_generator_segments(size_t length_generators, size_t offset, bool use_gpu) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// reset_precomputed_generators_for_testing
+//--------------------------------------------------------------------------------------------------
+/**
+ * Forget the precomputed generators so that they can be initialized again. The storage is leaked.
+ */
+void reset_precomputed_generators_for_testing() noexcept;
 } // namespace sxt::sqcgn
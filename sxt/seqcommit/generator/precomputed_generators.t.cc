@@ -18,6 +18,9 @@
 
 #include "sxt/base/test/unit_test.h"
 #include "sxt/curve21/type/element_p3.h"
+#include "sxt/memory/management/managed_array.h"
+#include "sxt/ristretto/operation/compression.h"
+#include "sxt/ristretto/type/compressed_element.h"
 #include "sxt/seqcommit/generator/base_element.h"
 
 using namespace sxt;
@@ -89,3 +92,96 @@ TEST_CASE("we can precompute generators") {
   REQUIRE(generators[1] == e);
   REQUIRE(generators.size() == 2);
 }
+
+TEST_CASE("we can access precomputed generators as segments") {
+  reset_precomputed_generators_for_testing();
+  init_precomputed_generators(10, false);
+  auto precomputed = get_precomputed_generators();
+  memmg::managed_array<c21t::element_p3> data;
+  c21t::element_p3 e;
+
+  SECTION("a range within the precomputed generators has no tail") {
+    auto generators = get_precomputed_generator_segments(6, 2, false);
+    REQUIRE(generators.size() == 6);
+    REQUIRE(generators.precomputed().data() == precomputed.data() + 2);
+    REQUIRE(generators.precomputed().size() == 6);
+  }
+
+  SECTION("a range that extends past the precomputed generators computes the tail") {
+    auto generators = get_precomputed_generator_segments(8, 5, false);
+    REQUIRE(generators.size() == 8);
+    REQUIRE(generators.precomputed().data() == precomputed.data() + 5);
+    REQUIRE(generators.precomputed().size() == 5);
+    auto tail = generators.get(data, 4, 4);
+    for (size_t i = 0; i < tail.size(); ++i) {
+      compute_base_element(e, i + 9);
+      REQUIRE(tail[i] == e);
+    }
+  }
+
+  SECTION("a range that starts after the precomputed generators is all tail") {
+    auto generators = get_precomputed_generator_segments(2, 12, false);
+    REQUIRE(generators.precomputed().empty());
+    auto tail = generators.get(data, 0, 2);
+    compute_base_element(e, 13);
+    REQUIRE(tail[1] == e);
+  }
+  reset_precomputed_generators_for_testing();
+}
+
+// decompressed generators can differ from the computed values by a torsion point, so compare
+// their ristretto encodings
+static bool is_ristretto_equal(const c21t::element_p3& lhs, const c21t::element_p3& rhs) noexcept {
+  rstt::compressed_element lhs_p, rhs_p;
+  rsto::compress(lhs_p, lhs);
+  rsto::compress(rhs_p, rhs);
+  return lhs_p == rhs_p;
+}
+
+TEST_CASE("we can precompute generators in compressed form") {
+  reset_precomputed_generators_for_testing();
+  init_precomputed_generators(10, false, true);
+
+  // compressed generators aren't accessible without decompressing them
+  REQUIRE(get_precomputed_generators().empty());
+
+  std::vector<c21t::element_p3> data;
+  c21t::element_p3 e;
+
+  SECTION("we can access a range within the precomputed generators") {
+    auto generators = get_precomputed_generators(data, 6, 2, false);
+    REQUIRE(generators.size() == 6);
+    for (size_t i = 0; i < generators.size(); ++i) {
+      compute_base_element(e, i + 2);
+      REQUIRE(is_ristretto_equal(generators[i], e));
+    }
+  }
+
+  SECTION("we can access a range that extends past the precomputed generators") {
+    auto generators = get_precomputed_generators(data, 8, 5, false);
+    REQUIRE(generators.size() == 8);
+    for (size_t i = 0; i < generators.size(); ++i) {
+      compute_base_element(e, i + 5);
+      REQUIRE(is_ristretto_equal(generators[i], e));
+    }
+  }
+
+  SECTION("we can access a range that starts after the precomputed generators") {
+    auto generators = get_precomputed_generators(data, 2, 12, false);
+    REQUIRE(generators.size() == 2);
+    compute_base_element(e, 13);
+    REQUIRE(generators[1] == e);
+  }
+
+  SECTION("we can access a range that spans several decompression chunks") {
+    reset_precomputed_generators_for_testing();
+    auto n = 2 * generator_decompression_chunk_size_v + 3;
+    init_precomputed_generators(n, false, true);
+    auto generators = get_precomputed_generators(data, n, 0, false);
+    REQUIRE(generators.size() == n);
+    compute_base_element(e, generator_decompression_chunk_size_v);
+    REQUIRE(is_ristretto_equal(generators[generator_decompression_chunk_size_v], e));
+    compute_base_element(e, n - 1);
+    REQUIRE(is_ristretto_equal(generators[n - 1], e));
+  }
+}
@@ -23,9 +23,9 @@ namespace sxt::sqcgn {
 //--------------------------------------------------------------------------------------------------
 // init_precomputed_components
 //--------------------------------------------------------------------------------------------------
-void init_precomputed_components(size_t n, bool use_gpu) noexcept {
+void init_precomputed_components(size_t n, bool use_gpu, bool compressed_generators) noexcept {
   // generators must be initialized before one_commitments as the latter uses the first
-  init_precomputed_generators(n, use_gpu);
+  init_precomputed_generators(n, use_gpu, compressed_generators);
   init_precomputed_one_commitments(n);
 }
 } // namespace sxt::sqcgn
@@ -26,5 +26,10 @@ namespace sxt::sqcgn {
 //--------------------------------------------------------------------------------------------------
 // init_precomputed_components
 //--------------------------------------------------------------------------------------------------
-void init_precomputed_components(size_t n, bool use_gpu) noexcept;
+/**
+ * If compressed_generators is true, the generators are stored as ristretto encodings; see
+ * init_precomputed_generators.
+ */
+void init_precomputed_components(size_t n, bool use_gpu,
+                                 bool compressed_generators = false) noexcept;
 } // namespace sxt::sqcgn